@@ -0,0 +1,4511 @@
+////////////////////////////////////////////////////////////////////////////////
+// fixtures.h - generated by objfixtures; do not edit.
+//
+// The corpus meshes of at most 16384 bytes and every tiling pattern at
+// 16 x 16, as constexpr arrays.  Look a mesh up by its path
+// relative to the corpus root, or by "tilings/<pattern>_<rows>x<cols>":
+//
+//    constexpr const fixtures::Fixture* octahedron =
+//       fixtures::find( "simple/octahedron.obj" );
+//
+// Vertices are x y z triples.  Face i uses the zero-based vertex indices
+// faceIndex[ faceStart[i] ] through faceIndex[ faceStart[i+1]-1 ].
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FIXTURES_H
+#define FIXTURES_H
+
+namespace fixtures
+{
+
+struct Fixture
+{
+   const char*  name;
+   int          nVertices;
+   int          nFaces;
+   const float* vertex;
+   const int*   faceStart;
+   const int*   faceIndex;
+};
+
+namespace data
+{
+
+   // cube_soup.obj
+   constexpr float m_cube_soup_obj_vertex[] =
+   {
+      -10.0f, 0.0f, 10.0f, 10.0f, 0.0f, 10.0f,
+      10.0f, 20.0f, 10.0f, -10.0f, 20.0f, 10.0f,
+      -10.0f, 20.0f, 10.0f, 10.0f, 20.0f, 10.0f,
+      10.0f, 20.0f, -10.0f, -10.0f, 20.0f, -10.0f,
+      -10.0f, 20.0f, -10.0f, 10.0f, 20.0f, -10.0f,
+      10.0f, 0.0f, -10.0f, -10.0f, 0.0f, -10.0f,
+      -10.0f, 0.0f, -10.0f, 10.0f, 0.0f, -10.0f,
+      10.0f, 0.0f, 10.0f, -10.0f, 0.0f, 10.0f,
+      10.0f, 0.0f, 10.0f, 10.0f, 0.0f, -10.0f,
+      10.0f, 20.0f, -10.0f, 10.0f, 20.0f, 10.0f,
+      -10.0f, 0.0f, -10.0f, -10.0f, 0.0f, 10.0f,
+      -10.0f, 20.0f, 10.0f, -10.0f, 20.0f, -10.0f
+   };
+   constexpr int m_cube_soup_obj_faceStart[] =
+   {
+      0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33,
+      36
+   };
+   constexpr int m_cube_soup_obj_faceIndex[] =
+   {
+      0, 1, 2, 0, 2, 3, 4, 5, 6, 4, 6, 7,
+      8, 9, 10, 8, 10, 11, 12, 13, 14, 12, 14, 15,
+      16, 17, 18, 16, 18, 19, 20, 21, 22, 20, 22, 23
+   };
+
+   // grid_holes.obj
+   constexpr float m_grid_holes_obj_vertex[] =
+   {
+      -1.0f, -1.0f, -0.0f, 1.0f, -1.0f, -0.0f,
+      -1.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+      0.0f, -1.0f, -0.0f, 0.0f, 1.0f, 0.0f,
+      -1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+      0.0f, 0.0f, 0.0f, -0.5f, 1.0f, 0.0f,
+      -0.5f, -1.0f, -0.0f, -0.5f, 0.0f, 0.0f,
+      0.5f, -1.0f, -0.0f, 0.5f, 1.0f, 0.0f,
+      0.5f, 0.0f, 0.0f, 1.0f, 0.5f, 0.0f,
+      0.0f, 0.5f, 0.0f, -1.0f, 0.5f, 0.0f,
+      -0.5f, 0.5f, 0.0f, 0.5f, 0.5f, 0.0f,
+      -1.0f, -0.5f, -0.0f, 1.0f, -0.5f, -0.0f,
+      0.0f, -0.5f, -0.0f, -0.5f, -0.5f, -0.0f,
+      0.5f, -0.5f, -0.0f, -1.0f, -0.75f, -0.0f,
+      0.75f, -1.0f, -0.0f, 1.0f, 0.75f, 0.0f,
+      -0.75f, 1.0f, 0.0f, -0.25f, -1.0f, -0.0f,
+      0.25f, 1.0f, 0.0f, 0.0f, 0.75f, 0.0f,
+      -1.0f, 0.25f, 0.0f, 1.0f, -0.25f, -0.0f,
+      0.0f, -0.25f, -0.0f, -0.75f, 0.0f, 0.0f,
+      0.25f, 0.0f, 0.0f, -0.25f, 1.0f, 0.0f,
+      -0.75f, -1.0f, -0.0f, -0.25f, 0.0f, 0.0f,
+      -0.5f, -0.25f, -0.0f, -0.5f, 0.75f, 0.0f,
+      0.25f, -1.0f, -0.0f, 0.75f, 1.0f, 0.0f,
+      0.75f, 0.0f, 0.0f, 0.5f, -0.25f, -0.0f,
+      0.5f, 0.75f, 0.0f, 1.0f, 0.25f, 0.0f,
+      0.0f, 0.25f, 0.0f, -1.0f, 0.75f, 0.0f,
+      -0.5f, 0.25f, 0.0f, 0.5f, 0.25f, 0.0f,
+      0.25f, 0.5f, 0.0f, -0.75f, 0.5f, 0.0f,
+      -0.25f, 0.5f, 0.0f, 0.75f, 0.5f, 0.0f,
+      -1.0f, -0.25f, -0.0f, 1.0f, -0.75f, -0.0f,
+      0.0f, -0.75f, -0.0f, -0.5f, -0.75f, -0.0f,
+      0.5f, -0.75f, -0.0f, 0.25f, -0.5f, -0.0f,
+      -0.75f, -0.5f, -0.0f, 0.75f, -0.5f, -0.0f,
+      -0.25f, -0.5f, -0.0f, -0.25f, -0.75f, -0.0f,
+      0.75f, -0.75f, -0.0f, -0.75f, -0.75f, -0.0f,
+      0.25f, -0.75f, -0.0f, 0.75f, 0.25f, 0.0f,
+      -0.25f, 0.25f, 0.0f, -0.75f, 0.25f, 0.0f,
+      0.25f, 0.25f, 0.0f, 0.25f, 0.75f, 0.0f,
+      0.25f, -0.25f, -0.0f, -0.75f, 0.75f, 0.0f,
+      -0.75f, -0.25f, -0.0f, 0.75f, -0.25f, -0.0f,
+      -0.25f, -0.25f, -0.0f, -0.25f, 0.75f, 0.0f,
+      0.75f, 0.75f, 0.0f, -1.0f, -0.875f, -0.0f,
+      0.875f, -1.0f, -0.0f, 1.0f, 0.875f, 0.0f,
+      -0.875f, 1.0f, 0.0f, -0.125f, -1.0f, -0.0f,
+      0.125f, 1.0f, 0.0f, 0.0f, 0.875f, 0.0f,
+      -1.0f, 0.125f, 0.0f, 1.0f, -0.125f, -0.0f,
+      0.0f, -0.125f, -0.0f, -0.875f, 0.0f, 0.0f,
+      0.125f, 0.0f, 0.0f, -0.375f, 1.0f, 0.0f,
+      -0.625f, -1.0f, -0.0f, -0.375f, 0.0f, 0.0f,
+      -0.5f, -0.125f, -0.0f, -0.5f, 0.875f, 0.0f,
+      0.375f, -1.0f, -0.0f, 0.625f, 1.0f, 0.0f,
+      0.625f, 0.0f, 0.0f, 0.5f, -0.125f, -0.0f,
+      0.5f, 0.875f, 0.0f, 1.0f, 0.375f, 0.0f,
+      0.0f, 0.375f, 0.0f, -1.0f, 0.625f, 0.0f,
+      -0.5f, 0.375f, 0.0f, 0.5f, 0.375f, 0.0f,
+      0.125f, 0.5f, 0.0f, -0.875f, 0.5f, 0.0f,
+      -0.375f, 0.5f, 0.0f, 0.625f, 0.5f, 0.0f,
+      -1.0f, -0.375f, -0.0f, 1.0f, -0.625f, -0.0f,
+      0.0f, -0.625f, -0.0f, -0.5f, -0.625f, -0.0f,
+      0.5f, -0.625f, -0.0f, 0.125f, -0.5f, -0.0f,
+      -0.875f, -0.5f, -0.0f, 0.625f, -0.5f, -0.0f,
+      -0.375f, -0.5f, -0.0f, -1.0f, -0.625f, -0.0f,
+      0.625f, -1.0f, -0.0f, 1.0f, 0.625f, 0.0f,
+      -0.625f, 1.0f, 0.0f, -0.375f, -1.0f, -0.0f,
+      0.375f, 1.0f, 0.0f, 0.0f, 0.625f, 0.0f,
+      -1.0f, 0.375f, 0.0f, 1.0f, -0.375f, -0.0f,
+      0.0f, -0.375f, -0.0f, -0.625f, 0.0f, 0.0f,
+      0.375f, 0.0f, 0.0f, -0.125f, 1.0f, 0.0f,
+      -0.875f, -1.0f, -0.0f, -0.125f, 0.0f, 0.0f,
+      -0.5f, -0.375f, -0.0f, -0.5f, 0.625f, 0.0f,
+      0.125f, -1.0f, -0.0f, 0.875f, 1.0f, 0.0f,
+      0.875f, 0.0f, 0.0f, 0.5f, -0.375f, -0.0f,
+      0.5f, 0.625f, 0.0f, 1.0f, 0.125f, 0.0f,
+      0.0f, 0.125f, 0.0f, -1.0f, 0.875f, 0.0f,
+      -0.5f, 0.125f, 0.0f, 0.5f, 0.125f, 0.0f,
+      0.375f, 0.5f, 0.0f, -0.625f, 0.5f, 0.0f,
+      -0.125f, 0.5f, 0.0f, 0.875f, 0.5f, 0.0f,
+      -1.0f, -0.125f, -0.0f, 1.0f, -0.875f, -0.0f,
+      0.0f, -0.875f, -0.0f, -0.5f, -0.875f, -0.0f,
+      0.5f, -0.875f, -0.0f, 0.375f, -0.5f, -0.0f,
+      -0.625f, -0.5f, -0.0f, 0.875f, -0.5f, -0.0f,
+      -0.125f, -0.5f, -0.0f, -0.25f, -0.625f, -0.0f,
+      -0.25f, -0.875f, -0.0f, -0.375f, -0.75f, -0.0f,
+      -0.125f, -0.75f, -0.0f, 0.75f, -0.625f, -0.0f,
+      0.75f, -0.875f, -0.0f, 0.625f, -0.75f, -0.0f,
+      0.875f, -0.75f, -0.0f, -0.75f, -0.625f, -0.0f,
+      -0.75f, -0.875f, -0.0f, -0.875f, -0.75f, -0.0f,
+      -0.625f, -0.75f, -0.0f, 0.25f, -0.625f, -0.0f,
+      0.25f, -0.875f, -0.0f, 0.125f, -0.75f, -0.0f,
+      0.375f, -0.75f, -0.0f, 0.75f, 0.375f, 0.0f,
+      0.75f, 0.125f, 0.0f, 0.625f, 0.25f, 0.0f,
+      0.875f, 0.25f, 0.0f, -0.25f, 0.375f, 0.0f,
+      -0.25f, 0.125f, 0.0f, -0.375f, 0.25f, 0.0f,
+      -0.125f, 0.25f, 0.0f, -0.75f, 0.375f, 0.0f,
+      -0.75f, 0.125f, 0.0f, -0.875f, 0.25f, 0.0f,
+      -0.625f, 0.25f, 0.0f, 0.25f, 0.375f, 0.0f,
+      0.25f, 0.125f, 0.0f, 0.125f, 0.25f, 0.0f,
+      0.375f, 0.25f, 0.0f, 0.25f, 0.875f, 0.0f,
+      0.25f, 0.625f, 0.0f, 0.125f, 0.75f, 0.0f,
+      0.375f, 0.75f, 0.0f, 0.25f, -0.125f, -0.0f,
+      0.25f, -0.375f, -0.0f, 0.125f, -0.25f, -0.0f,
+      0.375f, -0.25f, -0.0f, -0.75f, 0.875f, 0.0f,
+      -0.75f, 0.625f, 0.0f, -0.875f, 0.75f, 0.0f,
+      -0.625f, 0.75f, 0.0f, -0.75f, -0.125f, -0.0f,
+      -0.75f, -0.375f, -0.0f, -0.875f, -0.25f, -0.0f,
+      -0.625f, -0.25f, -0.0f, 0.75f, -0.125f, -0.0f,
+      0.75f, -0.375f, -0.0f, 0.625f, -0.25f, -0.0f,
+      0.875f, -0.25f, -0.0f, -0.25f, -0.125f, -0.0f,
+      -0.25f, -0.375f, -0.0f, -0.375f, -0.25f, -0.0f,
+      -0.125f, -0.25f, -0.0f, -0.25f, 0.875f, 0.0f,
+      -0.25f, 0.625f, 0.0f, -0.375f, 0.75f, 0.0f,
+      -0.125f, 0.75f, 0.0f, 0.75f, 0.875f, 0.0f,
+      0.75f, 0.625f, 0.0f, 0.625f, 0.75f, 0.0f,
+      0.875f, 0.75f, 0.0f, 0.875f, 0.625f, 0.0f,
+      0.625f, 0.625f, 0.0f, 0.625f, 0.875f, 0.0f,
+      -0.125f, 0.625f, 0.0f, -0.375f, 0.625f, 0.0f,
+      -0.375f, 0.875f, 0.0f, -0.125f, -0.375f, -0.0f,
+      -0.375f, -0.375f, -0.0f, -0.375f, -0.125f, -0.0f,
+      0.875f, -0.375f, -0.0f, 0.625f, -0.375f, -0.0f,
+      0.625f, -0.125f, -0.0f, -0.625f, -0.375f, -0.0f,
+      -0.875f, -0.375f, -0.0f, -0.875f, -0.125f, -0.0f,
+      -0.625f, 0.625f, 0.0f, -0.875f, 0.625f, 0.0f,
+      -0.875f, 0.875f, 0.0f, 0.375f, -0.375f, -0.0f,
+      0.125f, -0.375f, -0.0f, 0.125f, -0.125f, -0.0f,
+      0.375f, 0.625f, 0.0f, 0.125f, 0.625f, 0.0f,
+      0.125f, 0.875f, 0.0f, 0.375f, 0.125f, 0.0f,
+      0.125f, 0.125f, 0.0f, 0.125f, 0.375f, 0.0f,
+      -0.625f, 0.125f, 0.0f, -0.875f, 0.125f, 0.0f,
+      -0.875f, 0.375f, 0.0f, -0.125f, 0.125f, 0.0f,
+      -0.375f, 0.125f, 0.0f, -0.375f, 0.375f, 0.0f,
+      0.875f, 0.125f, 0.0f, 0.625f, 0.125f, 0.0f,
+      0.625f, 0.375f, 0.0f, 0.375f, -0.875f, -0.0f,
+      0.125f, -0.875f, -0.0f, 0.125f, -0.625f, -0.0f,
+      -0.625f, -0.875f, -0.0f, -0.875f, -0.875f, -0.0f,
+      -0.875f, -0.625f, -0.0f, 0.875f, -0.875f, -0.0f,
+      0.625f, -0.875f, -0.0f, 0.625f, -0.625f, -0.0f,
+      -0.125f, -0.875f, -0.0f, -0.375f, -0.875f, -0.0f,
+      -0.375f, -0.625f, -0.0f, -0.125f, -0.625f, -0.0f,
+      0.875f, -0.625f, -0.0f, -0.625f, -0.625f, -0.0f,
+      0.375f, -0.625f, -0.0f, 0.875f, 0.375f, 0.0f,
+      -0.125f, 0.375f, 0.0f, -0.625f, 0.375f, 0.0f,
+      0.375f, 0.375f, 0.0f, 0.375f, 0.875f, 0.0f,
+      0.375f, -0.125f, -0.0f, -0.625f, 0.875f, 0.0f,
+      -0.625f, -0.125f, -0.0f, 0.875f, -0.125f, -0.0f,
+      -0.125f, -0.125f, -0.0f, -0.125f, 0.875f, 0.0f,
+      0.875f, 0.875f, 0.0f
+   };
+   constexpr int m_grid_holes_obj_faceStart[] =
+   {
+      0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33,
+      36, 39, 42, 45, 48, 51, 54, 57, 60, 63, 66, 69,
+      72, 75, 78, 81, 84, 87, 90, 93, 96, 99, 102, 105,
+      108, 111, 114, 117, 120, 123, 126, 129, 132, 135, 138, 141,
+      144, 147, 150, 153, 156, 159, 162, 165, 168, 171, 174, 177,
+      180, 183, 186, 189, 192, 195, 198, 201, 204, 207, 210, 213,
+      216, 219, 222, 225, 228, 231, 234, 237, 240, 243, 246, 249,
+      252, 255, 258, 261, 264, 267, 270, 273, 276, 279, 282, 285,
+      288, 291, 294, 297, 300, 303, 306, 309, 312, 315, 318, 321,
+      324, 327, 330, 333, 336, 339, 342, 345, 348, 351, 354, 357,
+      360, 363, 366, 369, 372, 375, 378, 381, 384, 387, 390, 393,
+      396, 399, 402, 405, 408, 411, 414, 417, 420, 423, 426, 429,
+      432, 435, 438, 441, 444, 447, 450, 453, 456, 459, 462, 465,
+      468, 471, 474, 477, 480, 483, 486, 489, 492, 495, 498, 501,
+      504, 507, 510, 513, 516, 519, 522, 525, 528, 531, 534, 537,
+      540, 543, 546, 549, 552, 555, 558, 561, 564, 567, 570, 573,
+      576, 579, 582, 585, 588, 591, 594, 597, 600, 603, 606, 609,
+      612, 615, 618, 621, 624, 627, 630, 633, 636, 639, 642, 645,
+      648, 651, 654, 657, 660, 663, 666, 669, 672, 675, 678, 681,
+      684, 687, 690, 693, 696, 699, 702, 705, 708, 711, 714, 717,
+      720, 723, 726, 729, 732, 735, 738, 741, 744, 747, 750, 753,
+      756, 759, 762, 765, 768, 771, 774, 777, 780, 783, 786, 789,
+      792, 795, 798, 801, 804, 807, 810, 813, 816, 819, 822, 825,
+      828, 831, 834, 837, 840, 843, 846, 849, 852, 855, 858, 861,
+      864, 867, 870, 873, 876, 879, 882, 885, 888, 891, 894, 897,
+      900, 903, 906, 909, 912, 915, 918, 921, 924, 927, 930, 933,
+      936, 939, 942, 945, 948, 951, 954, 957, 960, 963, 966, 969,
+      972, 975, 978, 981, 984, 987, 990, 993, 996, 999, 1002, 1005,
+      1008, 1011, 1014, 1017, 1020, 1023, 1026, 1029, 1032, 1035, 1038, 1041,
+      1044, 1047, 1050, 1053, 1056, 1059, 1062, 1065, 1068, 1071, 1074, 1077,
+      1080, 1083, 1086, 1089, 1092, 1095, 1098, 1101, 1104, 1107, 1110, 1113,
+      1116, 1119, 1122, 1125, 1128, 1131, 1134, 1137, 1140, 1143, 1146, 1149,
+      1152, 1155, 1158, 1161, 1164, 1167, 1170, 1173, 1176, 1179, 1182, 1185,
+      1188, 1191, 1194, 1197, 1200, 1203, 1206, 1209, 1212, 1215, 1218, 1221,
+      1224, 1227, 1230, 1233, 1236, 1239, 1242, 1245, 1248, 1251, 1254, 1257,
+      1260, 1263, 1266, 1269, 1272, 1275, 1278, 1281, 1284, 1287, 1290, 1293,
+      1296, 1299, 1302, 1305, 1308, 1311, 1314, 1317, 1320, 1323, 1326, 1329,
+      1332, 1335, 1338, 1341, 1344, 1347, 1350, 1353, 1356, 1359, 1362, 1365,
+      1368, 1371, 1374, 1377, 1380, 1383, 1386, 1389, 1392, 1395, 1398, 1401,
+      1404, 1407, 1410, 1413, 1416, 1419, 1422, 1425, 1428, 1431, 1434, 1437,
+      1440, 1443, 1446, 1449, 1452, 1455, 1458, 1461, 1464, 1467, 1470, 1473,
+      1476, 1479, 1482
+   };
+   constexpr int m_grid_holes_obj_faceIndex[] =
+   {
+      83, 139, 288, 87, 133, 287, 90, 135, 286, 89, 140, 285,
+      96, 131, 284, 97, 124, 283, 101, 132, 282, 102, 126, 281,
+      107, 148, 280, 106, 149, 279, 104, 150, 278, 103, 151, 277,
+      116, 157, 276, 115, 158, 275, 113, 159, 274, 162, 163, 271,
+      154, 164, 270, 165, 119, 269, 166, 167, 268, 153, 168, 267,
+      169, 118, 266, 170, 171, 265, 155, 172, 264, 173, 117, 263,
+      174, 175, 262, 156, 176, 261, 177, 111, 260, 178, 179, 259,
+      143, 180, 258, 181, 110, 257, 182, 183, 256, 144, 184, 255,
+      185, 109, 254, 186, 187, 253, 146, 188, 252, 189, 108, 251,
+      190, 191, 250, 147, 192, 249, 193, 86, 248, 194, 195, 247,
+      142, 196, 246, 197, 92, 245, 198, 199, 244, 141, 200, 243,
+      201, 84, 242, 202, 203, 241, 137, 204, 240, 205, 91, 239,
+      206, 207, 238, 136, 208, 237, 209, 100, 236, 210, 211, 235,
+      129, 212, 234, 213, 95, 233, 214, 215, 232, 130, 216, 231,
+      217, 93, 230, 127, 220, 228, 221, 99, 227, 222, 223, 226,
+      123, 224, 225, 225, 80, 222, 151, 222, 55, 15, 225, 151,
+      226, 46, 142, 111, 142, 19, 55, 226, 111, 227, 13, 102,
+      223, 102, 46, 80, 227, 223, 228, 79, 218, 150, 218, 54,
+      16, 228, 150, 229, 41, 137, 230, 9, 97, 79, 230, 219,
+      231, 78, 214, 160, 214, 64, 22, 231, 160, 232, 40, 136,
+      120, 136, 23, 64, 232, 120, 233, 11, 96, 215, 96, 40,
+      78, 233, 215, 234, 77, 210, 159, 210, 63, 21, 234, 159,
+      235, 45, 141, 119, 141, 24, 63, 235, 119, 236, 14, 101,
+      211, 101, 45, 77, 236, 211, 237, 76, 206, 158, 206, 62,
+      23, 237, 158, 238, 56, 112, 118, 112, 20, 62, 238, 118,
+      239, 6, 152, 207, 152, 56, 76, 239, 207, 240, 75, 202,
+      149, 202, 53, 18, 240, 149, 241, 49, 105, 109, 105, 17,
+      53, 241, 109, 242, 2, 145, 203, 145, 49, 75, 242, 203,
+      243, 74, 198, 157, 198, 61, 24, 243, 157, 244, 34, 130,
+      117, 130, 22, 61, 244, 117, 245, 8, 90, 199, 90, 34,
+      74, 245, 199, 246, 73, 194, 148, 194, 52, 19, 246, 148,
+      247, 31, 127, 108, 127, 16, 52, 247, 108, 248, 5, 87,
+      195, 87, 31, 73, 248, 195, 249, 72, 190, 14, 249, 132,
+      250, 48, 144, 92, 144, 8, 251, 16, 104, 191, 104, 48,
+      72, 251, 191, 252, 71, 186, 131, 186, 35, 11, 252, 131,
+      253, 32, 88, 91, 88, 6, 35, 253, 91, 254, 17, 128,
+      187, 128, 32, 71, 254, 187, 255, 70, 182, 135, 182, 39,
+      8, 255, 135, 256, 50, 146, 95, 146, 11, 39, 256, 95,
+      257, 18, 106, 183, 106, 50, 70, 257, 183, 258, 69, 178,
+      140, 178, 44, 7, 258, 140, 259, 51, 147, 100, 147, 14,
+      44, 259, 100, 260, 19, 107, 179, 107, 51, 69, 260, 179,
+      261, 68, 174, 98, 174, 42, 12, 261, 98, 262, 58, 154,
+      138, 154, 4, 42, 262, 138, 263, 22, 114, 175, 114, 58,
+      68, 263, 175, 264, 67, 170, 94, 170, 38, 10, 264, 94,
+      265, 25, 81, 134, 81, 0, 38, 265, 134, 266, 20, 121,
+      171, 121, 25, 67, 266, 171, 267, 66, 166, 82, 166, 26,
+      1, 267, 82, 268, 60, 156, 122, 156, 12, 26, 268, 122,
+      269, 24, 116, 167, 116, 60, 66, 269, 167, 85, 162, 29,
+      4, 270, 85, 271, 59, 155, 125, 155, 10, 29, 271, 125,
+      272, 23, 115, 163, 115, 59, 65, 272, 163, 273, 64, 161,
+      164, 161, 65, 58, 273, 164, 274, 63, 165, 168, 165, 66,
+      57, 274, 168, 275, 62, 169, 172, 169, 67, 59, 275, 172,
+      276, 61, 173, 176, 173, 68, 60, 276, 176, 277, 55, 177,
+      180, 177, 69, 47, 277, 180, 278, 54, 181, 184, 181, 70,
+      48, 278, 184, 279, 53, 185, 188, 185, 71, 50, 279, 188,
+      280, 52, 189, 192, 189, 72, 51, 280, 192, 281, 30, 193,
+      196, 193, 73, 46, 281, 196, 282, 36, 197, 200, 197, 74,
+      45, 282, 200, 283, 28, 201, 204, 201, 75, 41, 283, 204,
+      284, 35, 205, 208, 205, 76, 40, 284, 208, 285, 44, 209,
+      212, 209, 77, 33, 285, 212, 216, 213, 78, 34, 286, 216,
+      287, 37, 217, 220, 217, 79, 31, 287, 220, 288, 43, 221,
+      224, 221, 80, 27, 288, 224, 83, 3, 139, 87, 5, 133,
+      90, 8, 135, 89, 7, 140, 96, 11, 131, 97, 9, 124,
+      101, 14, 132, 102, 13, 126, 107, 19, 148, 106, 18, 149,
+      104, 16, 150, 103, 15, 151, 116, 24, 157, 113, 21, 159,
+      114, 22, 160, 161, 64, 120, 162, 65, 163, 154, 58, 164,
+      165, 63, 119, 166, 66, 167, 153, 57, 168, 169, 62, 118,
+      170, 67, 171, 155, 59, 172, 173, 61, 117, 174, 68, 175,
+      156, 60, 176, 177, 55, 111, 178, 69, 179, 143, 47, 180,
+      181, 54, 110, 182, 70, 183, 144, 48, 184, 185, 53, 109,
+      186, 71, 187, 146, 50, 188, 189, 52, 108, 190, 72, 191,
+      147, 51, 192, 193, 30, 86, 194, 73, 195, 142, 46, 196,
+      197, 36, 92, 198, 74, 199, 141, 45, 200, 201, 28, 84,
+      202, 75, 203, 205, 35, 91, 206, 76, 207, 136, 40, 208,
+      209, 44, 100, 210, 77, 211, 129, 33, 212, 213, 39, 95,
+      214, 78, 215, 130, 34, 216, 217, 37, 93, 218, 79, 219,
+      127, 31, 220, 221, 43, 99, 222, 80, 223, 123, 27, 224,
+      225, 224, 80, 151, 225, 222, 15, 123, 225, 226, 223, 46,
+      111, 226, 142, 55, 222, 226, 227, 99, 13, 223, 227, 102,
+      80, 221, 227, 228, 220, 79, 150, 228, 218, 16, 127, 228,
+      229, 219, 41, 110, 229, 137, 54, 218, 229, 230, 93, 9,
+      219, 230, 97, 79, 217, 230, 231, 216, 78, 160, 231, 214,
+      22, 130, 231, 232, 215, 40, 120, 232, 136, 64, 214, 232,
+      233, 95, 11, 215, 233, 96, 78, 213, 233, 234, 212, 77,
+      159, 234, 210, 21, 129, 234, 235, 211, 45, 119, 235, 141,
+      63, 210, 235, 236, 100, 14, 211, 236, 101, 77, 209, 236,
+      237, 208, 76, 158, 237, 206, 23, 136, 237, 238, 207, 56,
+      118, 238, 112, 62, 206, 238, 239, 91, 6, 207, 239, 152,
+      76, 205, 239, 240, 204, 75, 149, 240, 202, 18, 137, 240,
+      241, 203, 49, 109, 241, 105, 53, 202, 241, 242, 84, 2,
+      203, 242, 145, 75, 201, 242, 243, 200, 74, 157, 243, 198,
+      24, 141, 243, 244, 199, 34, 117, 244, 130, 61, 198, 244,
+      245, 92, 8, 199, 245, 90, 74, 197, 245, 246, 196, 73,
+      148, 246, 194, 19, 142, 246, 247, 195, 31, 108, 247, 127,
+      52, 194, 247, 248, 86, 5, 195, 248, 87, 73, 193, 248,
+      249, 192, 72, 132, 249, 190, 14, 147, 249, 250, 191, 48,
+      92, 250, 144, 251, 108, 16, 191, 251, 104, 72, 189, 251,
+      252, 188, 71, 131, 252, 186, 11, 146, 252, 253, 187, 32,
+      91, 253, 88, 35, 186, 253, 254, 109, 17, 187, 254, 128,
+      71, 185, 254, 255, 184, 70, 135, 255, 182, 8, 144, 255,
+      256, 183, 50, 95, 256, 146, 39, 182, 256, 257, 110, 18,
+      183, 257, 106, 70, 181, 257, 258, 180, 69, 140, 258, 178,
+      7, 143, 258, 259, 179, 51, 100, 259, 147, 44, 178, 259,
+      260, 111, 19, 179, 260, 107, 69, 177, 260, 261, 176, 68,
+      98, 261, 174, 12, 156, 261, 262, 175, 58, 138, 262, 154,
+      42, 174, 262, 263, 117, 22, 175, 263, 114, 68, 173, 263,
+      264, 172, 67, 94, 264, 170, 10, 155, 264, 265, 171, 25,
+      134, 265, 81, 38, 170, 265, 266, 118, 20, 171, 266, 121,
+      67, 169, 266, 267, 168, 66, 82, 267, 166, 1, 153, 267,
+      268, 167, 60, 122, 268, 156, 26, 166, 268, 269, 119, 24,
+      167, 269, 116, 66, 165, 269, 270, 164, 65, 85, 270, 162,
+      4, 154, 270, 271, 163, 59, 125, 271, 155, 29, 162, 271,
+      272, 120, 23, 273, 160, 64, 58, 114, 273, 274, 159, 63,
+      168, 274, 165, 57, 113, 274, 275, 158, 62, 172, 275, 169,
+      59, 115, 275, 276, 157, 61, 176, 276, 173, 60, 116, 276,
+      277, 151, 55, 180, 277, 177, 47, 103, 277, 278, 150, 54,
+      184, 278, 181, 48, 104, 278, 279, 149, 53, 188, 279, 185,
+      50, 106, 279, 280, 148, 52, 192, 280, 189, 51, 107, 280,
+      281, 126, 30, 196, 281, 193, 46, 102, 281, 200, 282, 197,
+      45, 101, 282, 283, 124, 28, 204, 283, 201, 41, 97, 283,
+      284, 131, 35, 208, 284, 205, 40, 96, 284, 285, 140, 44,
+      212, 285, 209, 33, 89, 285, 286, 135, 39, 216, 286, 213,
+      287, 133, 37, 220, 287, 217, 31, 87, 287, 288, 139, 43,
+      224, 288, 221, 27, 83, 288
+   };
+
+   // narrow_triangles.obj
+   constexpr float m_narrow_triangles_obj_vertex[] =
+   {
+      0.0481560007f, 8.09999983e-05f, -0.00649200007f, 0.134145007f, 8.09999983e-05f, 0.0127579998f,
+      0.195296004f, 8.09999983e-05f, 0.0187379997f, 0.507445991f, 8.09999983e-05f, 0.0187379997f,
+      -0.0859339982f, 8.09999983e-05f, -0.00279200007f, -0.025285f, 8.09999983e-05f, 0.025618f,
+      0.0455060005f, 8.09999983e-05f, 0.0394380018f, 0.107084997f, 8.09999983e-05f, 0.0440480001f,
+      0.427576005f, 8.09999983e-05f, 0.0440480001f, 0.0685459971f, 8.09999983e-05f, 0.0315679982f,
+      0.0610160008f, 8.09999983e-05f, 0.0341380015f, 0.122994997f, 8.09999983e-05f, 0.0394879989f,
+      0.130715996f, 8.09999983e-05f, 0.0372680016f, 0.0602959991f, 8.09999983e-05f, 0.0343879983f,
+      0.122256003f, 8.09999983e-05f, 0.039698001f, 0.441305012f, 8.09999983e-05f, 0.039698001f,
+      0.441976011f, 8.09999983e-05f, 0.0394879989f, 0.44897601f, 8.09999983e-05f, 0.0372680016f,
+      -0.0690350011f, 8.09999983e-05f, -0.0181920007f, -0.0745539963f, 8.09999983e-05f, -0.0131519996f,
+      -0.0114749996f, 8.09999983e-05f, 0.0180980004f, -0.0047749998f, 8.09999983e-05f, 0.0144379996f,
+      -0.0750840008f, 8.09999983e-05f, -0.0126820002f, -0.0121149998f, 8.09999983e-05f, 0.0184480008f,
+      0.0596950017f, 8.09999983e-05f, 0.0345880017f, 0.121645004f, 8.09999983e-05f, 0.0398779996f,
+      0.440755993f, 8.09999983e-05f, 0.0398779996f, -0.0755250007f, 8.09999983e-05f, -0.0122819999f,
+      -0.0126449997f, 8.09999983e-05f, 0.0187379997f, 0.089606002f, 8.09999983e-05f, 0.0243679993f,
+      0.152306005f, 8.09999983e-05f, 0.0310779996f, 0.468515009f, 8.09999983e-05f, 0.0310779996f,
+      -0.0535850003f, 8.09999983e-05f, -0.0322620012f, 0.013975f, 8.09999983e-05f, 0.00423800014f
+   };
+   constexpr int m_narrow_triangles_obj_faceStart[] =
+   {
+      0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33,
+      36, 39, 42, 45, 48, 51, 54, 57, 60, 63, 66, 69,
+      72, 75, 78, 81, 84, 87, 90, 93, 96, 99, 102, 105,
+      108, 111, 114, 117, 120, 123, 126, 129, 132, 135, 138
+   };
+   constexpr int m_narrow_triangles_obj_faceIndex[] =
+   {
+      9, 10, 11, 9, 11, 12, 10, 13, 14, 10, 14, 11,
+      11, 14, 15, 11, 15, 16, 12, 11, 16, 12, 16, 17,
+      18, 19, 20, 18, 20, 21, 19, 22, 23, 19, 23, 20,
+      20, 23, 13, 20, 13, 10, 21, 20, 10, 21, 10, 9,
+      13, 24, 25, 13, 25, 14, 24, 6, 7, 24, 7, 25,
+      25, 7, 8, 25, 8, 26, 14, 25, 26, 14, 26, 15,
+      22, 27, 28, 22, 28, 23, 27, 4, 5, 27, 5, 28,
+      28, 5, 6, 28, 6, 24, 23, 28, 24, 23, 24, 13,
+      1, 29, 30, 1, 30, 2, 29, 9, 12, 29, 12, 30,
+      30, 12, 17, 30, 17, 31, 2, 30, 31, 2, 31, 3,
+      32, 18, 21, 32, 21, 33, 33, 21, 9, 33, 9, 29,
+      0, 33, 29, 0, 29, 1
+   };
+
+   // non_convex_quad.obj
+   constexpr float m_non_convex_quad_obj_vertex[] =
+   {
+      -1.0f, 0.0f, 1.0f, -0.594552994f, 0.0f, 0.621047974f,
+      -0.672472f, 0.0f, 0.566437006f, -0.672055006f, 0.0f, 0.645608008f
+   };
+   constexpr int m_non_convex_quad_obj_faceStart[] =
+   {
+      0, 4
+   };
+   constexpr int m_non_convex_quad_obj_faceIndex[] =
+   {
+      0, 1, 3, 2
+   };
+
+   // plate_crash.obj
+   constexpr float m_plate_crash_obj_vertex[] =
+   {
+      19.4228992f, 0.232299998f, -45.9019012f, 1.75253999f, 0.348450005f, -35.5838013f,
+      19.5235004f, 0.348450005f, -45.8437996f, 1.65195f, 0.232299998f, -35.6417999f,
+      27.2308998f, 0.348450005f, -20.8738003f, 27.2308998f, 0.348450005f, -41.394001f,
+      27.3314991f, 0.0f, -41.3358994f, 19.4228992f, 0.0f, -45.9019012f,
+      27.3314991f, 0.232299998f, -41.3358994f, 1.71068001f, 0.0f, -35.6758003f,
+      1.65195f, 0.0f, -35.6417999f, 27.3314991f, 0.232299998f, -20.8157997f,
+      27.3314991f, 0.0f, -20.8157997f
+   };
+   constexpr int m_plate_crash_obj_faceStart[] =
+   {
+      0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33,
+      36, 39, 42, 45, 48, 51, 54, 57, 60, 63, 66
+   };
+   constexpr int m_plate_crash_obj_faceIndex[] =
+   {
+      0, 1, 2, 1, 0, 3, 2, 4, 5, 4, 2, 1,
+      0, 6, 7, 6, 0, 8, 8, 0, 2, 8, 2, 5,
+      3, 9, 10, 9, 3, 7, 8, 4, 11, 6, 11, 12,
+      7, 3, 0, 11, 6, 8, 11, 10, 12, 3, 11, 4,
+      10, 11, 3, 3, 4, 1, 4, 8, 5, 12, 7, 6,
+      7, 12, 10, 7, 10, 9
+   };
+
+   // poly/L-plane.obj
+   constexpr float m_poly_L_plane_obj_vertex[] =
+   {
+      -0.83257401f, 0.546465993f, 0.973356009f, 1.16742599f, 0.546465993f, 0.973356009f,
+      -0.83257401f, 0.546465993f, -1.02664399f, 1.16742599f, 0.546465993f, -1.02664399f,
+      -0.83257401f, 0.546465993f, -0.0266440008f, 0.167426005f, 0.546465993f, 0.973356009f,
+      1.16742599f, 0.546465993f, -0.0266440008f, 0.167426005f, 0.546465993f, -1.02664399f,
+      0.167426005f, 0.546465993f, -0.0266440008f, -0.83257401f, 0.546465993f, 0.473356009f,
+      1.16742599f, 0.546465993f, -0.526643991f, -0.83257401f, 0.546465993f, -0.526643991f,
+      1.16742599f, 0.546465993f, 0.473356009f, 0.167426005f, 0.546465993f, -0.526643991f,
+      0.167426005f, 0.546465993f, 0.473356009f, 0.91742599f, 0.546465993f, 0.973356009f,
+      -0.0825740024f, 0.546465993f, 0.973356009f, -0.58257401f, 0.546465993f, -0.0266440008f,
+      0.41742599f, 0.546465993f, -0.0266440008f, -0.0825740024f, 0.546465993f, -1.02664399f,
+      0.91742599f, 0.546465993f, -1.02664399f, 0.41742599f, 0.546465993f, 0.473356009f,
+      0.91742599f, 0.546465993f, 0.473356009f, -0.58257401f, 0.546465993f, 0.473356009f,
+      -0.0825740024f, 0.546465993f, 0.473356009f, -0.58257401f, 0.546465993f, -0.526643991f,
+      -0.0825740024f, 0.546465993f, -0.526643991f, 0.41742599f, 0.546465993f, -0.526643991f,
+      0.91742599f, 0.546465993f, -0.526643991f, 0.91742599f, 0.546465993f, -0.276643991f,
+      0.41742599f, 0.546465993f, -0.276643991f, 0.41742599f, 0.546465993f, -0.776643991f,
+      -0.0825740024f, 0.546465993f, -0.276643991f, -0.58257401f, 0.546465993f, -0.276643991f,
+      -0.58257401f, 0.546465993f, -0.776643991f, -0.0825740024f, 0.546465993f, 0.723356009f,
+      -0.58257401f, 0.546465993f, 0.723356009f, -0.58257401f, 0.546465993f, 0.223355994f,
+      0.91742599f, 0.546465993f, 0.723356009f, 0.41742599f, 0.546465993f, 0.723356009f,
+      0.41742599f, 0.546465993f, 0.223355994f, 0.91742599f, 0.546465993f, 0.223355994f,
+      -0.0825740024f, 0.546465993f, 0.223355994f, -0.0825740024f, 0.546465993f, -0.776643991f,
+      0.91742599f, 0.546465993f, -0.776643991f
+   };
+   constexpr int m_poly_L_plane_obj_faceStart[] =
+   {
+      0, 7, 13, 20, 27, 33, 40, 46, 52, 58, 65, 72,
+      78, 84, 91, 98, 104
+   };
+   constexpr int m_poly_L_plane_obj_faceIndex[] =
+   {
+      25, 26, 13, 7, 19, 43, 34, 25, 34, 43, 19, 2,
+      11, 25, 11, 4, 17, 33, 32, 26, 8, 18, 30, 29,
+      28, 27, 13, 28, 29, 30, 18, 6, 10, 20, 44, 31,
+      27, 28, 10, 3, 27, 31, 44, 20, 7, 13, 26, 32,
+      33, 17, 8, 13, 24, 14, 8, 17, 37, 42, 4, 9,
+      23, 24, 42, 37, 17, 23, 36, 35, 16, 5, 14, 24,
+      23, 9, 0, 16, 35, 36, 14, 5, 15, 38, 39, 21,
+      1, 12, 22, 21, 39, 38, 15, 8, 14, 21, 22, 41,
+      40, 18, 12, 6, 18, 40, 41, 22
+   };
+
+   // poly/mixedFaringPart.obj
+   constexpr float m_poly_mixedFaringPart_obj_vertex[] =
+   {
+      1.08097005f, 3.64289999f, -0.395058006f, 1.05094004f, 3.73096991f, -0.153162003f,
+      1.23529994f, 3.56997991f, 0.74831301f, 1.95430005f, 3.64609003f, -0.0551289991f,
+      1.05186999f, 3.83837008f, 0.0577379987f, 1.78497005f, 3.51976991f, -0.706746995f,
+      1.25730002f, 3.42102003f, -0.77532202f, 1.82911003f, 3.78872991f, -0.626142025f,
+      1.64098001f, 3.07281995f, -0.862738013f, 1.04278004f, 3.38752007f, 0.165190995f,
+      1.92633998f, 3.63917994f, 0.336764008f, 1.04797006f, 3.60095f, 0.0765779987f,
+      1.81480002f, 3.3715601f, -0.68125701f, 1.54442f, 3.60970998f, -0.866429985f,
+      1.94046998f, 3.52278996f, -0.247137994f, 1.82014f, 3.65830994f, 0.655627012f,
+      1.65651f, 3.53171992f, 0.839128971f, 1.88741004f, 3.25252008f, 0.548002005f,
+      1.96937001f, 3.30626988f, -0.0286100004f, 1.97368002f, 3.1661799f, -0.163481995f,
+      1.90813005f, 3.51453996f, -0.428880006f, 1.11185002f, 3.33925009f, 0.537594974f,
+      1.63206995f, 3.42038989f, 0.858228981f, 1.47906995f, 3.86099005f, -0.864194989f,
+      1.04887998f, 3.43806005f, -0.178819999f, 1.27212f, 3.92571998f, 0.750087976f,
+      1.15007997f, 3.61348009f, -0.596042991f, 1.56359005f, 3.95035005f, -0.820635021f,
+      1.14545f, 3.85952997f, 0.578679025f, 1.75189996f, 3.13737988f, -0.780359983f,
+      1.84483004f, 3.2771101f, -0.645316005f, 1.56974006f, 3.83298993f, 0.866293013f,
+      1.94335997f, 3.93052006f, 0.191058993f, 1.95586002f, 3.52129006f, 0.146153003f,
+      1.92376995f, 3.46547008f, 0.36807701f, 1.83533001f, 3.94794011f, 0.623755991f,
+      1.95067f, 3.94167995f, -0.0338479988f, 1.36943996f, 3.53127003f, 0.857813001f,
+      1.19497001f, 3.8376801f, 0.677278996f, 1.88639998f, 3.27303004f, -0.553404987f,
+      1.04857004f, 3.6087501f, -0.131763995f, 1.05802f, 3.58668995f, 0.240645006f,
+      1.90603995f, 3.66957998f, -0.407290012f, 1.95275998f, 3.76780009f, -0.0228579994f,
+      1.29384995f, 3.18966007f, -0.815039992f, 1.18449998f, 3.37335992f, -0.68175298f,
+      1.21437001f, 3.93091011f, -0.684225023f, 1.74417996f, 3.60292006f, -0.755742013f,
+      1.39491999f, 3.44751f, -0.86500901f, 1.08928001f, 3.95028996f, 0.379366994f,
+      1.09976995f, 3.49361992f, 0.479607999f, 1.06217003f, 3.86497998f, -0.247897997f,
+      1.12092996f, 3.77339005f, -0.525566995f, 1.90769994f, 3.77722001f, -0.39735201f,
+      1.85485995f, 3.94202995f, -0.552093029f, 1.06912005f, 3.80427003f, 0.295064002f,
+      1.92051005f, 3.23690009f, 0.438237995f, 1.07945001f, 3.94329f, -0.328747988f,
+      1.03586996f, 3.1984899f, -0.220789999f, 1.80190003f, 3.88527989f, 0.690066993f,
+      1.81194997f, 3.44243002f, 0.68848902f, 1.28792f, 3.71462989f, -0.787256002f,
+      1.24764001f, 3.37656999f, 0.771295011f, 1.07251f, 3.55913997f, 0.346756011f,
+      1.92012f, 3.41214991f, -0.395498008f, 1.10874999f, 3.26146007f, -0.531292021f,
+      1.39219999f, 3.69493008f, 0.861280024f, 1.91084003f, 3.87839007f, 0.410807997f,
+      1.94482005f, 3.30861998f, -0.297710001f, 1.59445f, 3.29267001f, -0.865489006f,
+      1.03047001f, 3.27544999f, -0.0518889986f, 1.72149003f, 3.93734002f, 0.772284985f,
+      1.60828996f, 3.46389008f, -0.851225019f, 1.07757998f, 3.50728989f, -0.392675012f,
+      1.06462002f, 3.60593009f, -0.307074994f, 1.04945004f, 3.7634201f, -0.0441629998f,
+      1.05317998f, 3.86292005f, -0.134536996f, 1.17215002f, 3.55449009f, 0.653936028f,
+      1.19843996f, 3.4553299f, 0.705685019f, 1.95476997f, 3.61984992f, 0.0742660016f,
+      1.95925999f, 3.52470994f, -0.0299689993f, 1.05797005f, 3.94379997f, 0.130939007f,
+      1.05418003f, 3.94123006f, -0.0322810002f, 1.84283996f, 3.59629989f, -0.606474996f,
+      1.84147f, 3.47252011f, -0.624834001f, 1.24953997f, 3.56511998f, -0.757658005f,
+      1.33369005f, 3.53688002f, -0.828194022f, 1.75339997f, 3.81009007f, -0.735915005f,
+      1.79819f, 3.8950901f, -0.668242991f, 1.58127999f, 3.17593002f, -0.877583027f,
+      1.67586005f, 3.17446995f, -0.836669981f, 1.03638995f, 3.35748005f, 0.0430449992f,
+      1.03085995f, 3.26598001f, 0.125805005f, 1.89980996f, 3.68107009f, 0.454569012f,
+      1.90605998f, 3.56996012f, 0.435377985f, 1.04296994f, 3.47791004f, 0.0262679998f,
+      1.04861999f, 3.50693989f, 0.147127002f, 1.76374996f, 3.31173992f, -0.75700599f,
+      1.75509f, 3.4166801f, -0.758422017f, 1.63758004f, 3.68383002f, -0.837330997f,
+      1.64972997f, 3.57571006f, -0.831532001f, 1.94821f, 3.6092701f, -0.170579001f,
+      1.95431006f, 3.49267006f, -0.144024998f, 1.4892f, 3.11051989f, -0.890806019f,
+      1.55430996f, 3.00355005f, -0.882847011f, 1.86812997f, 3.57791996f, 0.55270803f,
+      1.86294997f, 3.68727994f, 0.566439986f, 1.74302006f, 3.45654011f, 0.775920987f,
+      1.72818005f, 3.58979988f, 0.786652029f, 1.88085997f, 3.37704992f, 0.541767001f,
+      1.84502006f, 3.32788992f, 0.635163009f, 1.54183996f, 3.39235997f, 0.889177978f,
+      1.47732997f, 3.27069998f, 0.888871014f, 1.97075999f, 3.24945998f, 0.0718389973f,
+      1.97842002f, 3.17694998f, -0.0478340015f, 1.95801997f, 3.21794009f, -0.254132003f,
+      1.96517003f, 3.29244995f, -0.145153001f, 1.95682001f, 3.10932994f, -0.326775998f,
+      1.88411999f, 3.47071004f, -0.526471019f, 1.88677001f, 3.59379005f, -0.502659023f,
+      1.15376997f, 3.37596011f, 0.631613016f, 1.12980998f, 3.46772003f, 0.575302005f,
+      1.04312003f, 3.10893011f, -0.318309009f, 1.06946003f, 3.21831989f, -0.411913991f,
+      1.7198f, 3.3513701f, 0.800728977f, 1.57731998f, 3.78307009f, -0.856537998f,
+      1.47911f, 3.71179008f, -0.878553987f, 1.05504f, 3.53506994f, -0.232399002f,
+      1.06426001f, 3.42990994f, -0.312491f, 1.93383002f, 3.10650992f, -0.434579015f,
+      1.31252003f, 3.78930998f, 0.80943203f, 1.38451004f, 3.92457008f, 0.831055999f,
+      1.1085f, 3.50837994f, -0.499974012f, 1.11014998f, 3.64640999f, -0.496632993f,
+      1.70069003f, 3.95305991f, -0.746684015f, 1.65785003f, 3.86523008f, -0.806784987f,
+      1.10442996f, 3.77701998f, 0.473857999f, 1.12486005f, 3.71253991f, 0.548898995f,
+      1.80270004f, 3.07088995f, -0.725031972f, 1.72551f, 3.03502989f, -0.807803988f,
+      1.84359002f, 3.15963006f, -0.663241982f, 1.79618001f, 3.2220099f, -0.723866999f,
+      1.59193003f, 3.66423988f, 0.872313976f, 1.66902006f, 3.72375011f, 0.825800002f,
+      1.92636001f, 3.93113995f, 0.321545988f, 1.94208002f, 3.80497003f, 0.234053999f,
+      1.96160996f, 3.37257004f, 0.142555997f, 1.96276999f, 3.4282701f, 0.0382580012f,
+      1.94777f, 3.38602996f, 0.259773999f, 1.94219005f, 3.53373003f, 0.26413399f,
+      1.87100005f, 3.85526991f, 0.550628006f, 1.87966001f, 3.94724989f, 0.519764006f,
+      1.94896996f, 3.83800006f, -0.123346001f, 1.94309998f, 3.94283009f, -0.173112005f,
+      1.40050995f, 3.36724997f, 0.876985013f, 1.46791995f, 3.49241996f, 0.884917974f,
+      1.16803002f, 3.68808007f, 0.643732011f, 1.23380005f, 3.70940995f, 0.74029398f,
+      1.91542006f, 3.20940995f, -0.470319003f, 1.88716996f, 3.15405011f, -0.571732998f,
+      1.04395998f, 3.51453996f, -0.0741500035f, 1.04711998f, 3.63797998f, -0.0232330002f,
+      1.05190003f, 3.35760999f, 0.275781989f, 1.03869998f, 3.23538995f, 0.238442004f,
+      1.06686997f, 3.69655991f, 0.288572013f, 1.05537999f, 3.67880988f, 0.171635002f,
+      1.93227994f, 3.67413998f, -0.267399013f, 1.92329001f, 3.58418012f, -0.338615f,
+      1.95196998f, 3.87220001f, 0.0672039986f, 1.95179999f, 3.74645996f, 0.110514998f,
+      1.39691997f, 3.17758989f, -0.870404005f, 1.33273995f, 3.05114007f, -0.851191998f,
+      1.21061003f, 3.13216996f, -0.736481011f, 1.24522996f, 2.9916501f, -0.779208004f,
+      1.13169003f, 3.40714002f, -0.566798985f, 1.17857003f, 3.51785994f, -0.662178993f,
+      1.31054997f, 3.9277401f, -0.780903995f, 1.23187006f, 3.80203009f, -0.724247992f,
+      1.73285997f, 3.70815992f, -0.763439f, 1.80685997f, 3.68247008f, -0.660228014f,
+      1.41869998f, 3.31709003f, -0.873584986f, 1.31681001f, 3.33242011f, -0.822996974f,
+      1.09252f, 3.85818005f, 0.41486901f, 1.13063002f, 3.94757009f, 0.518024981f,
+      1.07222998f, 3.44949007f, 0.363828987f, 1.08352995f, 3.3652699f, 0.439969003f,
+      1.07405996f, 3.76947999f, -0.344493002f, 1.05918002f, 3.73245001f, -0.255957007f,
+      1.14842999f, 3.87457991f, -0.585411012f, 1.16500998f, 3.7481401f, -0.628512025f,
+      1.92689002f, 3.88372993f, -0.303903013f, 1.93457997f, 3.78116012f, -0.252436996f,
+      1.90321004f, 3.94090009f, -0.412815005f, 1.88046002f, 3.83440995f, -0.506232023f,
+      1.06526005f, 3.89408994f, 0.250510007f, 1.05695999f, 3.79080009f, 0.173724994f,
+      1.94079995f, 3.28069997f, 0.324317992f, 1.91485f, 3.36051989f, 0.428856999f,
+      1.11442006f, 3.94368005f, -0.475374997f, 1.09274995f, 3.84282994f, -0.422381014f,
+      1.04197001f, 3.31939006f, -0.173335999f, 1.05786002f, 3.30706f, -0.311051995f,
+      1.79498005f, 3.77133989f, 0.705026984f, 1.84325004f, 3.79374003f, 0.617096007f,
+      1.85185003f, 3.48995996f, 0.598316014f, 1.79970002f, 3.57149005f, 0.698759019f,
+      1.37129998f, 3.8383801f, -0.838298023f, 1.37514997f, 3.6844101f, -0.852940977f,
+      1.31976998f, 3.32723999f, 0.836667001f, 1.29126f, 3.4862299f, 0.813983977f,
+      1.09895003f, 3.60485005f, 0.463407993f, 1.08275998f, 3.67203999f, 0.39170599f,
+      1.92521f, 3.30291009f, -0.406094015f, 1.89901996f, 3.36567998f, -0.490981996f,
+      1.16077006f, 3.2272799f, -0.650867999f, 1.11178005f, 3.10770011f, -0.570363998f,
+      1.49356997f, 3.65295005f, 0.887153983f, 1.46708f, 3.82471991f, 0.876616001f,
+      1.16083002f, 3.25963998f, 0.656867981f, 1.90217996f, 3.78683996f, 0.447212011f,
+      1.92786002f, 3.75395989f, 0.328227013f, 1.83042002f, 3.2228601f, 0.684301019f,
+      1.93885005f, 3.41786003f, -0.28974399f, 1.95361996f, 3.38242006f, -0.192340001f,
+      1.67286003f, 3.38801003f, -0.827111006f, 1.68672001f, 3.28369999f, -0.823027015f,
+      1.02198994f, 3.15538001f, -0.0957769975f, 1.02203f, 3.18280005f, 0.0337469988f,
+      1.61942005f, 3.93284988f, 0.832939982f, 1.71537006f, 3.81847f, 0.787307024f,
+      1.52416003f, 3.36676002f, -0.881892979f, 1.50169003f, 3.49295998f, -0.877632022f
+   };
+   constexpr int m_poly_mixedFaringPart_obj_faceStart[] =
+   {
+      0, 5, 11, 16, 22, 28, 35, 41, 47, 53, 59, 65,
+      71, 77, 83, 88, 95, 101, 106, 112, 117, 125, 131, 137,
+      143, 149, 156, 162, 168, 173, 178, 182, 186, 190, 194, 198,
+      202, 206, 210, 214, 218, 222, 226, 230, 234, 238, 242, 246,
+      250, 254, 258, 262, 266, 270, 274, 278, 282, 286, 290, 294,
+      298, 302, 306, 310, 314, 318, 322, 326, 330, 334, 338, 342,
+      346, 350, 354, 358, 362, 366, 370, 374, 378, 382, 386, 390,
+      394, 398, 402, 406, 410, 414, 418, 422, 426, 430, 434, 438,
+      442, 446, 450, 454, 458, 462, 466, 470, 474, 478, 482, 486,
+      490, 494, 498, 502, 506, 510, 514, 518, 522, 526, 530, 534,
+      538, 542, 546, 550, 554, 558, 562, 566, 570, 574, 578, 582,
+      586, 590, 594, 597, 600, 603, 606, 609, 612, 615, 618, 621,
+      624, 627, 630, 633, 636, 639, 642, 645, 648, 651, 654, 657,
+      660, 663, 666, 669, 672, 675, 678, 681, 684, 687, 690, 693,
+      696, 699, 702, 705, 708, 711, 714, 717, 720, 723, 726, 729,
+      732, 735, 738, 741, 744, 747, 750, 753, 756, 759, 762, 765,
+      768, 771, 774, 777, 780, 783, 786, 789, 792, 795, 798, 801,
+      804
+   };
+   constexpr int m_poly_mixedFaringPart_obj_faceIndex[] =
+   {
+      99, 125, 135, 87, 178, 39, 30, 12, 84, 118, 213, 150,
+      203, 106, 93, 219, 68, 115, 117, 129, 158, 212, 70, 91,
+      95, 160, 24, 200, 10, 149, 33, 79, 169, 145, 220, 72,
+      100, 47, 5, 98, 224, 45, 6, 181, 44, 172, 214, 69,
+      89, 103, 170, 180, 230, 4, 75, 161, 11, 165, 195, 152,
+      43, 3, 101, 166, 191, 177, 61, 85, 175, 26, 189, 143,
+      108, 205, 15, 202, 229, 50, 121, 77, 156, 137, 210, 52,
+      133, 0, 186, 199, 53, 42, 119, 83, 179, 7, 193, 109,
+      197, 34, 94, 105, 204, 97, 141, 29, 90, 225, 78, 120,
+      218, 120, 78, 62, 64, 20, 167, 14, 222, 110, 60, 107,
+      124, 107, 60, 110, 221, 63, 41, 96, 9, 162, 184, 48,
+      86, 207, 126, 13, 231, 37, 66, 130, 157, 2, 209, 155,
+      111, 22, 16, 142, 216, 128, 73, 132, 174, 65, 123, 201,
+      102, 80, 147, 18, 116, 223, 146, 148, 196, 148, 146, 113,
+      136, 182, 55, 164, 211, 74, 127, 40, 1, 187, 127, 74,
+      73, 128, 186, 0, 74, 187, 132, 73, 0, 133, 76, 75,
+      4, 82, 1, 76, 51, 187, 75, 1, 40, 161, 120, 78,
+      77, 121, 2, 78, 62, 209, 156, 77, 2, 157, 80, 79,
+      33, 147, 101, 3, 80, 102, 79, 3, 43, 169, 194, 81,
+      4, 195, 118, 84, 83, 119, 5, 84, 12, 98, 83, 5,
+      47, 179, 86, 85, 61, 207, 6, 86, 48, 181, 85, 6,
+      45, 175, 134, 88, 87, 135, 7, 88, 54, 193, 178, 87,
+      7, 179, 90, 89, 69, 225, 8, 90, 29, 139, 103, 89,
+      8, 104, 92, 91, 70, 227, 162, 9, 92, 163, 95, 91,
+      9, 96, 105, 94, 93, 106, 10, 94, 34, 149, 219, 93,
+      10, 220, 11, 96, 41, 165, 160, 95, 11, 161, 224, 98,
+      97, 225, 97, 12, 30, 141, 47, 100, 99, 178, 13, 100,
+      72, 231, 125, 99, 13, 126, 222, 14, 102, 223, 166, 101,
+      14, 167, 170, 103, 170, 171, 202, 15, 106, 203, 204, 105,
+      15, 205, 108, 107, 60, 205, 142, 16, 108, 143, 107, 16,
+      22, 124, 60, 110, 109, 204, 109, 17, 56, 197, 154, 112,
+      111, 155, 18, 114, 19, 116, 146, 113, 18, 147, 116, 115,
+      68, 223, 20, 119, 42, 167, 118, 20, 64, 213, 21, 121,
+      50, 185, 123, 122, 58, 201, 65, 215, 65, 123, 206, 23,
+      126, 207, 125, 23, 27, 135, 200, 24, 128, 201, 40, 127,
+      24, 160, 158, 129, 158, 159, 131, 130, 66, 217, 130, 25,
+      38, 157, 26, 133, 52, 189, 174, 132, 26, 175, 210, 137,
+      136, 211, 38, 28, 137, 156, 182, 136, 28, 183, 140, 138,
+      29, 141, 140, 30, 39, 159, 228, 31, 143, 229, 216, 142,
+      31, 217, 145, 144, 67, 220, 168, 32, 145, 169, 148, 146,
+      33, 149, 196, 148, 34, 197, 67, 151, 150, 219, 150, 35,
+      59, 203, 190, 153, 152, 191, 43, 152, 36, 168, 66, 37,
+      155, 216, 208, 154, 37, 209, 212, 158, 39, 213, 184, 162,
+      184, 185, 165, 164, 55, 195, 164, 41, 63, 211, 166, 42,
+      53, 191, 172, 44, 171, 173, 180, 170, 44, 181, 214, 172,
+      214, 215, 65, 174, 45, 214, 61, 177, 176, 206, 188, 46,
+      177, 189, 230, 180, 48, 231, 55, 182, 49, 194, 63, 184,
+      50, 210, 186, 51, 57, 199, 198, 188, 52, 199, 192, 190,
+      53, 193, 70, 200, 58, 226, 202, 59, 71, 229, 68, 212,
+      64, 222, 72, 224, 69, 230, 74, 0, 73, 76, 1, 75,
+      78, 2, 77, 80, 3, 79, 82, 4, 81, 84, 5, 83,
+      86, 6, 85, 88, 7, 87, 90, 8, 89, 92, 9, 91,
+      94, 10, 93, 96, 11, 95, 98, 12, 97, 100, 13, 99,
+      102, 14, 101, 106, 15, 105, 108, 16, 107, 110, 17, 109,
+      114, 18, 113, 116, 19, 115, 119, 20, 118, 121, 21, 120,
+      126, 23, 125, 128, 24, 127, 131, 25, 130, 133, 26, 132,
+      135, 27, 134, 137, 28, 136, 141, 30, 140, 143, 31, 142,
+      145, 32, 144, 147, 33, 146, 149, 34, 148, 151, 35, 150,
+      153, 36, 152, 155, 37, 154, 157, 38, 156, 159, 39, 158,
+      161, 40, 160, 165, 41, 164, 167, 42, 166, 169, 43, 168,
+      171, 44, 170, 175, 45, 174, 177, 46, 176, 179, 47, 178,
+      181, 48, 180, 183, 49, 182, 185, 50, 184, 187, 51, 186,
+      189, 52, 188, 191, 53, 190, 193, 54, 192, 195, 55, 194,
+      197, 56, 196, 199, 57, 198, 201, 58, 200, 203, 59, 202,
+      205, 60, 204, 207, 61, 206, 209, 62, 208, 211, 63, 210,
+      213, 64, 212, 215, 65, 214, 217, 66, 216, 220, 67, 219,
+      223, 68, 222, 225, 69, 224, 229, 71, 228, 231, 72, 230
+   };
+
+   // poly/tetris.obj
+   constexpr float m_poly_tetris_obj_vertex[] =
+   {
+      -0.149864003f, -0.00200200011f, 2.00001502f, 1.85013604f, -0.00200200011f, 2.00001502f,
+      -0.149864003f, -0.00200200011f, 1.49999996e-05f, 1.85013604f, -0.00200200011f, 1.49999996e-05f,
+      -0.149864003f, -0.00200200011f, 1.00001502f, 0.850135982f, -0.00200200011f, 2.00001502f,
+      0.850135982f, -0.00200200011f, 1.00001502f, 1.35013604f, -0.00200200011f, 2.00001502f,
+      0.350136012f, -0.00200200011f, 1.49999996e-05f, 1.35013604f, -0.00200200011f, 1.49999996e-05f,
+      0.850135982f, -0.00200200011f, 0.50001502f, 0.850135982f, -0.00200200011f, 1.50001502f,
+      0.350136012f, -0.00200200011f, 1.00001502f, 0.350136012f, -0.00200200011f, 1.50001502f,
+      0.350136012f, -0.00200200011f, 0.50001502f, 1.85013604f, -0.00200200011f, 0.250014991f,
+      0.600135982f, -0.00200200011f, 2.00001502f, 1.85013604f, -0.00200200011f, 1.25001502f,
+      0.100135997f, -0.00200200011f, 1.00001502f, 1.10013604f, -0.00200200011f, 1.00001502f,
+      1.10013604f, -0.00200200011f, 2.00001502f, -0.149864003f, -0.00200200011f, 0.250014991f,
+      0.100135997f, -0.00200200011f, 2.00001502f, 1.85013604f, -0.00200200011f, 1.75001502f,
+      0.850135982f, -0.00200200011f, 0.75001502f, 0.850135982f, -0.00200200011f, 1.75001502f,
+      0.600135982f, -0.00200200011f, 1.00001502f, 1.60013604f, -0.00200200011f, 1.00001502f,
+      1.35013604f, -0.00200200011f, 1.75001502f, 1.10013604f, -0.00200200011f, 1.50001502f,
+      1.60013604f, -0.00200200011f, 1.50001502f, 0.350136012f, -0.00200200011f, 1.25001502f,
+      0.100135997f, -0.00200200011f, 1.50001502f, 0.600135982f, -0.00200200011f, 1.50001502f,
+      0.350136012f, -0.00200200011f, 0.250014991f, 0.350136012f, -0.00200200011f, 0.75001502f,
+      0.100135997f, -0.00200200011f, 0.50001502f, 0.600135982f, -0.00200200011f, 0.50001502f,
+      1.35013604f, -0.00200200011f, 0.250014991f, 1.10013604f, -0.00200200011f, 0.50001502f,
+      1.60013604f, -0.00200200011f, 0.50001502f, 1.10013604f, -0.00200200011f, 0.250014991f,
+      0.100135997f, -0.00200200011f, 0.75001502f, 0.100135997f, -0.00200200011f, 0.250014991f,
+      0.600135982f, -0.00200200011f, 1.75001502f, 1.60013604f, -0.00200200011f, 1.75001502f,
+      1.10013604f, -0.00200200011f, 1.75001502f, 1.10013604f, -0.00200200011f, 1.25001502f,
+      1.60013604f, -0.00200200011f, 1.25001502f, 0.600135982f, -0.00200200011f, 1.25001502f,
+      0.600135982f, -0.00200200011f, 0.250014991f, 1.60013604f, -0.00200200011f, 0.250014991f
+   };
+   constexpr int m_poly_tetris_obj_faceStart[] =
+   {
+      0, 6, 15, 22, 31, 39, 47, 51, 59, 67, 74, 84,
+      92, 98, 107, 112, 118
+   };
+   constexpr int m_poly_tetris_obj_faceIndex[] =
+   {
+      17, 15, 51, 40, 27, 48, 25, 11, 6, 26, 49, 31,
+      13, 33, 44, 19, 6, 11, 29, 47, 48, 27, 2, 21,
+      43, 36, 14, 37, 50, 34, 8, 3, 9, 38, 41, 39,
+      40, 51, 15, 1, 23, 45, 30, 29, 46, 28, 7, 19,
+      27, 40, 39, 10, 24, 35, 12, 26, 6, 19, 39, 14,
+      36, 43, 21, 4, 18, 42, 35, 17, 48, 47, 29, 30,
+      45, 23, 5, 20, 7, 28, 46, 29, 11, 25, 44, 16,
+      14, 35, 24, 10, 39, 41, 50, 37, 32, 22, 16, 44,
+      33, 13, 12, 35, 42, 18, 32, 13, 31, 49, 26, 18,
+      4, 0, 22, 32, 41, 38, 9, 8, 34, 50
+   };
+
+   // poly/tetris_2.obj
+   constexpr float m_poly_tetris_2_obj_vertex[] =
+   {
+      -1.05278397f, 0.048099f, 1.45415795f, 0.947215974f, 0.048099f, 1.45415795f,
+      -1.05278397f, 0.048099f, -0.545841992f, 0.947215974f, 0.048099f, -0.545841992f,
+      -1.05278397f, 0.048099f, 0.454158008f, 0.947215974f, 0.048099f, 0.454158008f,
+      -0.0527839996f, 0.048099f, -0.545841992f, -0.0527839996f, 0.048099f, 0.454158008f,
+      0.447216004f, 0.048099f, 1.45415795f, 0.947215974f, 0.048099f, -0.0458419994f,
+      -1.05278397f, 0.048099f, -0.0458419994f, -0.552784026f, 0.048099f, 1.45415795f,
+      -0.0527839996f, 0.048099f, -0.0458419994f, -0.0527839996f, 0.048099f, 0.954158008f,
+      -0.552784026f, 0.048099f, 0.454158008f, 0.447216004f, 0.048099f, 0.454158008f,
+      0.447216004f, 0.048099f, 0.954158008f, 0.697215974f, 0.048099f, 1.45415795f,
+      -0.802784026f, 0.048099f, -0.545841992f, -1.05278397f, 0.048099f, 0.204157993f,
+      -0.302783996f, 0.048099f, 1.45415795f, -0.802784026f, 0.048099f, 0.454158008f,
+      -1.05278397f, 0.048099f, 0.704158008f, 0.697215974f, 0.048099f, -0.545841992f,
+      -0.0527839996f, 0.048099f, 0.204157993f, -0.0527839996f, 0.048099f, 1.20415795f,
+      -0.302783996f, 0.048099f, 0.454158008f, 0.697215974f, 0.048099f, 0.454158008f,
+      0.447216004f, 0.048099f, 0.704158008f, 0.447216004f, 0.048099f, 1.20415795f,
+      0.197216004f, 0.048099f, 0.954158008f, -0.552784026f, 0.048099f, 1.20415795f,
+      -0.802784026f, 0.048099f, 0.954158008f, -0.302783996f, 0.048099f, 0.954158008f,
+      -0.552784026f, 0.048099f, 0.204157993f, -0.802784026f, 0.048099f, -0.0458419994f,
+      -0.302783996f, 0.048099f, -0.0458419994f, 0.197216004f, 0.048099f, -0.0458419994f,
+      0.697215974f, 0.048099f, 0.204157993f, 0.197216004f, 0.048099f, 0.204157993f,
+      0.197216004f, 0.048099f, -0.295841992f, -0.802784026f, 0.048099f, 0.204157993f,
+      -0.802784026f, 0.048099f, -0.295841992f, -0.302783996f, 0.048099f, 1.20415795f,
+      -0.802784026f, 0.048099f, 1.20415795f, -0.802784026f, 0.048099f, 0.704158008f,
+      0.197216004f, 0.048099f, 1.20415795f, 0.697215974f, 0.048099f, 0.704158008f,
+      -0.302783996f, 0.048099f, -0.295841992f, 0.697215974f, 0.048099f, -0.295841992f
+   };
+   constexpr int m_poly_tetris_2_obj_faceStart[] =
+   {
+      0, 8, 14, 24, 30, 35, 43, 50, 58, 67, 74, 80,
+      86, 92, 100, 106, 113
+   };
+   constexpr int m_poly_tetris_2_obj_faceIndex[] =
+   {
+      28, 16, 30, 46, 29, 8, 17, 47, 37, 39, 38, 27,
+      5, 9, 19, 4, 22, 45, 21, 14, 34, 41, 35, 10,
+      14, 21, 45, 32, 33, 26, 1, 5, 27, 47, 17, 8,
+      29, 46, 30, 13, 25, 43, 20, 14, 26, 33, 13, 7,
+      24, 34, 36, 35, 41, 34, 24, 39, 37, 12, 11, 20,
+      43, 25, 13, 33, 32, 44, 31, 2, 10, 35, 36, 48,
+      42, 18, 37, 40, 49, 23, 6, 12, 12, 6, 18, 42,
+      48, 36, 23, 49, 40, 37, 9, 3, 7, 15, 28, 47,
+      27, 38, 39, 24, 7, 13, 30, 16, 28, 15, 11, 31,
+      44, 32, 45, 22, 0
+   };
+
+   // simple/cube.obj
+   constexpr float m_simple_cube_obj_vertex[] =
+   {
+      -1.0f, -0.5f, 0.5f, -1.0f, 0.5f, 0.5f,
+      -1.0f, 0.5f, -0.5f, -1.0f, -0.5f, -0.5f,
+      -0.5f, -0.5f, -1.0f, -0.5f, 0.5f, -1.0f,
+      0.5f, 0.5f, -1.0f, 0.5f, -0.5f, -1.0f,
+      1.0f, -0.5f, -0.5f, 1.0f, 0.5f, -0.5f,
+      1.0f, 0.5f, 0.5f, 1.0f, -0.5f, 0.5f,
+      0.5f, -0.5f, 1.0f, 0.5f, 0.5f, 1.0f,
+      -0.5f, 0.5f, 1.0f, -0.5f, -0.5f, 1.0f,
+      -0.5f, -1.0f, -0.5f, 0.5f, -1.0f, -0.5f,
+      0.5f, -1.0f, 0.5f, -0.5f, -1.0f, 0.5f,
+      0.5f, 1.0f, -0.5f, -0.5f, 1.0f, -0.5f,
+      -0.5f, 1.0f, 0.5f, 0.5f, 1.0f, 0.5f,
+      -1.0f, 0.0f, 0.5f, -1.0f, 0.5f, 0.0f,
+      -1.0f, 0.0f, -0.5f, -1.0f, -0.5f, 0.0f,
+      -0.5f, 0.0f, -1.0f, 0.0f, 0.5f, -1.0f,
+      0.5f, 0.0f, -1.0f, 0.0f, -0.5f, -1.0f,
+      1.0f, 0.0f, -0.5f, 1.0f, 0.5f, 0.0f,
+      1.0f, 0.0f, 0.5f, 1.0f, -0.5f, 0.0f,
+      0.5f, 0.0f, 1.0f, 0.0f, 0.5f, 1.0f,
+      -0.5f, 0.0f, 1.0f, 0.0f, -0.5f, 1.0f,
+      0.0f, -1.0f, -0.5f, 0.5f, -1.0f, 0.0f,
+      0.0f, -1.0f, 0.5f, -0.5f, -1.0f, 0.0f,
+      0.0f, 1.0f, -0.5f, -0.5f, 1.0f, 0.0f,
+      0.0f, 1.0f, 0.5f, 0.5f, 1.0f, 0.0f,
+      -1.0f, -1.0f, -0.5f, -1.0f, -1.0f, 0.5f,
+      -1.0f, -0.5f, 1.0f, -1.0f, 0.5f, 1.0f,
+      -1.0f, 1.0f, 0.5f, -1.0f, 1.0f, -0.5f,
+      -1.0f, 0.5f, -1.0f, -1.0f, -0.5f, -1.0f,
+      0.5f, -1.0f, -1.0f, -0.5f, -1.0f, -1.0f,
+      -0.5f, 1.0f, -1.0f, 0.5f, 1.0f, -1.0f,
+      1.0f, 0.5f, -1.0f, 1.0f, -0.5f, -1.0f,
+      1.0f, -1.0f, 0.5f, 1.0f, -1.0f, -0.5f,
+      1.0f, 1.0f, -0.5f, 1.0f, 1.0f, 0.5f,
+      1.0f, 0.5f, 1.0f, 1.0f, -0.5f, 1.0f,
+      -0.5f, -1.0f, 1.0f, 0.5f, -1.0f, 1.0f,
+      0.5f, 1.0f, 1.0f, -0.5f, 1.0f, 1.0f,
+      -1.0f, 0.0f, 0.0f, 0.0f, 0.0f, -1.0f,
+      1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+      0.0f, -1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+      -1.0f, -1.0f, 0.0f, -1.0f, 0.0f, 1.0f,
+      -1.0f, 1.0f, 0.0f, -1.0f, 0.0f, -1.0f,
+      0.0f, -1.0f, -1.0f, 0.0f, 1.0f, -1.0f,
+      1.0f, 0.0f, -1.0f, 1.0f, -1.0f, 0.0f,
+      1.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f,
+      0.0f, -1.0f, 1.0f, 0.0f, 1.0f, 1.0f,
+      -1.0f, -1.0f, 1.0f, -1.0f, 1.0f, 1.0f,
+      -1.0f, -1.0f, -1.0f, -1.0f, 1.0f, -1.0f,
+      1.0f, -1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+      1.0f, -1.0f, -1.0f, 1.0f, 1.0f, -1.0f
+   };
+   constexpr int m_simple_cube_obj_faceStart[] =
+   {
+      0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33,
+      36, 39, 42, 45, 48, 51, 54, 57, 60, 63, 66, 69,
+      72, 75, 78, 81, 84, 87, 90, 93, 96, 99, 102, 105,
+      108, 111, 114, 117, 120, 123, 126, 129, 132, 135, 138, 141,
+      144, 147, 150, 153, 156, 159, 162, 165, 168, 171, 174, 177,
+      180, 183, 186, 189, 192, 195, 198, 201, 204, 207, 210, 213,
+      216, 219, 222, 225, 228, 231, 234, 237, 240, 243, 246, 249,
+      252, 255, 258, 261, 264, 267, 270, 273, 276, 279, 282, 285,
+      288, 291, 294, 297, 300, 303, 306, 309, 312, 315, 318, 321,
+      324, 327, 330, 333, 336, 339, 342, 345, 348, 351, 354, 357,
+      360, 363, 366, 369, 372, 375, 378, 381, 384, 387, 390, 393,
+      396, 399, 402, 405, 408, 411, 414, 417, 420, 423, 426, 429,
+      432, 435, 438, 441, 444, 447, 450, 453, 456, 459, 462, 465,
+      468, 471, 474, 477, 480, 483, 486, 489, 492, 495, 498, 501,
+      504, 507, 510, 513, 516, 519, 522, 525, 528, 531, 534, 537,
+      540, 543, 546, 549, 552, 555, 558, 561, 564, 567, 570, 573,
+      576
+   };
+   constexpr int m_simple_cube_obj_faceIndex[] =
+   {
+      24, 27, 0, 27, 49, 0, 49, 50, 0, 50, 24, 0,
+      25, 24, 1, 24, 51, 1, 51, 52, 1, 52, 25, 1,
+      26, 25, 2, 25, 53, 2, 53, 54, 2, 54, 26, 2,
+      27, 26, 3, 26, 55, 3, 55, 48, 3, 48, 27, 3,
+      28, 31, 4, 31, 57, 4, 57, 55, 4, 55, 28, 4,
+      29, 28, 5, 28, 54, 5, 54, 58, 5, 58, 29, 5,
+      30, 29, 6, 29, 59, 6, 59, 60, 6, 60, 30, 6,
+      31, 30, 7, 30, 61, 7, 61, 56, 7, 56, 31, 7,
+      32, 35, 8, 35, 63, 8, 63, 61, 8, 61, 32, 8,
+      33, 32, 9, 32, 60, 9, 60, 64, 9, 64, 33, 9,
+      34, 33, 10, 33, 65, 10, 65, 66, 10, 66, 34, 10,
+      35, 34, 11, 34, 67, 11, 67, 62, 11, 62, 35, 11,
+      36, 39, 12, 39, 69, 12, 69, 67, 12, 67, 36, 12,
+      37, 36, 13, 36, 66, 13, 66, 70, 13, 70, 37, 13,
+      38, 37, 14, 37, 71, 14, 71, 51, 14, 51, 38, 14,
+      39, 38, 15, 38, 50, 15, 50, 68, 15, 68, 39, 15,
+      40, 43, 16, 43, 48, 16, 48, 57, 16, 57, 40, 16,
+      41, 40, 17, 40, 56, 17, 56, 63, 17, 63, 41, 17,
+      42, 41, 18, 41, 62, 18, 62, 69, 18, 69, 42, 18,
+      43, 42, 19, 42, 68, 19, 68, 49, 19, 49, 43, 19,
+      44, 47, 20, 47, 64, 20, 64, 59, 20, 59, 44, 20,
+      45, 44, 21, 44, 58, 21, 58, 53, 21, 53, 45, 21,
+      46, 45, 22, 45, 52, 22, 52, 71, 22, 71, 46, 22,
+      47, 46, 23, 46, 70, 23, 70, 65, 23, 65, 47, 23,
+      24, 72, 27, 27, 78, 49, 49, 90, 50, 50, 79, 24,
+      25, 72, 24, 24, 79, 51, 51, 91, 52, 52, 80, 25,
+      26, 72, 25, 25, 80, 53, 53, 93, 54, 54, 81, 26,
+      27, 72, 26, 26, 81, 55, 55, 92, 48, 48, 78, 27,
+      28, 73, 31, 31, 82, 57, 57, 92, 55, 55, 81, 28,
+      29, 73, 28, 28, 81, 54, 54, 93, 58, 58, 83, 29,
+      30, 73, 29, 29, 83, 59, 59, 97, 60, 60, 84, 30,
+      31, 73, 30, 30, 84, 61, 61, 96, 56, 56, 82, 31,
+      32, 74, 35, 35, 85, 63, 63, 96, 61, 61, 84, 32,
+      33, 74, 32, 32, 84, 60, 60, 97, 64, 64, 86, 33,
+      34, 74, 33, 33, 86, 65, 65, 95, 66, 66, 87, 34,
+      35, 74, 34, 34, 87, 67, 67, 94, 62, 62, 85, 35,
+      36, 75, 39, 39, 88, 69, 69, 94, 67, 67, 87, 36,
+      37, 75, 36, 36, 87, 66, 66, 95, 70, 70, 89, 37,
+      38, 75, 37, 37, 89, 71, 71, 91, 51, 51, 79, 38,
+      39, 75, 38, 38, 79, 50, 50, 90, 68, 68, 88, 39,
+      40, 76, 43, 43, 78, 48, 48, 92, 57, 57, 82, 40,
+      41, 76, 40, 40, 82, 56, 56, 96, 63, 63, 85, 41,
+      42, 76, 41, 41, 85, 62, 62, 94, 69, 69, 88, 42,
+      43, 76, 42, 42, 88, 68, 68, 90, 49, 49, 78, 43,
+      44, 77, 47, 47, 86, 64, 64, 97, 59, 59, 83, 44,
+      45, 77, 44, 44, 83, 58, 58, 93, 53, 53, 80, 45,
+      46, 77, 45, 45, 80, 52, 52, 91, 71, 71, 89, 46,
+      47, 77, 46, 46, 89, 70, 70, 95, 65, 65, 86, 47
+   };
+
+   // simple/edge1-tri.obj
+   constexpr float m_simple_edge1_tri_obj_vertex[] =
+   {
+      0.0475649983f, -0.182517007f, 0.0694440007f, 0.0f, -0.118055999f, 0.0694440007f,
+      0.0f, -0.180555999f, 0.0694440007f, 0.0527100004f, -0.120228998f, 0.0694440007f,
+      0.0f, -0.0555559993f, 0.0694440007f, 0.0630009994f, 0.00434600003f, 0.0694440007f,
+      0.0f, 0.00694399979f, 0.0694440007f, 0.0681459978f, 0.0666339993f, 0.0694440007f,
+      0.0f, 0.0694440007f, 0.0694440007f, 0.105062999f, -0.126735002f, 0.0694440007f,
+      0.115318f, -0.0650819987f, 0.0694440007f, 0.057856001f, -0.0579419993f, 0.0694440007f,
+      0.125573993f, -0.00342900003f, 0.0694440007f, 0.141405001f, -0.198127002f, 0.0694440007f,
+      0.094806999f, -0.188388005f, 0.0694440007f, 0.171997994f, -0.076929003f, 0.0694440007f,
+      0.187295005f, -0.0163289998f, 0.0694440007f, 0.13583f, 0.058224f, 0.0694440007f,
+      0.207277f, -0.152536005f, 0.0694440007f, 0.156701997f, -0.137528002f, 0.0694440007f,
+      0.227511004f, -0.0934019983f, 0.0694440007f, 0.247743994f, -0.0342670009f, 0.0694440007f,
+      0.267976999f, 0.0248670001f, 0.0694440007f, 0.202591002f, 0.0442700014f, 0.0694440007f,
+      -0.0475649983f, -0.182517007f, 0.0694440007f, -0.105062999f, -0.126735002f, 0.0694440007f,
+      -0.094806999f, -0.188388005f, 0.0694440007f, -0.141405001f, -0.198127002f, 0.0694440007f,
+      -0.215184003f, -0.153229997f, 0.0694440007f, -0.198890999f, -0.213569f, 0.0694440007f,
+      -0.0527100004f, -0.120228998f, 0.0694440007f, -0.115318f, -0.0650819987f, 0.0694440007f,
+      -0.171997994f, -0.076929003f, 0.0694440007f, -0.156701997f, -0.137528002f, 0.0694440007f,
+      -0.231478006f, -0.0928910002f, 0.0694440007f, -0.0630009994f, 0.00434600003f, 0.0694440007f,
+      -0.057856001f, -0.0579419993f, 0.0694440007f, -0.125573993f, -0.00342900003f, 0.0694440007f,
+      -0.247770995f, -0.0325520001f, 0.0694440007f, -0.0681459978f, 0.0666339993f, 0.0694440007f,
+      -0.13583f, 0.058224f, 0.0694440007f, -0.187295005f, -0.0163289998f, 0.0694440007f,
+      -0.264064014f, 0.0277869999f, 0.0694440007f, 0.0f, 0.0694440007f, -0.118055999f,
+      0.0681459978f, 0.0666339993f, -0.180555999f, 0.0f, 0.0694440007f, -0.180555999f,
+      0.0681459978f, 0.0666339993f, -0.118055999f, 0.13583f, 0.058224f, -0.180555999f,
+      0.13583f, 0.058224f, -0.118055999f, 0.202591002f, 0.0442700014f, -0.180555999f,
+      0.202591002f, 0.0442700014f, -0.118055999f, 0.267976999f, 0.0248670001f, -0.180555999f,
+      0.0f, 0.0694440007f, -0.0555559993f, 0.0681459978f, 0.0666339993f, -0.0555559993f,
+      0.13583f, 0.058224f, -0.0555559993f, 0.202591002f, 0.0442700014f, -0.0555559993f,
+      0.267976999f, 0.0248670001f, -0.118055999f, 0.0f, 0.0694440007f, 0.00694399979f,
+      0.0681459978f, 0.0666339993f, 0.00694399979f, 0.13583f, 0.058224f, 0.00694399979f,
+      0.202591002f, 0.0442700014f, 0.00694399979f, 0.267976999f, 0.0248670001f, -0.0555559993f,
+      0.267976999f, 0.0248670001f, 0.00694399979f, -0.0681459978f, 0.0666339993f, -0.180555999f,
+      -0.0681459978f, 0.0666339993f, -0.118055999f, -0.0681459978f, 0.0666339993f, -0.0555559993f,
+      -0.0681459978f, 0.0666339993f, 0.00694399979f, -0.13583f, 0.058224f, -0.180555999f,
+      -0.13583f, 0.058224f, -0.118055999f, -0.13583f, 0.058224f, -0.0555559993f,
+      -0.13583f, 0.058224f, 0.00694399979f, -0.202591002f, 0.0442700014f, -0.180555999f,
+      -0.202591002f, 0.0442700014f, -0.118055999f, -0.202591002f, 0.0442700014f, -0.0555559993f,
+      -0.202591002f, 0.0442700014f, 0.00694399979f, -0.264064014f, 0.0277869999f, -0.180555999f,
+      -0.264064014f, 0.0277869999f, -0.118055999f, -0.264064014f, 0.0277869999f, -0.0555559993f,
+      -0.264064014f, 0.0277869999f, 0.00694399979f, -0.202591002f, 0.0442700014f, 0.0694440007f,
+      0.187043995f, -0.211669996f, 0.0694440007f
+   };
+   constexpr int m_simple_edge1_tri_obj_faceStart[] =
+   {
+      0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33,
+      36, 39, 42, 45, 48, 51, 54, 57, 60, 63, 66, 69,
+      72, 75, 78, 81, 84, 87, 90, 93, 96, 99, 102, 105,
+      108, 111, 114, 117, 120, 123, 126, 129, 132, 135, 138, 141,
+      144, 147, 150, 153, 156, 159, 162, 165, 168, 171, 174, 177,
+      180, 183, 186, 189, 192, 195, 198, 201, 204, 207, 210, 213,
+      216, 219, 222, 225, 228, 231, 234, 237, 240, 243, 246, 249,
+      252, 255, 258, 261, 264, 267, 270, 273, 276, 279, 282, 285,
+      288, 291, 294, 297, 300, 303, 306, 309, 312, 315, 318, 321,
+      324, 327, 330, 333, 336, 339, 342, 345, 348, 351, 354, 357,
+      360, 363, 366, 369, 372, 375, 378, 381, 384
+   };
+   constexpr int m_simple_edge1_tri_obj_faceIndex[] =
+   {
+      0, 1, 2, 3, 4, 1, 4, 5, 6, 6, 7, 8,
+      0, 9, 3, 3, 10, 11, 10, 5, 11, 12, 7, 5,
+      13, 9, 14, 9, 15, 10, 15, 12, 10, 16, 17, 12,
+      13, 18, 19, 19, 20, 15, 15, 21, 16, 16, 22, 23,
+      1, 24, 2, 24, 25, 26, 25, 27, 26, 27, 28, 29,
+      4, 30, 1, 30, 31, 25, 25, 32, 33, 33, 34, 28,
+      4, 35, 36, 35, 31, 36, 37, 32, 31, 32, 38, 34,
+      6, 39, 35, 39, 37, 35, 40, 41, 37, 41, 42, 38,
+      43, 44, 45, 46, 47, 44, 48, 49, 47, 50, 51, 49,
+      52, 46, 43, 53, 48, 46, 54, 50, 48, 55, 56, 50,
+      57, 53, 52, 58, 54, 53, 59, 55, 54, 60, 61, 55,
+      8, 58, 57, 7, 59, 58, 17, 60, 59, 23, 62, 60,
+      63, 43, 45, 64, 52, 43, 65, 57, 52, 66, 8, 57,
+      67, 64, 63, 68, 65, 64, 69, 66, 65, 70, 39, 66,
+      71, 68, 67, 72, 69, 68, 73, 70, 69, 74, 40, 70,
+      75, 72, 71, 76, 73, 72, 77, 74, 73, 78, 79, 74,
+      0, 3, 1, 3, 11, 4, 4, 11, 5, 6, 5, 7,
+      0, 14, 9, 3, 9, 10, 10, 12, 5, 12, 17, 7,
+      13, 19, 9, 9, 19, 15, 15, 16, 12, 16, 23, 17,
+      13, 80, 18, 19, 18, 20, 15, 20, 21, 16, 21, 22,
+      1, 30, 24, 24, 30, 25, 25, 33, 27, 27, 33, 28,
+      4, 36, 30, 30, 36, 31, 25, 31, 32, 33, 32, 34,
+      4, 6, 35, 35, 37, 31, 37, 41, 32, 32, 41, 38,
+      6, 8, 39, 39, 40, 37, 40, 79, 41, 41, 79, 42,
+      43, 46, 44, 46, 48, 47, 48, 50, 49, 50, 56, 51,
+      52, 53, 46, 53, 54, 48, 54, 55, 50, 55, 61, 56,
+      57, 58, 53, 58, 59, 54, 59, 60, 55, 60, 62, 61,
+      8, 7, 58, 7, 17, 59, 17, 23, 60, 23, 22, 62,
+      63, 64, 43, 64, 65, 52, 65, 66, 57, 66, 39, 8,
+      67, 68, 64, 68, 69, 65, 69, 70, 66, 70, 40, 39,
+      71, 72, 68, 72, 73, 69, 73, 74, 70, 74, 79, 40,
+      75, 76, 72, 76, 77, 73, 77, 78, 74, 78, 42, 79
+   };
+
+   // simple/edge2-tri.obj
+   constexpr float m_simple_edge2_tri_obj_vertex[] =
+   {
+      0.102966003f, -0.272033989f, 0.125f, 0.102966003f, -0.188701004f, 0.208333001f,
+      0.102966003f, -0.272033989f, 0.208333001f, 0.102966003f, -0.272033989f, 0.0416669995f,
+      0.102966003f, -0.188701004f, 0.125f, 0.102966003f, -0.272033989f, -0.0416669995f,
+      0.102966003f, -0.188701004f, 0.0416669995f, 0.102966003f, -0.272033989f, -0.125f,
+      0.102966003f, -0.188701004f, -0.0416669995f, 0.102966003f, -0.272033989f, -0.208333001f,
+      0.102966003f, -0.188701004f, -0.125f, 0.102966003f, -0.105366997f, 0.208333001f,
+      0.102966003f, -0.105366997f, 0.125f, 0.102966003f, -0.105366997f, 0.0416669995f,
+      0.102966003f, -0.105366997f, -0.0416669995f, 0.102966003f, -0.188701004f, -0.208333001f,
+      0.102966003f, -0.105366997f, -0.125f, 0.102966003f, -0.0220340006f, 0.208333001f,
+      0.102966003f, -0.0220340006f, 0.125f, 0.102966003f, -0.0220340006f, 0.0416669995f,
+      0.102966003f, -0.0220340006f, -0.0416669995f, 0.102966003f, -0.105366997f, -0.208333001f,
+      0.102966003f, -0.0220340006f, -0.125f, 0.094893001f, 0.0221599992f, 0.208333001f,
+      0.094893001f, 0.0221599992f, 0.125f, 0.094893001f, 0.0221599992f, 0.0416669995f,
+      0.094893001f, 0.0221599992f, -0.0416669995f, 0.102966003f, -0.0220340006f, -0.208333001f,
+      0.094893001f, 0.0221599992f, -0.125f, 0.0663539991f, 0.0663539991f, 0.208333001f,
+      0.0663539991f, 0.0663539991f, 0.125f, 0.0663539991f, 0.0663539991f, 0.0416669995f,
+      0.0663539991f, 0.0663539991f, -0.0416669995f, 0.094893001f, 0.0221599992f, -0.208333001f,
+      0.0663539991f, 0.0663539991f, -0.125f, 0.0221599992f, 0.094893001f, -0.208333001f,
+      0.0663539991f, 0.0663539991f, -0.208333001f, -0.0220340006f, 0.102966003f, -0.208333001f,
+      0.0221599992f, 0.094893001f, -0.125f, -0.105366997f, 0.102966003f, -0.208333001f,
+      -0.0220340006f, 0.102966003f, -0.125f, -0.188701004f, 0.102966003f, -0.208333001f,
+      -0.105366997f, 0.102966003f, -0.125f, -0.272033989f, 0.102966003f, -0.208333001f,
+      -0.188701004f, 0.102966003f, -0.125f, 0.0221599992f, 0.094893001f, -0.0416669995f,
+      -0.0220340006f, 0.102966003f, -0.0416669995f, -0.105366997f, 0.102966003f, -0.0416669995f,
+      -0.272033989f, 0.102966003f, -0.125f, -0.188701004f, 0.102966003f, -0.0416669995f,
+      0.0221599992f, 0.094893001f, 0.0416669995f, -0.0220340006f, 0.102966003f, 0.0416669995f,
+      -0.105366997f, 0.102966003f, 0.0416669995f, -0.272033989f, 0.102966003f, -0.0416669995f,
+      -0.188701004f, 0.102966003f, 0.0416669995f, 0.0221599992f, 0.094893001f, 0.125f,
+      -0.0220340006f, 0.102966003f, 0.125f, -0.105366997f, 0.102966003f, 0.125f,
+      -0.272033989f, 0.102966003f, 0.0416669995f, -0.188701004f, 0.102966003f, 0.125f,
+      0.0221599992f, 0.094893001f, 0.208333001f, -0.0220340006f, 0.102966003f, 0.208333001f,
+      -0.105366997f, 0.102966003f, 0.208333001f, -0.272033989f, 0.102966003f, 0.125f,
+      -0.188701004f, 0.102966003f, 0.208333001f, -0.272033989f, 0.102966003f, 0.208333001f
+   };
+   constexpr int m_simple_edge2_tri_obj_faceStart[] =
+   {
+      0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33,
+      36, 39, 42, 45, 48, 51, 54, 57, 60, 63, 66, 69,
+      72, 75, 78, 81, 84, 87, 90, 93, 96, 99, 102, 105,
+      108, 111, 114, 117, 120, 123, 126, 129, 132, 135, 138, 141,
+      144, 147, 150, 153, 156, 159, 162, 165, 168, 171, 174, 177,
+      180, 183, 186, 189, 192, 195, 198, 201, 204, 207, 210, 213,
+      216, 219, 222, 225, 228, 231, 234, 237, 240, 243, 246, 249,
+      252, 255, 258, 261, 264, 267, 270, 273, 276, 279, 282, 285,
+      288, 291, 294, 297, 300
+   };
+   constexpr int m_simple_edge2_tri_obj_faceIndex[] =
+   {
+      0, 1, 2, 3, 4, 0, 5, 6, 3, 7, 8, 5,
+      9, 10, 7, 4, 11, 1, 6, 12, 4, 8, 13, 6,
+      10, 14, 8, 15, 16, 10, 12, 17, 11, 13, 18, 12,
+      14, 19, 13, 16, 20, 14, 21, 22, 16, 18, 23, 17,
+      19, 24, 18, 20, 25, 19, 22, 26, 20, 27, 28, 22,
+      24, 29, 23, 25, 30, 24, 26, 31, 25, 28, 32, 26,
+      33, 34, 28, 35, 34, 36, 37, 38, 35, 39, 40, 37,
+      41, 42, 39, 43, 44, 41, 38, 32, 34, 40, 45, 38,
+      42, 46, 40, 44, 47, 42, 48, 49, 44, 45, 31, 32,
+      46, 50, 45, 47, 51, 46, 49, 52, 47, 53, 54, 49,
+      50, 30, 31, 51, 55, 50, 52, 56, 51, 54, 57, 52,
+      58, 59, 54, 55, 29, 30, 56, 60, 55, 57, 61, 56,
+      59, 62, 57, 63, 64, 59, 0, 4, 1, 3, 6, 4,
+      5, 8, 6, 7, 10, 8, 9, 15, 10, 4, 12, 11,
+      6, 13, 12, 8, 14, 13, 10, 16, 14, 15, 21, 16,
+      12, 18, 17, 13, 19, 18, 14, 20, 19, 16, 22, 20,
+      21, 27, 22, 18, 24, 23, 19, 25, 24, 20, 26, 25,
+      22, 28, 26, 27, 33, 28, 24, 30, 29, 25, 31, 30,
+      26, 32, 31, 28, 34, 32, 33, 36, 34, 35, 38, 34,
+      37, 40, 38, 39, 42, 40, 41, 44, 42, 43, 48, 44,
+      38, 45, 32, 40, 46, 45, 42, 47, 46, 44, 49, 47,
+      48, 53, 49, 45, 50, 31, 46, 51, 50, 47, 52, 51,
+      49, 54, 52, 53, 58, 54, 50, 55, 30, 51, 56, 55,
+      52, 57, 56, 54, 59, 57, 58, 63, 59, 55, 60, 29,
+      56, 61, 60, 57, 62, 61, 59, 64, 62, 63, 65, 64
+   };
+
+   // simple/octahedron.obj
+   constexpr float m_simple_octahedron_obj_vertex[] =
+   {
+      0.0f, -10.0f, 0.0f, 0.0f, 0.0f, 10.0f,
+      -10.0f, 0.0f, 0.0f, 0.0f, 0.0f, -10.0f,
+      10.0f, 0.0f, 0.0f, 0.0f, 10.0f, 0.0f
+   };
+   constexpr int m_simple_octahedron_obj_faceStart[] =
+   {
+      0, 3, 6, 9, 12, 15, 18, 21, 24
+   };
+   constexpr int m_simple_octahedron_obj_faceIndex[] =
+   {
+      0, 1, 2, 0, 2, 3, 0, 3, 4, 0, 4, 1,
+      5, 2, 1, 5, 3, 2, 5, 4, 3, 5, 1, 4
+   };
+
+   // simple/plane-tri.obj
+   constexpr float m_simple_plane_tri_obj_vertex[] =
+   {
+      -0.150000006f, -0.200000003f, -0.0f, -0.200000003f, -0.150000006f, -0.0f,
+      -0.200000003f, -0.200000003f, -0.0f, -0.100000001f, -0.200000003f, -0.0f,
+      -0.150000006f, -0.150000006f, -0.0f, -0.0500000007f, -0.200000003f, -0.0f,
+      -0.100000001f, -0.150000006f, -0.0f, 0.0f, -0.200000003f, -0.0f,
+      -0.0500000007f, -0.150000006f, -0.0f, 0.0500000007f, -0.200000003f, -0.0f,
+      0.0f, -0.150000006f, -0.0f, 0.100000001f, -0.200000003f, -0.0f,
+      0.0500000007f, -0.150000006f, -0.0f, 0.150000006f, -0.200000003f, -0.0f,
+      0.100000001f, -0.150000006f, -0.0f, 0.200000003f, -0.200000003f, -0.0f,
+      0.150000006f, -0.150000006f, -0.0f, -0.200000003f, -0.100000001f, -0.0f,
+      -0.150000006f, -0.100000001f, -0.0f, -0.100000001f, -0.100000001f, -0.0f,
+      -0.0500000007f, -0.100000001f, -0.0f, 0.0f, -0.100000001f, -0.0f,
+      0.0500000007f, -0.100000001f, -0.0f, 0.100000001f, -0.100000001f, -0.0f,
+      0.200000003f, -0.150000006f, -0.0f, 0.150000006f, -0.100000001f, -0.0f,
+      -0.200000003f, -0.0500000007f, -0.0f, -0.150000006f, -0.0500000007f, -0.0f,
+      -0.100000001f, -0.0500000007f, -0.0f, -0.0500000007f, -0.0500000007f, -0.0f,
+      0.0f, -0.0500000007f, -0.0f, 0.0500000007f, -0.0500000007f, -0.0f,
+      0.100000001f, -0.0500000007f, -0.0f, 0.200000003f, -0.100000001f, -0.0f,
+      0.150000006f, -0.0500000007f, -0.0f, -0.200000003f, 0.0f, 0.0f,
+      -0.150000006f, 0.0f, 0.0f, -0.100000001f, 0.0f, 0.0f,
+      -0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+      0.0500000007f, 0.0f, 0.0f, 0.100000001f, 0.0f, 0.0f,
+      0.200000003f, -0.0500000007f, -0.0f, 0.150000006f, 0.0f, 0.0f,
+      -0.200000003f, 0.0500000007f, 0.0f, -0.150000006f, 0.0500000007f, 0.0f,
+      -0.100000001f, 0.0500000007f, 0.0f, -0.0500000007f, 0.0500000007f, 0.0f,
+      0.0f, 0.0500000007f, 0.0f, 0.0500000007f, 0.0500000007f, 0.0f,
+      0.100000001f, 0.0500000007f, 0.0f, 0.200000003f, 0.0f, 0.0f,
+      0.150000006f, 0.0500000007f, 0.0f, -0.200000003f, 0.100000001f, 0.0f,
+      -0.150000006f, 0.100000001f, 0.0f, -0.100000001f, 0.100000001f, 0.0f,
+      -0.0500000007f, 0.100000001f, 0.0f, 0.0f, 0.100000001f, 0.0f,
+      0.0500000007f, 0.100000001f, 0.0f, 0.100000001f, 0.100000001f, 0.0f,
+      0.200000003f, 0.0500000007f, 0.0f, 0.150000006f, 0.100000001f, 0.0f,
+      -0.200000003f, 0.150000006f, 0.0f, -0.150000006f, 0.150000006f, 0.0f,
+      -0.100000001f, 0.150000006f, 0.0f, -0.0500000007f, 0.150000006f, 0.0f,
+      0.0f, 0.150000006f, 0.0f, 0.0500000007f, 0.150000006f, 0.0f,
+      0.100000001f, 0.150000006f, 0.0f, 0.200000003f, 0.100000001f, 0.0f,
+      0.150000006f, 0.150000006f, 0.0f, -0.200000003f, 0.200000003f, 0.0f,
+      -0.150000006f, 0.200000003f, 0.0f, -0.100000001f, 0.200000003f, 0.0f,
+      -0.0500000007f, 0.200000003f, 0.0f, 0.0f, 0.200000003f, 0.0f,
+      0.0500000007f, 0.200000003f, 0.0f, 0.100000001f, 0.200000003f, 0.0f,
+      0.200000003f, 0.150000006f, 0.0f, 0.150000006f, 0.200000003f, 0.0f,
+      0.200000003f, 0.200000003f, 0.0f
+   };
+   constexpr int m_simple_plane_tri_obj_faceStart[] =
+   {
+      0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33,
+      36, 39, 42, 45, 48, 51, 54, 57, 60, 63, 66, 69,
+      72, 75, 78, 81, 84, 87, 90, 93, 96, 99, 102, 105,
+      108, 111, 114, 117, 120, 123, 126, 129, 132, 135, 138, 141,
+      144, 147, 150, 153, 156, 159, 162, 165, 168, 171, 174, 177,
+      180, 183, 186, 189, 192, 195, 198, 201, 204, 207, 210, 213,
+      216, 219, 222, 225, 228, 231, 234, 237, 240, 243, 246, 249,
+      252, 255, 258, 261, 264, 267, 270, 273, 276, 279, 282, 285,
+      288, 291, 294, 297, 300, 303, 306, 309, 312, 315, 318, 321,
+      324, 327, 330, 333, 336, 339, 342, 345, 348, 351, 354, 357,
+      360, 363, 366, 369, 372, 375, 378, 381, 384
+   };
+   constexpr int m_simple_plane_tri_obj_faceIndex[] =
+   {
+      0, 1, 2, 3, 4, 0, 5, 6, 3, 7, 8, 5,
+      9, 10, 7, 11, 12, 9, 13, 14, 11, 15, 16, 13,
+      4, 17, 1, 6, 18, 4, 8, 19, 6, 10, 20, 8,
+      12, 21, 10, 14, 22, 12, 16, 23, 14, 24, 25, 16,
+      18, 26, 17, 19, 27, 18, 20, 28, 19, 21, 29, 20,
+      22, 30, 21, 23, 31, 22, 25, 32, 23, 33, 34, 25,
+      27, 35, 26, 28, 36, 27, 29, 37, 28, 30, 38, 29,
+      31, 39, 30, 32, 40, 31, 34, 41, 32, 42, 43, 34,
+      36, 44, 35, 37, 45, 36, 38, 46, 37, 39, 47, 38,
+      40, 48, 39, 41, 49, 40, 43, 50, 41, 51, 52, 43,
+      45, 53, 44, 46, 54, 45, 47, 55, 46, 48, 56, 47,
+      49, 57, 48, 50, 58, 49, 52, 59, 50, 60, 61, 52,
+      54, 62, 53, 55, 63, 54, 56, 64, 55, 57, 65, 56,
+      58, 66, 57, 59, 67, 58, 61, 68, 59, 69, 70, 61,
+      63, 71, 62, 64, 72, 63, 65, 73, 64, 66, 74, 65,
+      67, 75, 66, 68, 76, 67, 70, 77, 68, 78, 79, 70,
+      0, 4, 1, 3, 6, 4, 5, 8, 6, 7, 10, 8,
+      9, 12, 10, 11, 14, 12, 13, 16, 14, 15, 24, 16,
+      4, 18, 17, 6, 19, 18, 8, 20, 19, 10, 21, 20,
+      12, 22, 21, 14, 23, 22, 16, 25, 23, 24, 33, 25,
+      18, 27, 26, 19, 28, 27, 20, 29, 28, 21, 30, 29,
+      22, 31, 30, 23, 32, 31, 25, 34, 32, 33, 42, 34,
+      27, 36, 35, 28, 37, 36, 29, 38, 37, 30, 39, 38,
+      31, 40, 39, 32, 41, 40, 34, 43, 41, 42, 51, 43,
+      36, 45, 44, 37, 46, 45, 38, 47, 46, 39, 48, 47,
+      40, 49, 48, 41, 50, 49, 43, 52, 50, 51, 60, 52,
+      45, 54, 53, 46, 55, 54, 47, 56, 55, 48, 57, 56,
+      49, 58, 57, 50, 59, 58, 52, 61, 59, 60, 69, 61,
+      54, 63, 62, 55, 64, 63, 56, 65, 64, 57, 66, 65,
+      58, 67, 66, 59, 68, 67, 61, 70, 68, 69, 78, 70,
+      63, 72, 71, 64, 73, 72, 65, 74, 73, 66, 75, 74,
+      67, 76, 75, 68, 77, 76, 70, 79, 77, 78, 80, 79
+   };
+
+   // simple/quad_meshes/cube.obj
+   constexpr float m_simple_quad_meshes_cube_obj_vertex[] =
+   {
+      -4.0f, -4.0f, 4.0f, -4.0f, -4.0f, -4.0f,
+      4.0f, -4.0f, -4.0f, 4.0f, -4.0f, 4.0f,
+      -4.0f, 4.0f, 4.0f, 4.0f, 4.0f, 4.0f,
+      4.0f, 4.0f, -4.0f, -4.0f, 4.0f, -4.0f
+   };
+   constexpr int m_simple_quad_meshes_cube_obj_faceStart[] =
+   {
+      0, 4, 8, 12, 16, 20, 24
+   };
+   constexpr int m_simple_quad_meshes_cube_obj_faceIndex[] =
+   {
+      0, 1, 2, 3, 4, 5, 6, 7, 3, 2, 6, 5,
+      1, 0, 4, 7, 0, 3, 5, 4, 2, 1, 7, 6
+   };
+
+   // simple/rcube-half-tri.obj
+   constexpr float m_simple_rcube_half_tri_obj_vertex[] =
+   {
+      -0.125f, -0.426777005f, -0.426777005f, 0.0f, -0.338387996f, -0.483853996f,
+      0.0f, -0.426777005f, -0.426777005f, -0.25f, -0.426777005f, -0.426777005f,
+      -0.125f, -0.338387996f, -0.483853996f, -0.322169006f, -0.419250995f, -0.419250995f,
+      -0.25f, -0.338387996f, -0.483853996f, -0.394338012f, -0.394338012f, -0.394338012f,
+      -0.334625006f, -0.334625006f, -0.469493002f, 0.0f, -0.25f, -0.5f,
+      -0.125f, -0.25f, -0.5f, -0.25f, -0.25f, -0.5f,
+      -0.419250995f, -0.322169006f, -0.419250995f, -0.338387996f, -0.25f, -0.483853996f,
+      0.0f, -0.125f, -0.5f, -0.125f, -0.125f, -0.5f,
+      -0.25f, -0.125f, -0.5f, -0.426777005f, -0.25f, -0.426777005f,
+      -0.338387996f, -0.125f, -0.483853996f, 0.0f, 0.0f, -0.5f,
+      -0.125f, 0.0f, -0.5f, -0.25f, 0.0f, -0.5f,
+      -0.426777005f, -0.125f, -0.426777005f, -0.338387996f, 0.0f, -0.483853996f,
+      0.0f, 0.125f, -0.5f, -0.125f, 0.125f, -0.5f,
+      -0.25f, 0.125f, -0.5f, -0.426777005f, 0.0f, -0.426777005f,
+      -0.338387996f, 0.125f, -0.483853996f, 0.0f, 0.25f, -0.5f,
+      -0.125f, 0.25f, -0.5f, -0.25f, 0.25f, -0.5f,
+      -0.426777005f, 0.125f, -0.426777005f, -0.338387996f, 0.25f, -0.483853996f,
+      0.0f, 0.338387996f, -0.483853996f, -0.125f, 0.338387996f, -0.483853996f,
+      -0.334625006f, 0.334625006f, -0.469493002f, -0.25f, 0.338387996f, -0.483853996f,
+      -0.419250995f, 0.322169006f, -0.419250995f, 0.0f, 0.426777005f, -0.426777005f,
+      -0.125f, 0.426777005f, -0.426777005f, -0.322169006f, 0.419250995f, -0.419250995f,
+      -0.25f, 0.426777005f, -0.426777005f, -0.394338012f, 0.394338012f, -0.394338012f,
+      -0.469493002f, -0.334625006f, -0.334625006f, -0.419250995f, -0.419250995f, -0.322169006f,
+      -0.483853996f, -0.338387996f, -0.25f, -0.426777005f, -0.426777005f, -0.125f,
+      -0.426777005f, -0.426777005f, -0.25f, -0.426777005f, -0.426777005f, -0.0f,
+      -0.483853996f, -0.338387996f, -0.125f, -0.426777005f, -0.426777005f, 0.125f,
+      -0.483853996f, -0.338387996f, -0.0f, -0.426777005f, -0.426777005f, 0.25f,
+      -0.483853996f, -0.338387996f, 0.125f, -0.419250995f, -0.419250995f, 0.322169006f,
+      -0.483853996f, -0.338387996f, 0.25f, -0.394338012f, -0.394338012f, 0.394338012f,
+      -0.469493002f, -0.334625006f, 0.334625006f, -0.483853996f, -0.25f, -0.338387996f,
+      -0.5f, -0.25f, -0.25f, -0.5f, -0.25f, -0.125f,
+      -0.5f, -0.25f, -0.0f, -0.5f, -0.25f, 0.125f,
+      -0.5f, -0.25f, 0.25f, -0.419250995f, -0.322169006f, 0.419250995f,
+      -0.483853996f, -0.25f, 0.338387996f, -0.483853996f, -0.125f, -0.338387996f,
+      -0.5f, -0.125f, -0.25f, -0.5f, -0.125f, -0.125f,
+      -0.5f, -0.125f, -0.0f, -0.5f, -0.125f, 0.125f,
+      -0.5f, -0.125f, 0.25f, -0.426777005f, -0.25f, 0.426777005f,
+      -0.483853996f, -0.125f, 0.338387996f, -0.483853996f, 0.0f, -0.338387996f,
+      -0.5f, 0.0f, -0.25f, -0.5f, 0.0f, -0.125f,
+      -0.5f, 0.0f, 0.0f, -0.5f, -0.0f, 0.125f,
+      -0.5f, -0.0f, 0.25f, -0.426777005f, -0.125f, 0.426777005f,
+      -0.483853996f, -0.0f, 0.338387996f, -0.483853996f, 0.125f, -0.338387996f,
+      -0.5f, 0.125f, -0.25f, -0.5f, 0.125f, -0.125f,
+      -0.5f, 0.125f, 0.0f, -0.5f, 0.125f, 0.125f,
+      -0.5f, 0.125f, 0.25f, -0.426777005f, -0.0f, 0.426777005f,
+      -0.483853996f, 0.125f, 0.338387996f, -0.426777005f, 0.25f, -0.426777005f,
+      -0.483853996f, 0.25f, -0.338387996f, -0.5f, 0.25f, -0.25f,
+      -0.5f, 0.25f, -0.125f, -0.5f, 0.25f, 0.0f,
+      -0.5f, 0.25f, 0.125f, -0.5f, 0.25f, 0.25f,
+      -0.426777005f, 0.125f, 0.426777005f, -0.483853996f, 0.25f, 0.338387996f,
+      -0.469493002f, 0.334625006f, -0.334625006f, -0.483853996f, 0.338387996f, -0.25f,
+      -0.483853996f, 0.338387996f, -0.125f, -0.483853996f, 0.338387996f, 0.0f,
+      -0.483853996f, 0.338387996f, 0.125f, -0.469493002f, 0.334625006f, 0.334625006f,
+      -0.483853996f, 0.338387996f, 0.25f, -0.419250995f, 0.322169006f, 0.419250995f,
+      -0.419250995f, 0.419250995f, -0.322169006f, -0.426777005f, 0.426777005f, -0.25f,
+      -0.426777005f, 0.426777005f, -0.125f, -0.426777005f, 0.426777005f, 0.0f,
+      -0.426777005f, 0.426777005f, 0.125f, -0.419250995f, 0.419250995f, 0.322169006f,
+      -0.426777005f, 0.426777005f, 0.25f, -0.394338012f, 0.394338012f, 0.394338012f,
+      -0.334625006f, -0.334625006f, 0.469493002f, -0.322169006f, -0.419250995f, 0.419250995f,
+      -0.25f, -0.338387996f, 0.483853996f, -0.125f, -0.426777005f, 0.426777005f,
+      -0.25f, -0.426777005f, 0.426777005f, 0.0f, -0.426777005f, 0.426777005f,
+      -0.125f, -0.338387996f, 0.483853996f, -0.338387996f, -0.25f, 0.483853996f,
+      -0.25f, -0.25f, 0.5f, 0.0f, -0.338387996f, 0.483853996f,
+      -0.125f, -0.25f, 0.5f, -0.338387996f, -0.125f, 0.483853996f,
+      -0.25f, -0.125f, 0.5f, 0.0f, -0.25f, 0.5f,
+      -0.125f, -0.125f, 0.5f, -0.338387996f, -0.0f, 0.483853996f,
+      -0.25f, -0.0f, 0.5f, 0.0f, -0.125f, 0.5f,
+      -0.125f, -0.0f, 0.5f, -0.338387996f, 0.125f, 0.483853996f,
+      -0.25f, 0.125f, 0.5f, 0.0f, -0.0f, 0.5f,
+      -0.125f, 0.125f, 0.5f, -0.426777005f, 0.25f, 0.426777005f,
+      -0.338387996f, 0.25f, 0.483853996f, -0.25f, 0.25f, 0.5f,
+      0.0f, 0.125f, 0.5f, -0.125f, 0.25f, 0.5f,
+      -0.334625006f, 0.334625006f, 0.469493002f, -0.25f, 0.338387996f, 0.483853996f,
+      0.0f, 0.25f, 0.5f, -0.125f, 0.338387996f, 0.483853996f,
+      -0.322169006f, 0.419250995f, 0.419250995f, -0.25f, 0.426777005f, 0.426777005f,
+      0.0f, 0.338387996f, 0.483853996f, -0.125f, 0.426777005f, 0.426777005f,
+      0.0f, -0.483853996f, 0.338387996f, -0.125f, -0.483853996f, 0.338387996f,
+      -0.25f, -0.483853996f, 0.338387996f, -0.334625006f, -0.469493002f, 0.334625006f,
+      0.0f, -0.5f, 0.25f, -0.125f, -0.5f, 0.25f,
+      -0.25f, -0.5f, 0.25f, -0.338387996f, -0.483853996f, 0.25f,
+      0.0f, -0.5f, 0.125f, -0.125f, -0.5f, 0.125f,
+      -0.25f, -0.5f, 0.125f, -0.338387996f, -0.483853996f, 0.125f,
+      0.0f, -0.5f, -0.0f, -0.125f, -0.5f, -0.0f,
+      -0.25f, -0.5f, -0.0f, -0.338387996f, -0.483853996f, -0.0f,
+      0.0f, -0.5f, -0.125f, -0.125f, -0.5f, -0.125f,
+      -0.25f, -0.5f, -0.125f, -0.338387996f, -0.483853996f, -0.125f,
+      0.0f, -0.5f, -0.25f, -0.125f, -0.5f, -0.25f,
+      -0.25f, -0.5f, -0.25f, -0.338387996f, -0.483853996f, -0.25f,
+      0.0f, -0.483853996f, -0.338387996f, -0.125f, -0.483853996f, -0.338387996f,
+      -0.334625006f, -0.469493002f, -0.334625006f, -0.25f, -0.483853996f, -0.338387996f,
+      0.0f, 0.483853996f, -0.338387996f, -0.125f, 0.483853996f, -0.338387996f,
+      -0.25f, 0.483853996f, -0.338387996f, -0.334625006f, 0.469493002f, -0.334625006f,
+      0.0f, 0.5f, -0.25f, -0.125f, 0.5f, -0.25f,
+      -0.25f, 0.5f, -0.25f, -0.338387996f, 0.483853996f, -0.25f,
+      0.0f, 0.5f, -0.125f, -0.125f, 0.5f, -0.125f,
+      -0.25f, 0.5f, -0.125f, -0.338387996f, 0.483853996f, -0.125f,
+      0.0f, 0.5f, 0.0f, -0.125f, 0.5f, 0.0f,
+      -0.25f, 0.5f, 0.0f, -0.338387996f, 0.483853996f, 0.0f,
+      0.0f, 0.5f, 0.125f, -0.125f, 0.5f, 0.125f,
+      -0.25f, 0.5f, 0.125f, -0.338387996f, 0.483853996f, 0.125f,
+      0.0f, 0.5f, 0.25f, -0.125f, 0.5f, 0.25f,
+      -0.25f, 0.5f, 0.25f, -0.338387996f, 0.483853996f, 0.25f,
+      0.0f, 0.483853996f, 0.338387996f, -0.125f, 0.483853996f, 0.338387996f,
+      -0.334625006f, 0.469493002f, 0.334625006f, -0.25f, 0.483853996f, 0.338387996f,
+      0.0f, 0.426777005f, 0.426777005f
+   };
+   constexpr int m_simple_rcube_half_tri_obj_faceStart[] =
+   {
+      0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33,
+      36, 39, 42, 45, 48, 51, 54, 57, 60, 63, 66, 69,
+      72, 75, 78, 81, 84, 87, 90, 93, 96, 99, 102, 105,
+      108, 111, 114, 117, 120, 123, 126, 129, 132, 135, 138, 141,
+      144, 147, 150, 153, 156, 159, 162, 165, 168, 171, 174, 177,
+      180, 183, 186, 189, 192, 195, 198, 201, 204, 207, 210, 213,
+      216, 219, 222, 225, 228, 231, 234, 237, 240, 243, 246, 249,
+      252, 255, 258, 261, 264, 267, 270, 273, 276, 279, 282, 285,
+      288, 291, 294, 297, 300, 303, 306, 309, 312, 315, 318, 321,
+      324, 327, 330, 333, 336, 339, 342, 345, 348, 351, 354, 357,
+      360, 363, 366, 369, 372, 375, 378, 381, 384, 387, 390, 393,
+      396, 399, 402, 405, 408, 411, 414, 417, 420, 423, 426, 429,
+      432, 435, 438, 441, 444, 447, 450, 453, 456, 459, 462, 465,
+      468, 471, 474, 477, 480, 483, 486, 489, 492, 495, 498, 501,
+      504, 507, 510, 513, 516, 519, 522, 525, 528, 531, 534, 537,
+      540, 543, 546, 549, 552, 555, 558, 561, 564, 567, 570, 573,
+      576, 579, 582, 585, 588, 591, 594, 597, 600, 603, 606, 609,
+      612, 615, 618, 621, 624, 627, 630, 633, 636, 639, 642, 645,
+      648, 651, 654, 657, 660, 663, 666, 669, 672, 675, 678, 681,
+      684, 687, 690, 693, 696, 699, 702, 705, 708, 711, 714, 717,
+      720, 723, 726, 729, 732, 735, 738, 741, 744, 747, 750, 753,
+      756, 759, 762, 765, 768, 771, 774, 777, 780, 783, 786, 789,
+      792, 795, 798, 801, 804, 807, 810, 813, 816, 819, 822, 825,
+      828, 831, 834, 837, 840, 843, 846, 849, 852, 855, 858, 861,
+      864, 867, 870, 873, 876, 879, 882, 885, 888, 891, 894, 897,
+      900, 903, 906, 909, 912, 915, 918, 921, 924, 927, 930, 933,
+      936, 939, 942, 945, 948, 951, 954, 957, 960, 963, 966, 969,
+      972, 975, 978, 981, 984, 987, 990, 993, 996, 999, 1002, 1005,
+      1008, 1011, 1014, 1017, 1020, 1023, 1026, 1029, 1032, 1035, 1038, 1041,
+      1044, 1047, 1050, 1053, 1056, 1059, 1062, 1065, 1068, 1071, 1074, 1077,
+      1080, 1083, 1086, 1089, 1092, 1095, 1098, 1101, 1104, 1107, 1110, 1113,
+      1116, 1119, 1122, 1125, 1128, 1131, 1134, 1137, 1140, 1143, 1146, 1149,
+      1152
+   };
+   constexpr int m_simple_rcube_half_tri_obj_faceIndex[] =
+   {
+      0, 1, 2, 3, 4, 0, 5, 6, 3, 7, 8, 5,
+      4, 9, 1, 6, 10, 4, 8, 11, 6, 12, 13, 8,
+      10, 14, 9, 11, 15, 10, 13, 16, 11, 17, 18, 13,
+      15, 19, 14, 16, 20, 15, 18, 21, 16, 22, 23, 18,
+      20, 24, 19, 21, 25, 20, 23, 26, 21, 27, 28, 23,
+      25, 29, 24, 26, 30, 25, 28, 31, 26, 32, 33, 28,
+      30, 34, 29, 31, 35, 30, 31, 36, 37, 33, 38, 36,
+      35, 39, 34, 37, 40, 35, 37, 41, 42, 36, 43, 41,
+      7, 44, 12, 45, 46, 44, 47, 46, 48, 49, 50, 47,
+      51, 52, 49, 53, 54, 51, 55, 56, 53, 57, 58, 55,
+      12, 59, 17, 44, 60, 59, 50, 60, 46, 52, 61, 50,
+      54, 62, 52, 56, 63, 54, 58, 64, 56, 65, 66, 58,
+      59, 22, 17, 60, 67, 59, 61, 68, 60, 62, 69, 61,
+      63, 70, 62, 64, 71, 63, 66, 72, 64, 73, 74, 66,
+      67, 27, 22, 68, 75, 67, 69, 76, 68, 70, 77, 69,
+      71, 78, 70, 72, 79, 71, 74, 80, 72, 81, 82, 74,
+      75, 32, 27, 76, 83, 75, 77, 84, 76, 78, 85, 77,
+      79, 86, 78, 80, 87, 79, 82, 88, 80, 89, 90, 82,
+      83, 91, 32, 84, 92, 83, 85, 93, 84, 86, 94, 85,
+      87, 95, 86, 88, 96, 87, 90, 97, 88, 98, 99, 90,
+      92, 38, 91, 93, 100, 92, 94, 101, 93, 95, 102, 94,
+      96, 103, 95, 97, 104, 96, 97, 105, 106, 99, 107, 105,
+      100, 43, 38, 101, 108, 100, 102, 109, 101, 103, 110, 102,
+      104, 111, 103, 106, 112, 104, 106, 113, 114, 105, 115, 113,
+      57, 116, 65, 117, 118, 116, 119, 118, 120, 121, 122, 119,
+      65, 123, 73, 116, 124, 123, 122, 124, 118, 125, 126, 122,
+      123, 81, 73, 124, 127, 123, 126, 128, 124, 129, 130, 126,
+      127, 89, 81, 128, 131, 127, 130, 132, 128, 133, 134, 130,
+      131, 98, 89, 132, 135, 131, 134, 136, 132, 137, 138, 134,
+      135, 139, 98, 136, 140, 135, 138, 141, 136, 142, 143, 138,
+      140, 107, 139, 141, 144, 140, 143, 145, 141, 146, 147, 143,
+      144, 115, 107, 145, 148, 144, 147, 149, 145, 150, 151, 147,
+      119, 152, 121, 120, 153, 119, 117, 154, 120, 57, 155, 117,
+      153, 156, 152, 154, 157, 153, 155, 158, 154, 55, 159, 155,
+      157, 160, 156, 158, 161, 157, 159, 162, 158, 53, 163, 159,
+      161, 164, 160, 162, 165, 161, 163, 166, 162, 51, 167, 163,
+      165, 168, 164, 166, 169, 165, 167, 170, 166, 49, 171, 167,
+      169, 172, 168, 170, 173, 169, 171, 174, 170, 47, 175, 171,
+      173, 176, 172, 174, 177, 173, 174, 178, 179, 175, 45, 178,
+      177, 2, 176, 179, 0, 177, 179, 5, 3, 178, 7, 5,
+      40, 180, 39, 42, 181, 40, 41, 182, 42, 43, 183, 41,
+      181, 184, 180, 182, 185, 181, 183, 186, 182, 108, 187, 183,
+      185, 188, 184, 186, 189, 185, 187, 190, 186, 109, 191, 187,
+      189, 192, 188, 190, 193, 189, 191, 194, 190, 110, 195, 191,
+      193, 196, 192, 194, 197, 193, 195, 198, 194, 111, 199, 195,
+      197, 200, 196, 198, 201, 197, 199, 202, 198, 112, 203, 199,
+      201, 204, 200, 202, 205, 201, 202, 206, 207, 203, 113, 206,
+      205, 208, 204, 207, 151, 205, 207, 148, 149, 206, 115, 148,
+      0, 4, 1, 3, 6, 4, 5, 8, 6, 7, 12, 8,
+      4, 10, 9, 6, 11, 10, 8, 13, 11, 12, 17, 13,
+      10, 15, 14, 11, 16, 15, 13, 18, 16, 17, 22, 18,
+      15, 20, 19, 16, 21, 20, 18, 23, 21, 22, 27, 23,
+      20, 25, 24, 21, 26, 25, 23, 28, 26, 27, 32, 28,
+      25, 30, 29, 26, 31, 30, 28, 33, 31, 32, 91, 33,
+      30, 35, 34, 31, 37, 35, 31, 33, 36, 33, 91, 38,
+      35, 40, 39, 37, 42, 40, 37, 36, 41, 36, 38, 43,
+      7, 45, 44, 45, 48, 46, 47, 50, 46, 49, 52, 50,
+      51, 54, 52, 53, 56, 54, 55, 58, 56, 57, 65, 58,
+      12, 44, 59, 44, 46, 60, 50, 61, 60, 52, 62, 61,
+      54, 63, 62, 56, 64, 63, 58, 66, 64, 65, 73, 66,
+      59, 67, 22, 60, 68, 67, 61, 69, 68, 62, 70, 69,
+      63, 71, 70, 64, 72, 71, 66, 74, 72, 73, 81, 74,
+      67, 75, 27, 68, 76, 75, 69, 77, 76, 70, 78, 77,
+      71, 79, 78, 72, 80, 79, 74, 82, 80, 81, 89, 82,
+      75, 83, 32, 76, 84, 83, 77, 85, 84, 78, 86, 85,
+      79, 87, 86, 80, 88, 87, 82, 90, 88, 89, 98, 90,
+      83, 92, 91, 84, 93, 92, 85, 94, 93, 86, 95, 94,
+      87, 96, 95, 88, 97, 96, 90, 99, 97, 98, 139, 99,
+      92, 100, 38, 93, 101, 100, 94, 102, 101, 95, 103, 102,
+      96, 104, 103, 97, 106, 104, 97, 99, 105, 99, 139, 107,
+      100, 108, 43, 101, 109, 108, 102, 110, 109, 103, 111, 110,
+      104, 112, 111, 106, 114, 112, 106, 105, 113, 105, 107, 115,
+      57, 117, 116, 117, 120, 118, 119, 122, 118, 121, 125, 122,
+      65, 116, 123, 116, 118, 124, 122, 126, 124, 125, 129, 126,
+      123, 127, 81, 124, 128, 127, 126, 130, 128, 129, 133, 130,
+      127, 131, 89, 128, 132, 131, 130, 134, 132, 133, 137, 134,
+      131, 135, 98, 132, 136, 135, 134, 138, 136, 137, 142, 138,
+      135, 140, 139, 136, 141, 140, 138, 143, 141, 142, 146, 143,
+      140, 144, 107, 141, 145, 144, 143, 147, 145, 146, 150, 147,
+      144, 148, 115, 145, 149, 148, 147, 151, 149, 150, 208, 151,
+      119, 153, 152, 120, 154, 153, 117, 155, 154, 57, 55, 155,
+      153, 157, 156, 154, 158, 157, 155, 159, 158, 55, 53, 159,
+      157, 161, 160, 158, 162, 161, 159, 163, 162, 53, 51, 163,
+      161, 165, 164, 162, 166, 165, 163, 167, 166, 51, 49, 167,
+      165, 169, 168, 166, 170, 169, 167, 171, 170, 49, 47, 171,
+      169, 173, 172, 170, 174, 173, 171, 175, 174, 47, 48, 175,
+      173, 177, 176, 174, 179, 177, 174, 175, 178, 175, 48, 45,
+      177, 0, 2, 179, 3, 0, 179, 178, 5, 178, 45, 7,
+      40, 181, 180, 42, 182, 181, 41, 183, 182, 43, 108, 183,
+      181, 185, 184, 182, 186, 185, 183, 187, 186, 108, 109, 187,
+      185, 189, 188, 186, 190, 189, 187, 191, 190, 109, 110, 191,
+      189, 193, 192, 190, 194, 193, 191, 195, 194, 110, 111, 195,
+      193, 197, 196, 194, 198, 197, 195, 199, 198, 111, 112, 199,
+      197, 201, 200, 198, 202, 201, 199, 203, 202, 112, 114, 203,
+      201, 205, 204, 202, 207, 205, 202, 203, 206, 203, 114, 113,
+      205, 151, 208, 207, 149, 151, 207, 206, 148, 206, 113, 115
+   };
+
+   // square.obj
+   constexpr float m_square_obj_vertex[] =
+   {
+      1.0f, 1.0f, 0.0f, 1.0f, 2.0f, 0.0f,
+      1.0f, 3.0f, 0.0f, 1.0f, 4.0f, 0.0f,
+      1.0f, 5.0f, 0.0f, 1.0f, 6.0f, 0.0f,
+      1.0f, 7.0f, 0.0f, 1.0f, 8.0f, 0.0f,
+      1.0f, 9.0f, 0.0f, 1.0f, 10.0f, 0.0f,
+      1.0f, 11.0f, 0.0f, 1.0f, 12.0f, 0.0f,
+      1.0f, 13.0f, 0.0f, 1.0f, 14.0f, 0.0f,
+      1.0f, 15.0f, 0.0f, 1.0f, 16.0f, 0.0f,
+      1.0f, 17.0f, 0.0f, 1.0f, 18.0f, 0.0f,
+      1.0f, 19.0f, 0.0f, 1.0f, 20.0f, 0.0f,
+      2.0f, 1.0f, 0.0f, 2.0f, 2.0f, 0.0f,
+      2.0f, 3.0f, 0.0f, 2.0f, 4.0f, 0.0f,
+      2.0f, 5.0f, 0.0f, 2.0f, 6.0f, 0.0f,
+      2.0f, 7.0f, 0.0f, 2.0f, 8.0f, 0.0f,
+      2.0f, 9.0f, 0.0f, 2.0f, 10.0f, 0.0f,
+      2.0f, 11.0f, 0.0f, 2.0f, 12.0f, 0.0f,
+      2.0f, 13.0f, 0.0f, 2.0f, 14.0f, 0.0f,
+      2.0f, 15.0f, 0.0f, 2.0f, 16.0f, 0.0f,
+      2.0f, 17.0f, 0.0f, 2.0f, 18.0f, 0.0f,
+      2.0f, 19.0f, 0.0f, 2.0f, 20.0f, 0.0f,
+      3.0f, 1.0f, 0.0f, 3.0f, 2.0f, 0.0f,
+      3.0f, 3.0f, 0.0f, 3.0f, 4.0f, 0.0f,
+      3.0f, 5.0f, 0.0f, 3.0f, 6.0f, 0.0f,
+      3.0f, 7.0f, 0.0f, 3.0f, 8.0f, 0.0f,
+      3.0f, 9.0f, 0.0f, 3.0f, 10.0f, 0.0f,
+      3.0f, 11.0f, 0.0f, 3.0f, 12.0f, 0.0f,
+      3.0f, 13.0f, 0.0f, 3.0f, 14.0f, 0.0f,
+      3.0f, 15.0f, 0.0f, 3.0f, 16.0f, 0.0f,
+      3.0f, 17.0f, 0.0f, 3.0f, 18.0f, 0.0f,
+      3.0f, 19.0f, 0.0f, 3.0f, 20.0f, 0.0f,
+      4.0f, 1.0f, 0.0f, 4.0f, 2.0f, 0.0f,
+      4.0f, 3.0f, 0.0f, 4.0f, 4.0f, 0.0f,
+      4.0f, 5.0f, 0.0f, 4.0f, 6.0f, 0.0f,
+      4.0f, 7.0f, 0.0f, 4.0f, 8.0f, 0.0f,
+      4.0f, 9.0f, 0.0f, 4.0f, 10.0f, 0.0f,
+      4.0f, 11.0f, 0.0f, 4.0f, 12.0f, 0.0f,
+      4.0f, 13.0f, 0.0f, 4.0f, 14.0f, 0.0f,
+      4.0f, 15.0f, 0.0f, 4.0f, 16.0f, 0.0f,
+      4.0f, 17.0f, 0.0f, 4.0f, 18.0f, 0.0f,
+      4.0f, 19.0f, 0.0f, 4.0f, 20.0f, 0.0f,
+      5.0f, 1.0f, 0.0f, 5.0f, 2.0f, 0.0f,
+      5.0f, 3.0f, 0.0f, 5.0f, 4.0f, 0.0f,
+      5.0f, 5.0f, 0.0f, 5.0f, 6.0f, 0.0f,
+      5.0f, 7.0f, 0.0f, 5.0f, 8.0f, 0.0f,
+      5.0f, 9.0f, 0.0f, 5.0f, 10.0f, 0.0f,
+      5.0f, 11.0f, 0.0f, 5.0f, 12.0f, 0.0f,
+      5.0f, 13.0f, 0.0f, 5.0f, 14.0f, 0.0f,
+      5.0f, 15.0f, 0.0f, 5.0f, 16.0f, 0.0f,
+      5.0f, 17.0f, 0.0f, 5.0f, 18.0f, 0.0f,
+      5.0f, 19.0f, 0.0f, 5.0f, 20.0f, 0.0f,
+      6.0f, 1.0f, 0.0f, 6.0f, 2.0f, 0.0f,
+      6.0f, 3.0f, 0.0f, 6.0f, 4.0f, 0.0f,
+      6.0f, 5.0f, 0.0f, 6.0f, 6.0f, 0.0f,
+      6.0f, 7.0f, 0.0f, 6.0f, 8.0f, 0.0f,
+      6.0f, 9.0f, 0.0f, 6.0f, 10.0f, 0.0f,
+      6.0f, 11.0f, 0.0f, 6.0f, 12.0f, 0.0f,
+      6.0f, 13.0f, 0.0f, 6.0f, 14.0f, 0.0f,
+      6.0f, 15.0f, 0.0f, 6.0f, 16.0f, 0.0f,
+      6.0f, 17.0f, 0.0f, 6.0f, 18.0f, 0.0f,
+      6.0f, 19.0f, 0.0f, 6.0f, 20.0f, 0.0f,
+      7.0f, 1.0f, 0.0f, 7.0f, 2.0f, 0.0f,
+      7.0f, 3.0f, 0.0f, 7.0f, 4.0f, 0.0f,
+      7.0f, 5.0f, 0.0f, 7.0f, 6.0f, 0.0f,
+      7.0f, 7.0f, 0.0f, 7.0f, 8.0f, 0.0f,
+      7.0f, 9.0f, 0.0f, 7.0f, 10.0f, 0.0f,
+      7.0f, 11.0f, 0.0f, 7.0f, 12.0f, 0.0f,
+      7.0f, 13.0f, 0.0f, 7.0f, 14.0f, 0.0f,
+      7.0f, 15.0f, 0.0f, 7.0f, 16.0f, 0.0f,
+      7.0f, 17.0f, 0.0f, 7.0f, 18.0f, 0.0f,
+      7.0f, 19.0f, 0.0f, 7.0f, 20.0f, 0.0f,
+      8.0f, 1.0f, 0.0f, 8.0f, 2.0f, 0.0f,
+      8.0f, 3.0f, 0.0f, 8.0f, 4.0f, 0.0f,
+      8.0f, 5.0f, 0.0f, 8.0f, 6.0f, 0.0f,
+      8.0f, 7.0f, 0.0f, 8.0f, 8.0f, 0.0f,
+      8.0f, 9.0f, 0.0f, 8.0f, 10.0f, 0.0f,
+      8.0f, 11.0f, 0.0f, 8.0f, 12.0f, 0.0f,
+      8.0f, 13.0f, 0.0f, 8.0f, 14.0f, 0.0f,
+      8.0f, 15.0f, 0.0f, 8.0f, 16.0f, 0.0f,
+      8.0f, 17.0f, 0.0f, 8.0f, 18.0f, 0.0f,
+      8.0f, 19.0f, 0.0f, 8.0f, 20.0f, 0.0f,
+      9.0f, 1.0f, 0.0f, 9.0f, 2.0f, 0.0f,
+      9.0f, 3.0f, 0.0f, 9.0f, 4.0f, 0.0f,
+      9.0f, 5.0f, 0.0f, 9.0f, 6.0f, 0.0f,
+      9.0f, 7.0f, 0.0f, 9.0f, 8.0f, 0.0f,
+      9.0f, 9.0f, 0.0f, 9.0f, 10.0f, 0.0f,
+      9.0f, 11.0f, 0.0f, 9.0f, 12.0f, 0.0f,
+      9.0f, 13.0f, 0.0f, 9.0f, 14.0f, 0.0f,
+      9.0f, 15.0f, 0.0f, 9.0f, 16.0f, 0.0f,
+      9.0f, 17.0f, 0.0f, 9.0f, 18.0f, 0.0f,
+      9.0f, 19.0f, 0.0f, 9.0f, 20.0f, 0.0f,
+      10.0f, 1.0f, 0.0f, 10.0f, 2.0f, 0.0f,
+      10.0f, 3.0f, 0.0f, 10.0f, 4.0f, 0.0f,
+      10.0f, 5.0f, 0.0f, 10.0f, 6.0f, 0.0f,
+      10.0f, 7.0f, 0.0f, 10.0f, 8.0f, 0.0f,
+      10.0f, 9.0f, 0.0f, 10.0f, 10.0f, 0.0f,
+      10.0f, 11.0f, 0.0f, 10.0f, 12.0f, 0.0f,
+      10.0f, 13.0f, 0.0f, 10.0f, 14.0f, 0.0f,
+      10.0f, 15.0f, 0.0f, 10.0f, 16.0f, 0.0f,
+      10.0f, 17.0f, 0.0f, 10.0f, 18.0f, 0.0f,
+      10.0f, 19.0f, 0.0f, 10.0f, 20.0f, 0.0f,
+      11.0f, 1.0f, 0.0f, 11.0f, 2.0f, 0.0f,
+      11.0f, 3.0f, 0.0f, 11.0f, 4.0f, 0.0f,
+      11.0f, 5.0f, 0.0f, 11.0f, 6.0f, 0.0f,
+      11.0f, 7.0f, 0.0f, 11.0f, 8.0f, 0.0f,
+      11.0f, 9.0f, 0.0f, 11.0f, 10.0f, 0.0f,
+      11.0f, 11.0f, 0.0f, 11.0f, 12.0f, 0.0f,
+      11.0f, 13.0f, 0.0f, 11.0f, 14.0f, 0.0f,
+      11.0f, 15.0f, 0.0f, 11.0f, 16.0f, 0.0f,
+      11.0f, 17.0f, 0.0f, 11.0f, 18.0f, 0.0f,
+      11.0f, 19.0f, 0.0f, 11.0f, 20.0f, 0.0f,
+      12.0f, 1.0f, 0.0f, 12.0f, 2.0f, 0.0f,
+      12.0f, 3.0f, 0.0f, 12.0f, 4.0f, 0.0f,
+      12.0f, 5.0f, 0.0f, 12.0f, 6.0f, 0.0f,
+      12.0f, 7.0f, 0.0f, 12.0f, 8.0f, 0.0f,
+      12.0f, 9.0f, 0.0f, 12.0f, 10.0f, 0.0f,
+      12.0f, 11.0f, 0.0f, 12.0f, 12.0f, 0.0f,
+      12.0f, 13.0f, 0.0f, 12.0f, 14.0f, 0.0f,
+      12.0f, 15.0f, 0.0f, 12.0f, 16.0f, 0.0f,
+      12.0f, 17.0f, 0.0f, 12.0f, 18.0f, 0.0f,
+      12.0f, 19.0f, 0.0f, 12.0f, 20.0f, 0.0f,
+      13.0f, 1.0f, 0.0f, 13.0f, 2.0f, 0.0f,
+      13.0f, 3.0f, 0.0f, 13.0f, 4.0f, 0.0f,
+      13.0f, 5.0f, 0.0f, 13.0f, 6.0f, 0.0f,
+      13.0f, 7.0f, 0.0f, 13.0f, 8.0f, 0.0f,
+      13.0f, 9.0f, 0.0f, 13.0f, 10.0f, 0.0f,
+      13.0f, 11.0f, 0.0f, 13.0f, 12.0f, 0.0f,
+      13.0f, 13.0f, 0.0f, 13.0f, 14.0f, 0.0f,
+      13.0f, 15.0f, 0.0f, 13.0f, 16.0f, 0.0f,
+      13.0f, 17.0f, 0.0f, 13.0f, 18.0f, 0.0f,
+      13.0f, 19.0f, 0.0f, 13.0f, 20.0f, 0.0f,
+      14.0f, 1.0f, 0.0f, 14.0f, 2.0f, 0.0f,
+      14.0f, 3.0f, 0.0f, 14.0f, 4.0f, 0.0f,
+      14.0f, 5.0f, 0.0f, 14.0f, 6.0f, 0.0f,
+      14.0f, 7.0f, 0.0f, 14.0f, 8.0f, 0.0f,
+      14.0f, 9.0f, 0.0f, 14.0f, 10.0f, 0.0f,
+      14.0f, 11.0f, 0.0f, 14.0f, 12.0f, 0.0f,
+      14.0f, 13.0f, 0.0f, 14.0f, 14.0f, 0.0f,
+      14.0f, 15.0f, 0.0f, 14.0f, 16.0f, 0.0f,
+      14.0f, 17.0f, 0.0f, 14.0f, 18.0f, 0.0f,
+      14.0f, 19.0f, 0.0f, 14.0f, 20.0f, 0.0f,
+      15.0f, 1.0f, 0.0f, 15.0f, 2.0f, 0.0f,
+      15.0f, 3.0f, 0.0f, 15.0f, 4.0f, 0.0f,
+      15.0f, 5.0f, 0.0f, 15.0f, 6.0f, 0.0f,
+      15.0f, 7.0f, 0.0f, 15.0f, 8.0f, 0.0f,
+      15.0f, 9.0f, 0.0f, 15.0f, 10.0f, 0.0f,
+      15.0f, 11.0f, 0.0f, 15.0f, 12.0f, 0.0f,
+      15.0f, 13.0f, 0.0f, 15.0f, 14.0f, 0.0f,
+      15.0f, 15.0f, 0.0f, 15.0f, 16.0f, 0.0f,
+      15.0f, 17.0f, 0.0f, 15.0f, 18.0f, 0.0f,
+      15.0f, 19.0f, 0.0f, 15.0f, 20.0f, 0.0f,
+      16.0f, 1.0f, 0.0f, 16.0f, 2.0f, 0.0f,
+      16.0f, 3.0f, 0.0f, 16.0f, 4.0f, 0.0f,
+      16.0f, 5.0f, 0.0f, 16.0f, 6.0f, 0.0f,
+      16.0f, 7.0f, 0.0f, 16.0f, 8.0f, 0.0f,
+      16.0f, 9.0f, 0.0f, 16.0f, 10.0f, 0.0f,
+      16.0f, 11.0f, 0.0f, 16.0f, 12.0f, 0.0f,
+      16.0f, 13.0f, 0.0f, 16.0f, 14.0f, 0.0f,
+      16.0f, 15.0f, 0.0f, 16.0f, 16.0f, 0.0f,
+      16.0f, 17.0f, 0.0f, 16.0f, 18.0f, 0.0f,
+      16.0f, 19.0f, 0.0f, 16.0f, 20.0f, 0.0f,
+      17.0f, 1.0f, 0.0f, 17.0f, 2.0f, 0.0f,
+      17.0f, 3.0f, 0.0f, 17.0f, 4.0f, 0.0f,
+      17.0f, 5.0f, 0.0f, 17.0f, 6.0f, 0.0f,
+      17.0f, 7.0f, 0.0f, 17.0f, 8.0f, 0.0f,
+      17.0f, 9.0f, 0.0f, 17.0f, 10.0f, 0.0f,
+      17.0f, 11.0f, 0.0f, 17.0f, 12.0f, 0.0f,
+      17.0f, 13.0f, 0.0f, 17.0f, 14.0f, 0.0f,
+      17.0f, 15.0f, 0.0f, 17.0f, 16.0f, 0.0f,
+      17.0f, 17.0f, 0.0f, 17.0f, 18.0f, 0.0f,
+      17.0f, 19.0f, 0.0f, 17.0f, 20.0f, 0.0f,
+      18.0f, 1.0f, 0.0f, 18.0f, 2.0f, 0.0f,
+      18.0f, 3.0f, 0.0f, 18.0f, 4.0f, 0.0f,
+      18.0f, 5.0f, 0.0f, 18.0f, 6.0f, 0.0f,
+      18.0f, 7.0f, 0.0f, 18.0f, 8.0f, 0.0f,
+      18.0f, 9.0f, 0.0f, 18.0f, 10.0f, 0.0f,
+      18.0f, 11.0f, 0.0f, 18.0f, 12.0f, 0.0f,
+      18.0f, 13.0f, 0.0f, 18.0f, 14.0f, 0.0f,
+      18.0f, 15.0f, 0.0f, 18.0f, 16.0f, 0.0f,
+      18.0f, 17.0f, 0.0f, 18.0f, 18.0f, 0.0f,
+      18.0f, 19.0f, 0.0f, 18.0f, 20.0f, 0.0f,
+      19.0f, 1.0f, 0.0f, 19.0f, 2.0f, 0.0f,
+      19.0f, 3.0f, 0.0f, 19.0f, 4.0f, 0.0f,
+      19.0f, 5.0f, 0.0f, 19.0f, 6.0f, 0.0f,
+      19.0f, 7.0f, 0.0f, 19.0f, 8.0f, 0.0f,
+      19.0f, 9.0f, 0.0f, 19.0f, 10.0f, 0.0f,
+      19.0f, 11.0f, 0.0f, 19.0f, 12.0f, 0.0f,
+      19.0f, 13.0f, 0.0f, 19.0f, 14.0f, 0.0f,
+      19.0f, 15.0f, 0.0f, 19.0f, 16.0f, 0.0f,
+      19.0f, 17.0f, 0.0f, 19.0f, 18.0f, 0.0f,
+      19.0f, 19.0f, 0.0f, 19.0f, 20.0f, 0.0f,
+      20.0f, 1.0f, 0.0f, 20.0f, 2.0f, 0.0f,
+      20.0f, 3.0f, 0.0f, 20.0f, 4.0f, 0.0f,
+      20.0f, 5.0f, 0.0f, 20.0f, 6.0f, 0.0f,
+      20.0f, 7.0f, 0.0f, 20.0f, 8.0f, 0.0f,
+      20.0f, 9.0f, 0.0f, 20.0f, 10.0f, 0.0f,
+      20.0f, 11.0f, 0.0f, 20.0f, 12.0f, 0.0f,
+      20.0f, 13.0f, 0.0f, 20.0f, 14.0f, 0.0f,
+      20.0f, 15.0f, 0.0f, 20.0f, 16.0f, 0.0f,
+      20.0f, 17.0f, 0.0f, 20.0f, 18.0f, 0.0f,
+      20.0f, 19.0f, 0.0f, 20.0f, 20.0f, 0.0f
+   };
+   constexpr int m_square_obj_faceStart[] =
+   {
+      0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33,
+      36, 39, 42, 45, 48, 51, 54, 57, 60, 63, 66, 69,
+      72, 75, 78, 81, 84, 87, 90, 93, 96, 99, 102, 105,
+      108, 111, 114, 117, 120, 123, 126, 129, 132, 135, 138, 141,
+      144, 147, 150, 153, 156, 159, 162, 165, 168, 171, 174, 177,
+      180, 183, 186, 189, 192, 195, 198, 201, 204, 207, 210, 213,
+      216, 219, 222, 225, 228, 231, 234, 237, 240, 243, 246, 249,
+      252, 255, 258, 261, 264, 267, 270, 273, 276, 279, 282, 285,
+      288, 291, 294, 297, 300, 303, 306, 309, 312, 315, 318, 321,
+      324, 327, 330, 333, 336, 339, 342, 345, 348, 351, 354, 357,
+      360, 363, 366, 369, 372, 375, 378, 381, 384, 387, 390, 393,
+      396, 399, 402, 405, 408, 411, 414, 417, 420, 423, 426, 429,
+      432, 435, 438, 441, 444, 447, 450, 453, 456, 459, 462, 465,
+      468, 471, 474, 477, 480, 483, 486, 489, 492, 495, 498, 501,
+      504, 507, 510, 513, 516, 519, 522, 525, 528, 531, 534, 537,
+      540, 543, 546, 549, 552, 555, 558, 561, 564, 567, 570, 573,
+      576, 579, 582, 585, 588, 591, 594, 597, 600, 603, 606, 609,
+      612, 615, 618, 621, 624, 627, 630, 633, 636, 639, 642, 645,
+      648, 651, 654, 657, 660, 663, 666, 669, 672, 675, 678, 681,
+      684, 687, 690, 693, 696, 699, 702, 705, 708, 711, 714, 717,
+      720, 723, 726, 729, 732, 735, 738, 741, 744, 747, 750, 753,
+      756, 759, 762, 765, 768, 771, 774, 777, 780, 783, 786, 789,
+      792, 795, 798, 801, 804, 807, 810, 813, 816, 819, 822, 825,
+      828, 831, 834, 837, 840, 843, 846, 849, 852, 855, 858, 861,
+      864, 867, 870, 873, 876, 879, 882, 885, 888, 891, 894, 897,
+      900, 903, 906, 909, 912, 915, 918, 921, 924, 927, 930, 933,
+      936, 939, 942, 945, 948, 951, 954, 957, 960, 963, 966, 969,
+      972, 975, 978, 981, 984, 987, 990, 993, 996, 999, 1002, 1005,
+      1008, 1011, 1014, 1017, 1020, 1023, 1026, 1029, 1032, 1035, 1038, 1041,
+      1044, 1047, 1050, 1053, 1056, 1059, 1062, 1065, 1068, 1071, 1074, 1077,
+      1080, 1083, 1086, 1089, 1092, 1095, 1098, 1101, 1104, 1107, 1110, 1113,
+      1116, 1119, 1122, 1125, 1128, 1131, 1134, 1137, 1140, 1143, 1146, 1149,
+      1152, 1155, 1158, 1161, 1164, 1167, 1170, 1173, 1176, 1179, 1182, 1185,
+      1188, 1191, 1194, 1197, 1200, 1203, 1206, 1209, 1212, 1215, 1218, 1221,
+      1224, 1227, 1230, 1233, 1236, 1239, 1242, 1245, 1248, 1251, 1254, 1257,
+      1260, 1263, 1266, 1269, 1272, 1275, 1278, 1281, 1284, 1287, 1290, 1293,
+      1296, 1299, 1302, 1305, 1308, 1311, 1314, 1317, 1320, 1323, 1326, 1329,
+      1332, 1335, 1338, 1341, 1344, 1347, 1350, 1353, 1356, 1359, 1362, 1365,
+      1368, 1371, 1374, 1377, 1380, 1383, 1386, 1389, 1392, 1395, 1398, 1401,
+      1404, 1407, 1410, 1413, 1416, 1419, 1422, 1425, 1428, 1431, 1434, 1437,
+      1440, 1443, 1446, 1449, 1452, 1455, 1458, 1461, 1464, 1467, 1470, 1473,
+      1476, 1479, 1482, 1485, 1488, 1491, 1494, 1497, 1500, 1503, 1506, 1509,
+      1512, 1515, 1518, 1521, 1524, 1527, 1530, 1533, 1536, 1539, 1542, 1545,
+      1548, 1551, 1554, 1557, 1560, 1563, 1566, 1569, 1572, 1575, 1578, 1581,
+      1584, 1587, 1590, 1593, 1596, 1599, 1602, 1605, 1608, 1611, 1614, 1617,
+      1620, 1623, 1626, 1629, 1632, 1635, 1638, 1641, 1644, 1647, 1650, 1653,
+      1656, 1659, 1662, 1665, 1668, 1671, 1674, 1677, 1680, 1683, 1686, 1689,
+      1692, 1695, 1698, 1701, 1704, 1707, 1710, 1713, 1716, 1719, 1722, 1725,
+      1728, 1731, 1734, 1737, 1740, 1743, 1746, 1749, 1752, 1755, 1758, 1761,
+      1764, 1767, 1770, 1773, 1776, 1779, 1782, 1785, 1788, 1791, 1794, 1797,
+      1800, 1803, 1806, 1809, 1812, 1815, 1818, 1821, 1824, 1827, 1830, 1833,
+      1836, 1839, 1842, 1845, 1848, 1851, 1854, 1857, 1860, 1863, 1866, 1869,
+      1872, 1875, 1878, 1881, 1884, 1887, 1890, 1893, 1896, 1899, 1902, 1905,
+      1908, 1911, 1914, 1917, 1920, 1923, 1926, 1929, 1932, 1935, 1938, 1941,
+      1944, 1947, 1950, 1953, 1956, 1959, 1962, 1965, 1968, 1971, 1974, 1977,
+      1980, 1983, 1986, 1989, 1992, 1995, 1998, 2001, 2004, 2007, 2010, 2013,
+      2016, 2019, 2022, 2025, 2028, 2031, 2034, 2037, 2040, 2043, 2046, 2049,
+      2052, 2055, 2058, 2061, 2064, 2067, 2070, 2073, 2076, 2079, 2082, 2085,
+      2088, 2091, 2094, 2097, 2100, 2103, 2106, 2109, 2112, 2115, 2118, 2121,
+      2124, 2127, 2130, 2133, 2136, 2139, 2142, 2145, 2148, 2151, 2154, 2157,
+      2160, 2163, 2166
+   };
+   constexpr int m_square_obj_faceIndex[] =
+   {
+      96, 97, 77, 88, 108, 89, 331, 351, 332, 334, 333, 353,
+      349, 330, 329, 86, 105, 106, 47, 46, 66, 8, 7, 27,
+      32, 51, 52, 45, 65, 46, 251, 231, 250, 64, 63, 83,
+      228, 248, 229, 32, 31, 51, 114, 115, 95, 37, 38, 18,
+      57, 56, 76, 34, 33, 53, 271, 270, 290, 297, 277, 296,
+      217, 197, 216, 270, 271, 251, 152, 133, 132, 196, 177, 176,
+      333, 334, 314, 298, 318, 299, 375, 374, 394, 373, 353, 372,
+      353, 352, 372, 290, 291, 271, 273, 293, 274, 189, 209, 190,
+      204, 224, 205, 249, 268, 269, 244, 225, 224, 325, 305, 324,
+      64, 83, 84, 91, 90, 110, 183, 184, 164, 63, 62, 82,
+      24, 23, 43, 24, 4, 23, 83, 63, 82, 45, 46, 26,
+      127, 107, 126, 141, 161, 142, 223, 222, 242, 183, 164, 163,
+      144, 143, 163, 40, 21, 20, 1, 0, 20, 167, 148, 147,
+      145, 144, 164, 149, 148, 168, 188, 207, 208, 208, 209, 189,
+      190, 210, 191, 167, 187, 168, 186, 185, 205, 170, 190, 171,
+      213, 212, 232, 10, 9, 29, 66, 65, 85, 89, 69, 88,
+      88, 68, 87, 48, 28, 47, 27, 46, 47, 27, 26, 46,
+      29, 28, 48, 70, 50, 69, 11, 31, 12, 11, 10, 30,
+      13, 33, 14, 13, 12, 32, 56, 36, 55, 71, 51, 70,
+      16, 36, 17, 35, 34, 54, 78, 98, 79, 58, 57, 77,
+      38, 37, 57, 76, 96, 77, 136, 156, 137, 138, 137, 157,
+      236, 217, 216, 178, 198, 179, 179, 198, 199, 176, 157, 156,
+      136, 116, 135, 252, 251, 271, 113, 94, 93, 134, 114, 133,
+      54, 53, 73, 155, 175, 156, 113, 112, 132, 112, 111, 131,
+      150, 170, 151, 194, 195, 175, 230, 250, 231, 268, 248, 267,
+      270, 251, 250, 195, 214, 215, 294, 295, 275, 292, 312, 293,
+      291, 310, 311, 289, 308, 309, 254, 253, 273, 276, 296, 277,
+      198, 218, 199, 296, 295, 315, 275, 274, 294, 275, 256, 255,
+      316, 336, 317, 356, 355, 375, 337, 336, 356, 316, 296, 315,
+      338, 337, 357, 396, 377, 376, 354, 355, 335, 358, 357, 377,
+      314, 334, 315, 355, 374, 375, 332, 333, 313, 352, 353, 333,
+      373, 372, 392, 350, 331, 330, 374, 373, 393, 374, 354, 373,
+      370, 351, 350, 288, 308, 289, 328, 348, 329, 364, 345, 344,
+      329, 330, 310, 320, 321, 301, 331, 350, 351, 368, 369, 349,
+      227, 246, 247, 267, 287, 268, 210, 209, 229, 230, 231, 211,
+      285, 265, 284, 306, 307, 287, 269, 268, 288, 287, 307, 288,
+      307, 306, 326, 303, 302, 322, 187, 186, 206, 181, 182, 162,
+      226, 206, 225, 185, 165, 184, 203, 184, 183, 185, 166, 165,
+      202, 203, 183, 221, 201, 220, 244, 243, 263, 263, 282, 283,
+      261, 262, 242, 367, 387, 368, 306, 286, 305, 241, 240, 260,
+      345, 364, 365, 385, 365, 384, 324, 304, 323, 241, 261, 242,
+      24, 43, 44, 1, 20, 21, 62, 63, 43, 1, 21, 2,
+      61, 60, 80, 22, 21, 41, 45, 25, 44, 3, 2, 22,
+      44, 43, 63, 23, 22, 42, 3, 22, 23, 2, 21, 22,
+      43, 42, 62, 43, 23, 42, 22, 41, 42, 143, 123, 142,
+      42, 61, 62, 102, 121, 122, 123, 122, 142, 84, 65, 64,
+      103, 84, 83, 104, 105, 85, 62, 61, 81, 81, 100, 101,
+      40, 41, 21, 61, 42, 41, 41, 40, 60, 41, 60, 61,
+      62, 81, 82, 61, 80, 81, 81, 80, 100, 120, 101, 100,
+      82, 81, 101, 160, 161, 141, 123, 143, 124, 121, 120, 140,
+      121, 101, 120, 162, 161, 181, 160, 180, 161, 180, 181, 161,
+      201, 221, 202, 140, 141, 121, 140, 160, 141, 162, 182, 163,
+      201, 181, 200, 141, 142, 122, 126, 125, 145, 143, 162, 163,
+      142, 161, 162, 182, 183, 163, 203, 222, 223, 162, 143, 142,
+      163, 164, 144, 165, 145, 164, 125, 124, 144, 105, 124, 125,
+      143, 144, 124, 82, 102, 83, 121, 141, 122, 101, 102, 82,
+      101, 121, 102, 102, 103, 83, 102, 122, 103, 104, 123, 124,
+      103, 122, 123, 103, 104, 84, 103, 123, 104, 85, 105, 86,
+      104, 124, 105, 107, 106, 126, 105, 125, 106, 128, 127, 147,
+      106, 125, 126, 184, 165, 164, 146, 126, 145, 204, 185, 184,
+      205, 206, 186, 167, 186, 187, 166, 185, 186, 166, 146, 165,
+      125, 144, 145, 165, 146, 145, 167, 168, 148, 146, 147, 127,
+      146, 166, 147, 166, 167, 147, 166, 186, 167, 187, 188, 168,
+      187, 207, 188, 87, 107, 88, 147, 148, 128, 168, 169, 149,
+      168, 188, 169, 148, 129, 128, 132, 133, 113, 146, 127, 126,
+      108, 88, 107, 67, 47, 66, 86, 106, 87, 128, 108, 127,
+      87, 106, 107, 127, 108, 107, 128, 129, 109, 49, 48, 68,
+      28, 27, 47, 50, 49, 69, 30, 10, 29, 69, 68, 88,
+      69, 49, 68, 128, 109, 108, 92, 91, 111, 68, 67, 87,
+      85, 84, 104, 66, 85, 86, 65, 84, 85, 45, 64, 65,
+      44, 63, 64, 87, 67, 86, 46, 65, 66, 86, 67, 66,
+      68, 48, 67, 25, 45, 26, 44, 64, 45, 6, 5, 25,
+      4, 3, 23, 5, 4, 24, 25, 5, 24, 44, 25, 24,
+      26, 6, 25, 6, 26, 7, 8, 27, 28, 7, 26, 27,
+      67, 48, 47, 49, 29, 48, 8, 28, 9, 50, 30, 49,
+      9, 28, 29, 49, 30, 29, 31, 11, 30, 70, 51, 50,
+      31, 30, 50, 91, 72, 71, 31, 50, 51, 73, 53, 72,
+      33, 32, 52, 89, 70, 69, 93, 73, 92, 89, 90, 70,
+      149, 129, 148, 110, 111, 91, 151, 171, 152, 51, 71, 52,
+      70, 90, 71, 112, 92, 111, 71, 90, 91, 73, 72, 92,
+      52, 71, 72, 74, 73, 93, 74, 54, 73, 133, 114, 113,
+      72, 91, 92, 112, 93, 92, 94, 74, 93, 95, 76, 75,
+      53, 33, 52, 55, 54, 74, 55, 36, 35, 13, 32, 33,
+      12, 31, 32, 55, 35, 54, 14, 33, 34, 72, 53, 52,
+      54, 34, 53, 14, 34, 15, 15, 35, 16, 16, 35, 36,
+      15, 34, 35, 75, 76, 56, 57, 37, 56, 37, 18, 17,
+      38, 19, 18, 38, 39, 19, 38, 57, 58, 36, 37, 17,
+      36, 56, 37, 98, 99, 79, 39, 38, 58, 58, 59, 39,
+      58, 78, 59, 78, 77, 97, 98, 118, 99, 137, 117, 136,
+      59, 78, 79, 58, 77, 78, 97, 98, 78, 97, 117, 98,
+      119, 118, 138, 97, 96, 116, 57, 76, 77, 56, 55, 75,
+      74, 75, 55, 74, 94, 75, 76, 95, 96, 75, 94, 95,
+      134, 115, 114, 95, 94, 114, 116, 115, 135, 96, 95, 115,
+      154, 155, 135, 135, 115, 134, 153, 152, 172, 136, 117, 116,
+      155, 136, 135, 156, 157, 137, 97, 116, 117, 96, 115, 116,
+      99, 118, 119, 98, 117, 118, 138, 158, 139, 158, 178, 159,
+      158, 138, 157, 118, 117, 137, 119, 138, 139, 118, 137, 138,
+      176, 175, 195, 159, 139, 158, 159, 178, 179, 158, 157, 177,
+      178, 197, 198, 196, 215, 216, 178, 177, 197, 178, 158, 177,
+      177, 196, 197, 254, 234, 253, 176, 195, 196, 175, 174, 194,
+      157, 176, 177, 156, 175, 176, 136, 155, 156, 135, 134, 154,
+      193, 194, 174, 175, 155, 174, 173, 193, 174, 233, 213, 232,
+      191, 172, 171, 173, 154, 153, 191, 192, 172, 174, 154, 173,
+      172, 192, 173, 232, 231, 251, 192, 193, 173, 192, 211, 212,
+      133, 153, 134, 174, 155, 154, 94, 113, 114, 93, 112, 113,
+      130, 150, 131, 171, 172, 152, 131, 151, 132, 172, 173, 153,
+      134, 153, 154, 133, 152, 153, 132, 151, 152, 150, 149, 169,
+      112, 131, 132, 111, 110, 130, 89, 109, 90, 89, 108, 109,
+      109, 110, 90, 109, 129, 110, 111, 130, 131, 110, 129, 130,
+      170, 150, 169, 130, 129, 149, 131, 150, 151, 130, 149, 150,
+      171, 190, 191, 189, 188, 208, 189, 170, 169, 171, 151, 170,
+      170, 189, 190, 169, 188, 189, 211, 210, 230, 190, 209, 210,
+      191, 211, 192, 191, 210, 211, 192, 212, 193, 211, 231, 212,
+      229, 230, 210, 229, 249, 230, 230, 249, 250, 229, 248, 249,
+      249, 269, 250, 289, 290, 270, 271, 272, 252, 271, 291, 272,
+      231, 232, 212, 252, 272, 253, 251, 252, 232, 273, 274, 254,
+      233, 253, 234, 233, 252, 253, 216, 215, 235, 213, 194, 193,
+      272, 273, 253, 272, 291, 292, 293, 294, 274, 313, 333, 314,
+      255, 235, 254, 214, 194, 213, 252, 233, 232, 233, 214, 213,
+      212, 213, 193, 233, 234, 214, 215, 214, 234, 195, 194, 214,
+      235, 215, 234, 196, 195, 215, 236, 216, 235, 197, 196, 216,
+      254, 235, 234, 255, 236, 235, 277, 258, 257, 237, 217, 236,
+      218, 217, 237, 236, 256, 237, 238, 218, 237, 198, 197, 217,
+      199, 218, 219, 198, 217, 218, 218, 238, 219, 258, 278, 259,
+      257, 258, 238, 239, 219, 238, 238, 258, 239, 238, 237, 257,
+      297, 278, 277, 258, 277, 278, 239, 258, 259, 279, 278, 298,
+      259, 278, 279, 318, 298, 317, 299, 279, 298, 298, 297, 317,
+      276, 256, 275, 256, 257, 237, 256, 276, 257, 274, 255, 254,
+      256, 236, 255, 274, 275, 255, 295, 296, 276, 295, 276, 275,
+      277, 257, 276, 294, 314, 295, 335, 336, 316, 335, 316, 315,
+      317, 297, 316, 334, 335, 315, 334, 354, 335, 397, 377, 396,
+      358, 339, 338, 316, 297, 296, 298, 278, 297, 337, 318, 317,
+      319, 299, 318, 318, 338, 319, 336, 337, 317, 357, 358, 338,
+      319, 338, 339, 318, 337, 338, 377, 378, 358, 379, 359, 378,
+      358, 359, 339, 358, 378, 359, 378, 398, 379, 398, 378, 397,
+      399, 379, 398, 356, 376, 357, 397, 378, 377, 396, 376, 395,
+      377, 357, 376, 337, 356, 357, 336, 335, 355, 336, 355, 356,
+      354, 374, 355, 376, 375, 395, 376, 356, 375, 311, 331, 312,
+      352, 333, 332, 354, 353, 373, 354, 334, 353, 373, 392, 393,
+      372, 391, 392, 375, 394, 395, 374, 393, 394, 295, 314, 315,
+      294, 293, 313, 272, 292, 273, 312, 313, 293, 273, 292, 293,
+      291, 311, 292, 294, 313, 314, 312, 332, 313, 312, 331, 332,
+      368, 348, 367, 311, 330, 331, 328, 308, 327, 292, 311, 312,
+      310, 330, 311, 309, 290, 289, 310, 291, 290, 310, 309, 329,
+      310, 290, 309, 308, 328, 309, 348, 349, 329, 391, 371, 390,
+      351, 352, 332, 370, 371, 351, 371, 352, 351, 372, 371, 391,
+      372, 352, 371, 389, 370, 369, 350, 330, 349, 349, 369, 350,
+      390, 371, 370, 327, 346, 347, 387, 388, 368, 369, 368, 388,
+      349, 348, 368, 389, 369, 388, 370, 350, 369, 390, 370, 389,
+      366, 386, 367, 326, 325, 345, 386, 366, 385, 325, 306, 305,
+      347, 346, 366, 365, 385, 366, 386, 387, 367, 304, 305, 285,
+      286, 287, 267, 344, 345, 325, 325, 326, 306, 323, 343, 324,
+      347, 366, 367, 324, 344, 325, 365, 366, 346, 365, 346, 345,
+      327, 307, 326, 326, 346, 327, 326, 345, 346, 348, 347, 367,
+      348, 328, 347, 308, 307, 327, 308, 288, 307, 309, 328, 329,
+      327, 347, 328, 265, 246, 245, 247, 228, 227, 288, 268, 287,
+      247, 246, 266, 289, 269, 288, 249, 248, 268, 270, 269, 289,
+      270, 250, 269, 209, 228, 229, 207, 226, 227, 227, 208, 207,
+      228, 209, 208, 206, 226, 207, 225, 245, 226, 208, 227, 228,
+      226, 246, 227, 248, 247, 267, 248, 228, 247, 264, 245, 244,
+      246, 226, 245, 187, 206, 207, 205, 225, 206, 185, 204, 205,
+      203, 202, 222, 244, 224, 243, 225, 205, 224, 264, 244, 263,
+      245, 225, 244, 285, 286, 266, 266, 246, 265, 267, 266, 286,
+      267, 247, 266, 265, 285, 266, 306, 287, 286, 304, 285, 284,
+      305, 286, 285, 283, 303, 284, 324, 305, 304, 242, 262, 243,
+      220, 201, 200, 264, 263, 283, 243, 262, 263, 283, 282, 302,
+      263, 262, 282, 303, 283, 302, 284, 264, 283, 265, 264, 284,
+      265, 245, 264, 224, 223, 243, 224, 204, 223, 182, 202, 183,
+      182, 181, 201, 204, 203, 223, 204, 184, 203, 223, 242, 243,
+      222, 202, 221, 240, 221, 220, 241, 222, 221, 182, 201, 202,
+      181, 180, 200, 282, 262, 281, 281, 280, 300, 261, 280, 281,
+      222, 241, 242, 221, 240, 241, 260, 261, 241, 281, 262, 261,
+      282, 281, 301, 261, 260, 280, 281, 300, 301, 321, 320, 340,
+      362, 342, 361, 363, 382, 383, 302, 321, 322, 301, 300, 320,
+      381, 382, 362, 302, 301, 321, 302, 282, 301, 304, 303, 323,
+      304, 284, 303, 322, 342, 323, 383, 384, 364, 303, 322, 323,
+      321, 340, 341, 322, 341, 342, 322, 321, 341, 343, 344, 324,
+      364, 384, 365, 343, 363, 344, 364, 363, 383, 363, 362, 382,
+      342, 362, 343, 361, 341, 360, 344, 363, 364, 343, 362, 363,
+      360, 380, 361, 323, 342, 343, 341, 361, 342, 362, 361, 381,
+      341, 340, 360, 380, 381, 361
+   };
+
+   // table_top.obj
+   constexpr float m_table_top_obj_vertex[] =
+   {
+      69.1299973f, 43.2976341f, -31.6084023f, 68.9800034f, 43.1833916f, -31.4763851f,
+      59.7863998f, 43.1833954f, -35.7634926f, 59.9164085f, 43.2976379f, -35.9134941f,
+      59.9164085f, 43.8858414f, -35.9134941f, -64.8336182f, 43.8858414f, -35.9134941f,
+      -64.6929398f, 43.9833946f, -35.7634926f, 59.7863998f, 43.9833946f, -35.7634926f,
+      -64.8336182f, 43.2976379f, -35.9134941f, -64.6929398f, 43.1833954f, -35.7634926f,
+      -68.9800034f, 43.1833916f, -26.5698566f, -69.1299973f, 43.2976341f, -26.6812973f,
+      -69.1299973f, 43.8858376f, -26.6812973f, -69.1299973f, 43.8858299f, 31.6084499f,
+      -68.9800034f, 43.9833832f, 31.4764309f, -68.9800034f, 43.9833908f, -26.5698566f,
+      -69.1299973f, 43.2976265f, 31.6084499f, -68.9800034f, 43.1833839f, 31.4764309f,
+      -59.7864342f, 43.1833801f, 35.7635078f, -59.9164429f, 43.2976227f, 35.9135094f,
+      -59.9164429f, 43.8858261f, 35.9135094f, 64.8335876f, 43.8858261f, 35.9135094f,
+      64.6929092f, 43.9833794f, 35.7635078f, -59.7864342f, 43.9833794f, 35.7635078f,
+      64.8335876f, 43.2976227f, 35.9135094f, 64.6929092f, 43.1833801f, 35.7635078f,
+      68.9800034f, 43.1833839f, 26.5699043f, 69.1299973f, 43.2976265f, 26.681345f,
+      69.1299973f, 43.8858299f, 26.681345f, 69.1299973f, 43.8858376f, -31.6084023f,
+      68.9800034f, 43.9833908f, -31.4763851f, 68.9800034f, 43.9833832f, 26.5699043f
+   };
+   constexpr int m_table_top_obj_faceStart[] =
+   {
+      0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33,
+      36, 39, 42, 45, 48, 51, 54, 57, 60, 63, 66, 69,
+      72, 75, 78, 81, 84, 87, 90, 93, 96, 99, 102, 105,
+      108, 111, 114, 117, 120, 123, 126, 129, 132, 135, 138, 141,
+      144, 147, 150, 153, 156, 159, 162, 165, 168, 171, 174, 177,
+      180
+   };
+   constexpr int m_table_top_obj_faceIndex[] =
+   {
+      0, 1, 2, 0, 2, 3, 4, 5, 6, 4, 6, 7,
+      8, 9, 10, 8, 10, 11, 12, 13, 14, 12, 14, 15,
+      16, 17, 18, 16, 18, 19, 20, 21, 22, 20, 22, 23,
+      24, 25, 26, 24, 26, 27, 28, 29, 30, 28, 30, 31,
+      6, 23, 22, 6, 22, 7, 22, 31, 30, 22, 30, 7,
+      6, 15, 14, 6, 14, 23, 25, 2, 1, 25, 1, 26,
+      25, 18, 9, 25, 9, 2, 17, 10, 9, 17, 9, 18,
+      3, 4, 29, 3, 29, 0, 3, 2, 9, 3, 9, 8,
+      11, 12, 5, 11, 5, 8, 11, 10, 17, 11, 17, 16,
+      19, 20, 13, 19, 13, 16, 19, 18, 25, 19, 25, 24,
+      27, 28, 21, 27, 21, 24, 27, 26, 1, 27, 1, 0,
+      4, 3, 8, 4, 8, 5, 12, 11, 16, 12, 16, 13,
+      20, 19, 24, 20, 24, 21, 28, 27, 0, 28, 0, 29,
+      4, 7, 30, 4, 30, 29, 12, 15, 6, 12, 6, 5,
+      20, 23, 14, 20, 14, 13, 28, 31, 22, 28, 22, 21
+   };
+
+   // tilings/square_16x16
+   constexpr float m_tilings_square_16x16_vertex[] =
+   {
+      0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+      2.0f, 0.0f, 0.0f, 3.0f, 0.0f, 0.0f,
+      4.0f, 0.0f, 0.0f, 5.0f, 0.0f, 0.0f,
+      6.0f, 0.0f, 0.0f, 7.0f, 0.0f, 0.0f,
+      8.0f, 0.0f, 0.0f, 9.0f, 0.0f, 0.0f,
+      10.0f, 0.0f, 0.0f, 11.0f, 0.0f, 0.0f,
+      12.0f, 0.0f, 0.0f, 13.0f, 0.0f, 0.0f,
+      14.0f, 0.0f, 0.0f, 15.0f, 0.0f, 0.0f,
+      0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+      2.0f, 1.0f, 0.0f, 3.0f, 1.0f, 0.0f,
+      4.0f, 1.0f, 0.0f, 5.0f, 1.0f, 0.0f,
+      6.0f, 1.0f, 0.0f, 7.0f, 1.0f, 0.0f,
+      8.0f, 1.0f, 0.0f, 9.0f, 1.0f, 0.0f,
+      10.0f, 1.0f, 0.0f, 11.0f, 1.0f, 0.0f,
+      12.0f, 1.0f, 0.0f, 13.0f, 1.0f, 0.0f,
+      14.0f, 1.0f, 0.0f, 15.0f, 1.0f, 0.0f,
+      0.0f, 2.0f, 0.0f, 1.0f, 2.0f, 0.0f,
+      2.0f, 2.0f, 0.0f, 3.0f, 2.0f, 0.0f,
+      4.0f, 2.0f, 0.0f, 5.0f, 2.0f, 0.0f,
+      6.0f, 2.0f, 0.0f, 7.0f, 2.0f, 0.0f,
+      8.0f, 2.0f, 0.0f, 9.0f, 2.0f, 0.0f,
+      10.0f, 2.0f, 0.0f, 11.0f, 2.0f, 0.0f,
+      12.0f, 2.0f, 0.0f, 13.0f, 2.0f, 0.0f,
+      14.0f, 2.0f, 0.0f, 15.0f, 2.0f, 0.0f,
+      0.0f, 3.0f, 0.0f, 1.0f, 3.0f, 0.0f,
+      2.0f, 3.0f, 0.0f, 3.0f, 3.0f, 0.0f,
+      4.0f, 3.0f, 0.0f, 5.0f, 3.0f, 0.0f,
+      6.0f, 3.0f, 0.0f, 7.0f, 3.0f, 0.0f,
+      8.0f, 3.0f, 0.0f, 9.0f, 3.0f, 0.0f,
+      10.0f, 3.0f, 0.0f, 11.0f, 3.0f, 0.0f,
+      12.0f, 3.0f, 0.0f, 13.0f, 3.0f, 0.0f,
+      14.0f, 3.0f, 0.0f, 15.0f, 3.0f, 0.0f,
+      0.0f, 4.0f, 0.0f, 1.0f, 4.0f, 0.0f,
+      2.0f, 4.0f, 0.0f, 3.0f, 4.0f, 0.0f,
+      4.0f, 4.0f, 0.0f, 5.0f, 4.0f, 0.0f,
+      6.0f, 4.0f, 0.0f, 7.0f, 4.0f, 0.0f,
+      8.0f, 4.0f, 0.0f, 9.0f, 4.0f, 0.0f,
+      10.0f, 4.0f, 0.0f, 11.0f, 4.0f, 0.0f,
+      12.0f, 4.0f, 0.0f, 13.0f, 4.0f, 0.0f,
+      14.0f, 4.0f, 0.0f, 15.0f, 4.0f, 0.0f,
+      0.0f, 5.0f, 0.0f, 1.0f, 5.0f, 0.0f,
+      2.0f, 5.0f, 0.0f, 3.0f, 5.0f, 0.0f,
+      4.0f, 5.0f, 0.0f, 5.0f, 5.0f, 0.0f,
+      6.0f, 5.0f, 0.0f, 7.0f, 5.0f, 0.0f,
+      8.0f, 5.0f, 0.0f, 9.0f, 5.0f, 0.0f,
+      10.0f, 5.0f, 0.0f, 11.0f, 5.0f, 0.0f,
+      12.0f, 5.0f, 0.0f, 13.0f, 5.0f, 0.0f,
+      14.0f, 5.0f, 0.0f, 15.0f, 5.0f, 0.0f,
+      0.0f, 6.0f, 0.0f, 1.0f, 6.0f, 0.0f,
+      2.0f, 6.0f, 0.0f, 3.0f, 6.0f, 0.0f,
+      4.0f, 6.0f, 0.0f, 5.0f, 6.0f, 0.0f,
+      6.0f, 6.0f, 0.0f, 7.0f, 6.0f, 0.0f,
+      8.0f, 6.0f, 0.0f, 9.0f, 6.0f, 0.0f,
+      10.0f, 6.0f, 0.0f, 11.0f, 6.0f, 0.0f,
+      12.0f, 6.0f, 0.0f, 13.0f, 6.0f, 0.0f,
+      14.0f, 6.0f, 0.0f, 15.0f, 6.0f, 0.0f,
+      0.0f, 7.0f, 0.0f, 1.0f, 7.0f, 0.0f,
+      2.0f, 7.0f, 0.0f, 3.0f, 7.0f, 0.0f,
+      4.0f, 7.0f, 0.0f, 5.0f, 7.0f, 0.0f,
+      6.0f, 7.0f, 0.0f, 7.0f, 7.0f, 0.0f,
+      8.0f, 7.0f, 0.0f, 9.0f, 7.0f, 0.0f,
+      10.0f, 7.0f, 0.0f, 11.0f, 7.0f, 0.0f,
+      12.0f, 7.0f, 0.0f, 13.0f, 7.0f, 0.0f,
+      14.0f, 7.0f, 0.0f, 15.0f, 7.0f, 0.0f,
+      0.0f, 8.0f, 0.0f, 1.0f, 8.0f, 0.0f,
+      2.0f, 8.0f, 0.0f, 3.0f, 8.0f, 0.0f,
+      4.0f, 8.0f, 0.0f, 5.0f, 8.0f, 0.0f,
+      6.0f, 8.0f, 0.0f, 7.0f, 8.0f, 0.0f,
+      8.0f, 8.0f, 0.0f, 9.0f, 8.0f, 0.0f,
+      10.0f, 8.0f, 0.0f, 11.0f, 8.0f, 0.0f,
+      12.0f, 8.0f, 0.0f, 13.0f, 8.0f, 0.0f,
+      14.0f, 8.0f, 0.0f, 15.0f, 8.0f, 0.0f,
+      0.0f, 9.0f, 0.0f, 1.0f, 9.0f, 0.0f,
+      2.0f, 9.0f, 0.0f, 3.0f, 9.0f, 0.0f,
+      4.0f, 9.0f, 0.0f, 5.0f, 9.0f, 0.0f,
+      6.0f, 9.0f, 0.0f, 7.0f, 9.0f, 0.0f,
+      8.0f, 9.0f, 0.0f, 9.0f, 9.0f, 0.0f,
+      10.0f, 9.0f, 0.0f, 11.0f, 9.0f, 0.0f,
+      12.0f, 9.0f, 0.0f, 13.0f, 9.0f, 0.0f,
+      14.0f, 9.0f, 0.0f, 15.0f, 9.0f, 0.0f,
+      0.0f, 10.0f, 0.0f, 1.0f, 10.0f, 0.0f,
+      2.0f, 10.0f, 0.0f, 3.0f, 10.0f, 0.0f,
+      4.0f, 10.0f, 0.0f, 5.0f, 10.0f, 0.0f,
+      6.0f, 10.0f, 0.0f, 7.0f, 10.0f, 0.0f,
+      8.0f, 10.0f, 0.0f, 9.0f, 10.0f, 0.0f,
+      10.0f, 10.0f, 0.0f, 11.0f, 10.0f, 0.0f,
+      12.0f, 10.0f, 0.0f, 13.0f, 10.0f, 0.0f,
+      14.0f, 10.0f, 0.0f, 15.0f, 10.0f, 0.0f,
+      0.0f, 11.0f, 0.0f, 1.0f, 11.0f, 0.0f,
+      2.0f, 11.0f, 0.0f, 3.0f, 11.0f, 0.0f,
+      4.0f, 11.0f, 0.0f, 5.0f, 11.0f, 0.0f,
+      6.0f, 11.0f, 0.0f, 7.0f, 11.0f, 0.0f,
+      8.0f, 11.0f, 0.0f, 9.0f, 11.0f, 0.0f,
+      10.0f, 11.0f, 0.0f, 11.0f, 11.0f, 0.0f,
+      12.0f, 11.0f, 0.0f, 13.0f, 11.0f, 0.0f,
+      14.0f, 11.0f, 0.0f, 15.0f, 11.0f, 0.0f,
+      0.0f, 12.0f, 0.0f, 1.0f, 12.0f, 0.0f,
+      2.0f, 12.0f, 0.0f, 3.0f, 12.0f, 0.0f,
+      4.0f, 12.0f, 0.0f, 5.0f, 12.0f, 0.0f,
+      6.0f, 12.0f, 0.0f, 7.0f, 12.0f, 0.0f,
+      8.0f, 12.0f, 0.0f, 9.0f, 12.0f, 0.0f,
+      10.0f, 12.0f, 0.0f, 11.0f, 12.0f, 0.0f,
+      12.0f, 12.0f, 0.0f, 13.0f, 12.0f, 0.0f,
+      14.0f, 12.0f, 0.0f, 15.0f, 12.0f, 0.0f,
+      0.0f, 13.0f, 0.0f, 1.0f, 13.0f, 0.0f,
+      2.0f, 13.0f, 0.0f, 3.0f, 13.0f, 0.0f,
+      4.0f, 13.0f, 0.0f, 5.0f, 13.0f, 0.0f,
+      6.0f, 13.0f, 0.0f, 7.0f, 13.0f, 0.0f,
+      8.0f, 13.0f, 0.0f, 9.0f, 13.0f, 0.0f,
+      10.0f, 13.0f, 0.0f, 11.0f, 13.0f, 0.0f,
+      12.0f, 13.0f, 0.0f, 13.0f, 13.0f, 0.0f,
+      14.0f, 13.0f, 0.0f, 15.0f, 13.0f, 0.0f,
+      0.0f, 14.0f, 0.0f, 1.0f, 14.0f, 0.0f,
+      2.0f, 14.0f, 0.0f, 3.0f, 14.0f, 0.0f,
+      4.0f, 14.0f, 0.0f, 5.0f, 14.0f, 0.0f,
+      6.0f, 14.0f, 0.0f, 7.0f, 14.0f, 0.0f,
+      8.0f, 14.0f, 0.0f, 9.0f, 14.0f, 0.0f,
+      10.0f, 14.0f, 0.0f, 11.0f, 14.0f, 0.0f,
+      12.0f, 14.0f, 0.0f, 13.0f, 14.0f, 0.0f,
+      14.0f, 14.0f, 0.0f, 15.0f, 14.0f, 0.0f,
+      0.0f, 15.0f, 0.0f, 1.0f, 15.0f, 0.0f,
+      2.0f, 15.0f, 0.0f, 3.0f, 15.0f, 0.0f,
+      4.0f, 15.0f, 0.0f, 5.0f, 15.0f, 0.0f,
+      6.0f, 15.0f, 0.0f, 7.0f, 15.0f, 0.0f,
+      8.0f, 15.0f, 0.0f, 9.0f, 15.0f, 0.0f,
+      10.0f, 15.0f, 0.0f, 11.0f, 15.0f, 0.0f,
+      12.0f, 15.0f, 0.0f, 13.0f, 15.0f, 0.0f,
+      14.0f, 15.0f, 0.0f, 15.0f, 15.0f, 0.0f
+   };
+   constexpr int m_tilings_square_16x16_faceStart[] =
+   {
+      0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44,
+      48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92,
+      96, 100, 104, 108, 112, 116, 120, 124, 128, 132, 136, 140,
+      144, 148, 152, 156, 160, 164, 168, 172, 176, 180, 184, 188,
+      192, 196, 200, 204, 208, 212, 216, 220, 224, 228, 232, 236,
+      240, 244, 248, 252, 256, 260, 264, 268, 272, 276, 280, 284,
+      288, 292, 296, 300, 304, 308, 312, 316, 320, 324, 328, 332,
+      336, 340, 344, 348, 352, 356, 360, 364, 368, 372, 376, 380,
+      384, 388, 392, 396, 400, 404, 408, 412, 416, 420, 424, 428,
+      432, 436, 440, 444, 448, 452, 456, 460, 464, 468, 472, 476,
+      480, 484, 488, 492, 496, 500, 504, 508, 512, 516, 520, 524,
+      528, 532, 536, 540, 544, 548, 552, 556, 560, 564, 568, 572,
+      576, 580, 584, 588, 592, 596, 600, 604, 608, 612, 616, 620,
+      624, 628, 632, 636, 640, 644, 648, 652, 656, 660, 664, 668,
+      672, 676, 680, 684, 688, 692, 696, 700, 704, 708, 712, 716,
+      720, 724, 728, 732, 736, 740, 744, 748, 752, 756, 760, 764,
+      768, 772, 776, 780, 784, 788, 792, 796, 800, 804, 808, 812,
+      816, 820, 824, 828, 832, 836, 840, 844, 848, 852, 856, 860,
+      864, 868, 872, 876, 880, 884, 888, 892, 896, 900
+   };
+   constexpr int m_tilings_square_16x16_faceIndex[] =
+   {
+      0, 1, 17, 16, 1, 2, 18, 17, 2, 3, 19, 18,
+      3, 4, 20, 19, 4, 5, 21, 20, 5, 6, 22, 21,
+      6, 7, 23, 22, 7, 8, 24, 23, 8, 9, 25, 24,
+      9, 10, 26, 25, 10, 11, 27, 26, 11, 12, 28, 27,
+      12, 13, 29, 28, 13, 14, 30, 29, 14, 15, 31, 30,
+      16, 17, 33, 32, 17, 18, 34, 33, 18, 19, 35, 34,
+      19, 20, 36, 35, 20, 21, 37, 36, 21, 22, 38, 37,
+      22, 23, 39, 38, 23, 24, 40, 39, 24, 25, 41, 40,
+      25, 26, 42, 41, 26, 27, 43, 42, 27, 28, 44, 43,
+      28, 29, 45, 44, 29, 30, 46, 45, 30, 31, 47, 46,
+      32, 33, 49, 48, 33, 34, 50, 49, 34, 35, 51, 50,
+      35, 36, 52, 51, 36, 37, 53, 52, 37, 38, 54, 53,
+      38, 39, 55, 54, 39, 40, 56, 55, 40, 41, 57, 56,
+      41, 42, 58, 57, 42, 43, 59, 58, 43, 44, 60, 59,
+      44, 45, 61, 60, 45, 46, 62, 61, 46, 47, 63, 62,
+      48, 49, 65, 64, 49, 50, 66, 65, 50, 51, 67, 66,
+      51, 52, 68, 67, 52, 53, 69, 68, 53, 54, 70, 69,
+      54, 55, 71, 70, 55, 56, 72, 71, 56, 57, 73, 72,
+      57, 58, 74, 73, 58, 59, 75, 74, 59, 60, 76, 75,
+      60, 61, 77, 76, 61, 62, 78, 77, 62, 63, 79, 78,
+      64, 65, 81, 80, 65, 66, 82, 81, 66, 67, 83, 82,
+      67, 68, 84, 83, 68, 69, 85, 84, 69, 70, 86, 85,
+      70, 71, 87, 86, 71, 72, 88, 87, 72, 73, 89, 88,
+      73, 74, 90, 89, 74, 75, 91, 90, 75, 76, 92, 91,
+      76, 77, 93, 92, 77, 78, 94, 93, 78, 79, 95, 94,
+      80, 81, 97, 96, 81, 82, 98, 97, 82, 83, 99, 98,
+      83, 84, 100, 99, 84, 85, 101, 100, 85, 86, 102, 101,
+      86, 87, 103, 102, 87, 88, 104, 103, 88, 89, 105, 104,
+      89, 90, 106, 105, 90, 91, 107, 106, 91, 92, 108, 107,
+      92, 93, 109, 108, 93, 94, 110, 109, 94, 95, 111, 110,
+      96, 97, 113, 112, 97, 98, 114, 113, 98, 99, 115, 114,
+      99, 100, 116, 115, 100, 101, 117, 116, 101, 102, 118, 117,
+      102, 103, 119, 118, 103, 104, 120, 119, 104, 105, 121, 120,
+      105, 106, 122, 121, 106, 107, 123, 122, 107, 108, 124, 123,
+      108, 109, 125, 124, 109, 110, 126, 125, 110, 111, 127, 126,
+      112, 113, 129, 128, 113, 114, 130, 129, 114, 115, 131, 130,
+      115, 116, 132, 131, 116, 117, 133, 132, 117, 118, 134, 133,
+      118, 119, 135, 134, 119, 120, 136, 135, 120, 121, 137, 136,
+      121, 122, 138, 137, 122, 123, 139, 138, 123, 124, 140, 139,
+      124, 125, 141, 140, 125, 126, 142, 141, 126, 127, 143, 142,
+      128, 129, 145, 144, 129, 130, 146, 145, 130, 131, 147, 146,
+      131, 132, 148, 147, 132, 133, 149, 148, 133, 134, 150, 149,
+      134, 135, 151, 150, 135, 136, 152, 151, 136, 137, 153, 152,
+      137, 138, 154, 153, 138, 139, 155, 154, 139, 140, 156, 155,
+      140, 141, 157, 156, 141, 142, 158, 157, 142, 143, 159, 158,
+      144, 145, 161, 160, 145, 146, 162, 161, 146, 147, 163, 162,
+      147, 148, 164, 163, 148, 149, 165, 164, 149, 150, 166, 165,
+      150, 151, 167, 166, 151, 152, 168, 167, 152, 153, 169, 168,
+      153, 154, 170, 169, 154, 155, 171, 170, 155, 156, 172, 171,
+      156, 157, 173, 172, 157, 158, 174, 173, 158, 159, 175, 174,
+      160, 161, 177, 176, 161, 162, 178, 177, 162, 163, 179, 178,
+      163, 164, 180, 179, 164, 165, 181, 180, 165, 166, 182, 181,
+      166, 167, 183, 182, 167, 168, 184, 183, 168, 169, 185, 184,
+      169, 170, 186, 185, 170, 171, 187, 186, 171, 172, 188, 187,
+      172, 173, 189, 188, 173, 174, 190, 189, 174, 175, 191, 190,
+      176, 177, 193, 192, 177, 178, 194, 193, 178, 179, 195, 194,
+      179, 180, 196, 195, 180, 181, 197, 196, 181, 182, 198, 197,
+      182, 183, 199, 198, 183, 184, 200, 199, 184, 185, 201, 200,
+      185, 186, 202, 201, 186, 187, 203, 202, 187, 188, 204, 203,
+      188, 189, 205, 204, 189, 190, 206, 205, 190, 191, 207, 206,
+      192, 193, 209, 208, 193, 194, 210, 209, 194, 195, 211, 210,
+      195, 196, 212, 211, 196, 197, 213, 212, 197, 198, 214, 213,
+      198, 199, 215, 214, 199, 200, 216, 215, 200, 201, 217, 216,
+      201, 202, 218, 217, 202, 203, 219, 218, 203, 204, 220, 219,
+      204, 205, 221, 220, 205, 206, 222, 221, 206, 207, 223, 222,
+      208, 209, 225, 224, 209, 210, 226, 225, 210, 211, 227, 226,
+      211, 212, 228, 227, 212, 213, 229, 228, 213, 214, 230, 229,
+      214, 215, 231, 230, 215, 216, 232, 231, 216, 217, 233, 232,
+      217, 218, 234, 233, 218, 219, 235, 234, 219, 220, 236, 235,
+      220, 221, 237, 236, 221, 222, 238, 237, 222, 223, 239, 238,
+      224, 225, 241, 240, 225, 226, 242, 241, 226, 227, 243, 242,
+      227, 228, 244, 243, 228, 229, 245, 244, 229, 230, 246, 245,
+      230, 231, 247, 246, 231, 232, 248, 247, 232, 233, 249, 248,
+      233, 234, 250, 249, 234, 235, 251, 250, 235, 236, 252, 251,
+      236, 237, 253, 252, 237, 238, 254, 253, 238, 239, 255, 254
+   };
+
+   // tilings/triangle_16x16
+   constexpr float m_tilings_triangle_16x16_vertex[] =
+   {
+      0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+      2.0f, 0.0f, 0.0f, 3.0f, 0.0f, 0.0f,
+      4.0f, 0.0f, 0.0f, 5.0f, 0.0f, 0.0f,
+      6.0f, 0.0f, 0.0f, 7.0f, 0.0f, 0.0f,
+      8.0f, 0.0f, 0.0f, 9.0f, 0.0f, 0.0f,
+      10.0f, 0.0f, 0.0f, 11.0f, 0.0f, 0.0f,
+      12.0f, 0.0f, 0.0f, 13.0f, 0.0f, 0.0f,
+      14.0f, 0.0f, 0.0f, 15.0f, 0.0f, 0.0f,
+      0.5f, 0.866025388f, 0.0f, 1.5f, 0.866025388f, 0.0f,
+      2.5f, 0.866025388f, 0.0f, 3.5f, 0.866025388f, 0.0f,
+      4.5f, 0.866025388f, 0.0f, 5.5f, 0.866025388f, 0.0f,
+      6.5f, 0.866025388f, 0.0f, 7.5f, 0.866025388f, 0.0f,
+      8.5f, 0.866025388f, 0.0f, 9.5f, 0.866025388f, 0.0f,
+      10.5f, 0.866025388f, 0.0f, 11.5f, 0.866025388f, 0.0f,
+      12.5f, 0.866025388f, 0.0f, 13.5f, 0.866025388f, 0.0f,
+      14.5f, 0.866025388f, 0.0f, 15.5f, 0.866025388f, 0.0f,
+      1.0f, 1.73205078f, 0.0f, 2.0f, 1.73205078f, 0.0f,
+      3.0f, 1.73205078f, 0.0f, 4.0f, 1.73205078f, 0.0f,
+      5.0f, 1.73205078f, 0.0f, 6.0f, 1.73205078f, 0.0f,
+      7.0f, 1.73205078f, 0.0f, 8.0f, 1.73205078f, 0.0f,
+      9.0f, 1.73205078f, 0.0f, 10.0f, 1.73205078f, 0.0f,
+      11.0f, 1.73205078f, 0.0f, 12.0f, 1.73205078f, 0.0f,
+      13.0f, 1.73205078f, 0.0f, 14.0f, 1.73205078f, 0.0f,
+      15.0f, 1.73205078f, 0.0f, 16.0f, 1.73205078f, 0.0f,
+      1.5f, 2.59807611f, 0.0f, 2.5f, 2.59807611f, 0.0f,
+      3.5f, 2.59807611f, 0.0f, 4.5f, 2.59807611f, 0.0f,
+      5.5f, 2.59807611f, 0.0f, 6.5f, 2.59807611f, 0.0f,
+      7.5f, 2.59807611f, 0.0f, 8.5f, 2.59807611f, 0.0f,
+      9.5f, 2.59807611f, 0.0f, 10.5f, 2.59807611f, 0.0f,
+      11.5f, 2.59807611f, 0.0f, 12.5f, 2.59807611f, 0.0f,
+      13.5f, 2.59807611f, 0.0f, 14.5f, 2.59807611f, 0.0f,
+      15.5f, 2.59807611f, 0.0f, 16.5f, 2.59807611f, 0.0f,
+      2.0f, 3.46410155f, 0.0f, 3.0f, 3.46410155f, 0.0f,
+      4.0f, 3.46410155f, 0.0f, 5.0f, 3.46410155f, 0.0f,
+      6.0f, 3.46410155f, 0.0f, 7.0f, 3.46410155f, 0.0f,
+      8.0f, 3.46410155f, 0.0f, 9.0f, 3.46410155f, 0.0f,
+      10.0f, 3.46410155f, 0.0f, 11.0f, 3.46410155f, 0.0f,
+      12.0f, 3.46410155f, 0.0f, 13.0f, 3.46410155f, 0.0f,
+      14.0f, 3.46410155f, 0.0f, 15.0f, 3.46410155f, 0.0f,
+      16.0f, 3.46410155f, 0.0f, 17.0f, 3.46410155f, 0.0f,
+      2.5f, 4.33012676f, 0.0f, 3.5f, 4.33012676f, 0.0f,
+      4.5f, 4.33012676f, 0.0f, 5.5f, 4.33012676f, 0.0f,
+      6.5f, 4.33012676f, 0.0f, 7.5f, 4.33012676f, 0.0f,
+      8.5f, 4.33012676f, 0.0f, 9.5f, 4.33012676f, 0.0f,
+      10.5f, 4.33012676f, 0.0f, 11.5f, 4.33012676f, 0.0f,
+      12.5f, 4.33012676f, 0.0f, 13.5f, 4.33012676f, 0.0f,
+      14.5f, 4.33012676f, 0.0f, 15.5f, 4.33012676f, 0.0f,
+      16.5f, 4.33012676f, 0.0f, 17.5f, 4.33012676f, 0.0f,
+      3.0f, 5.19615221f, 0.0f, 4.0f, 5.19615221f, 0.0f,
+      5.0f, 5.19615221f, 0.0f, 6.0f, 5.19615221f, 0.0f,
+      7.0f, 5.19615221f, 0.0f, 8.0f, 5.19615221f, 0.0f,
+      9.0f, 5.19615221f, 0.0f, 10.0f, 5.19615221f, 0.0f,
+      11.0f, 5.19615221f, 0.0f, 12.0f, 5.19615221f, 0.0f,
+      13.0f, 5.19615221f, 0.0f, 14.0f, 5.19615221f, 0.0f,
+      15.0f, 5.19615221f, 0.0f, 16.0f, 5.19615221f, 0.0f,
+      17.0f, 5.19615221f, 0.0f, 18.0f, 5.19615221f, 0.0f,
+      3.5f, 6.06217766f, 0.0f, 4.5f, 6.06217766f, 0.0f,
+      5.5f, 6.06217766f, 0.0f, 6.5f, 6.06217766f, 0.0f,
+      7.5f, 6.06217766f, 0.0f, 8.5f, 6.06217766f, 0.0f,
+      9.5f, 6.06217766f, 0.0f, 10.5f, 6.06217766f, 0.0f,
+      11.5f, 6.06217766f, 0.0f, 12.5f, 6.06217766f, 0.0f,
+      13.5f, 6.06217766f, 0.0f, 14.5f, 6.06217766f, 0.0f,
+      15.5f, 6.06217766f, 0.0f, 16.5f, 6.06217766f, 0.0f,
+      17.5f, 6.06217766f, 0.0f, 18.5f, 6.06217766f, 0.0f,
+      4.0f, 6.92820311f, 0.0f, 5.0f, 6.92820311f, 0.0f,
+      6.0f, 6.92820311f, 0.0f, 7.0f, 6.92820311f, 0.0f,
+      8.0f, 6.92820311f, 0.0f, 9.0f, 6.92820311f, 0.0f,
+      10.0f, 6.92820311f, 0.0f, 11.0f, 6.92820311f, 0.0f,
+      12.0f, 6.92820311f, 0.0f, 13.0f, 6.92820311f, 0.0f,
+      14.0f, 6.92820311f, 0.0f, 15.0f, 6.92820311f, 0.0f,
+      16.0f, 6.92820311f, 0.0f, 17.0f, 6.92820311f, 0.0f,
+      18.0f, 6.92820311f, 0.0f, 19.0f, 6.92820311f, 0.0f,
+      4.5f, 7.79422855f, 0.0f, 5.5f, 7.79422855f, 0.0f,
+      6.5f, 7.79422855f, 0.0f, 7.5f, 7.79422855f, 0.0f,
+      8.5f, 7.79422855f, 0.0f, 9.5f, 7.79422855f, 0.0f,
+      10.5f, 7.79422855f, 0.0f, 11.5f, 7.79422855f, 0.0f,
+      12.5f, 7.79422855f, 0.0f, 13.5f, 7.79422855f, 0.0f,
+      14.5f, 7.79422855f, 0.0f, 15.5f, 7.79422855f, 0.0f,
+      16.5f, 7.79422855f, 0.0f, 17.5f, 7.79422855f, 0.0f,
+      18.5f, 7.79422855f, 0.0f, 19.5f, 7.79422855f, 0.0f,
+      5.0f, 8.66025352f, 0.0f, 6.0f, 8.66025352f, 0.0f,
+      7.0f, 8.66025352f, 0.0f, 8.0f, 8.66025352f, 0.0f,
+      9.0f, 8.66025352f, 0.0f, 10.0f, 8.66025352f, 0.0f,
+      11.0f, 8.66025352f, 0.0f, 12.0f, 8.66025352f, 0.0f,
+      13.0f, 8.66025352f, 0.0f, 14.0f, 8.66025352f, 0.0f,
+      15.0f, 8.66025352f, 0.0f, 16.0f, 8.66025352f, 0.0f,
+      17.0f, 8.66025352f, 0.0f, 18.0f, 8.66025352f, 0.0f,
+      19.0f, 8.66025352f, 0.0f, 20.0f, 8.66025352f, 0.0f,
+      5.5f, 9.52627945f, 0.0f, 6.5f, 9.52627945f, 0.0f,
+      7.5f, 9.52627945f, 0.0f, 8.5f, 9.52627945f, 0.0f,
+      9.5f, 9.52627945f, 0.0f, 10.5f, 9.52627945f, 0.0f,
+      11.5f, 9.52627945f, 0.0f, 12.5f, 9.52627945f, 0.0f,
+      13.5f, 9.52627945f, 0.0f, 14.5f, 9.52627945f, 0.0f,
+      15.5f, 9.52627945f, 0.0f, 16.5f, 9.52627945f, 0.0f,
+      17.5f, 9.52627945f, 0.0f, 18.5f, 9.52627945f, 0.0f,
+      19.5f, 9.52627945f, 0.0f, 20.5f, 9.52627945f, 0.0f,
+      6.0f, 10.3923044f, 0.0f, 7.0f, 10.3923044f, 0.0f,
+      8.0f, 10.3923044f, 0.0f, 9.0f, 10.3923044f, 0.0f,
+      10.0f, 10.3923044f, 0.0f, 11.0f, 10.3923044f, 0.0f,
+      12.0f, 10.3923044f, 0.0f, 13.0f, 10.3923044f, 0.0f,
+      14.0f, 10.3923044f, 0.0f, 15.0f, 10.3923044f, 0.0f,
+      16.0f, 10.3923044f, 0.0f, 17.0f, 10.3923044f, 0.0f,
+      18.0f, 10.3923044f, 0.0f, 19.0f, 10.3923044f, 0.0f,
+      20.0f, 10.3923044f, 0.0f, 21.0f, 10.3923044f, 0.0f,
+      6.5f, 11.2583303f, 0.0f, 7.5f, 11.2583303f, 0.0f,
+      8.5f, 11.2583303f, 0.0f, 9.5f, 11.2583303f, 0.0f,
+      10.5f, 11.2583303f, 0.0f, 11.5f, 11.2583303f, 0.0f,
+      12.5f, 11.2583303f, 0.0f, 13.5f, 11.2583303f, 0.0f,
+      14.5f, 11.2583303f, 0.0f, 15.5f, 11.2583303f, 0.0f,
+      16.5f, 11.2583303f, 0.0f, 17.5f, 11.2583303f, 0.0f,
+      18.5f, 11.2583303f, 0.0f, 19.5f, 11.2583303f, 0.0f,
+      20.5f, 11.2583303f, 0.0f, 21.5f, 11.2583303f, 0.0f,
+      7.0f, 12.1243553f, 0.0f, 8.0f, 12.1243553f, 0.0f,
+      9.0f, 12.1243553f, 0.0f, 10.0f, 12.1243553f, 0.0f,
+      11.0f, 12.1243553f, 0.0f, 12.0f, 12.1243553f, 0.0f,
+      13.0f, 12.1243553f, 0.0f, 14.0f, 12.1243553f, 0.0f,
+      15.0f, 12.1243553f, 0.0f, 16.0f, 12.1243553f, 0.0f,
+      17.0f, 12.1243553f, 0.0f, 18.0f, 12.1243553f, 0.0f,
+      19.0f, 12.1243553f, 0.0f, 20.0f, 12.1243553f, 0.0f,
+      21.0f, 12.1243553f, 0.0f, 22.0f, 12.1243553f, 0.0f,
+      7.5f, 12.9903812f, 0.0f, 8.5f, 12.9903812f, 0.0f,
+      9.5f, 12.9903812f, 0.0f, 10.5f, 12.9903812f, 0.0f,
+      11.5f, 12.9903812f, 0.0f, 12.5f, 12.9903812f, 0.0f,
+      13.5f, 12.9903812f, 0.0f, 14.5f, 12.9903812f, 0.0f,
+      15.5f, 12.9903812f, 0.0f, 16.5f, 12.9903812f, 0.0f,
+      17.5f, 12.9903812f, 0.0f, 18.5f, 12.9903812f, 0.0f,
+      19.5f, 12.9903812f, 0.0f, 20.5f, 12.9903812f, 0.0f,
+      21.5f, 12.9903812f, 0.0f, 22.5f, 12.9903812f, 0.0f
+   };
+   constexpr int m_tilings_triangle_16x16_faceStart[] =
+   {
+      0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33,
+      36, 39, 42, 45, 48, 51, 54, 57, 60, 63, 66, 69,
+      72, 75, 78, 81, 84, 87, 90, 93, 96, 99, 102, 105,
+      108, 111, 114, 117, 120, 123, 126, 129, 132, 135, 138, 141,
+      144, 147, 150, 153, 156, 159, 162, 165, 168, 171, 174, 177,
+      180, 183, 186, 189, 192, 195, 198, 201, 204, 207, 210, 213,
+      216, 219, 222, 225, 228, 231, 234, 237, 240, 243, 246, 249,
+      252, 255, 258, 261, 264, 267, 270, 273, 276, 279, 282, 285,
+      288, 291, 294, 297, 300, 303, 306, 309, 312, 315, 318, 321,
+      324, 327, 330, 333, 336, 339, 342, 345, 348, 351, 354, 357,
+      360, 363, 366, 369, 372, 375, 378, 381, 384, 387, 390, 393,
+      396, 399, 402, 405, 408, 411, 414, 417, 420, 423, 426, 429,
+      432, 435, 438, 441, 444, 447, 450, 453, 456, 459, 462, 465,
+      468, 471, 474, 477, 480, 483, 486, 489, 492, 495, 498, 501,
+      504, 507, 510, 513, 516, 519, 522, 525, 528, 531, 534, 537,
+      540, 543, 546, 549, 552, 555, 558, 561, 564, 567, 570, 573,
+      576, 579, 582, 585, 588, 591, 594, 597, 600, 603, 606, 609,
+      612, 615, 618, 621, 624, 627, 630, 633, 636, 639, 642, 645,
+      648, 651, 654, 657, 660, 663, 666, 669, 672, 675, 678, 681,
+      684, 687, 690, 693, 696, 699, 702, 705, 708, 711, 714, 717,
+      720, 723, 726, 729, 732, 735, 738, 741, 744, 747, 750, 753,
+      756, 759, 762, 765, 768, 771, 774, 777, 780, 783, 786, 789,
+      792, 795, 798, 801, 804, 807, 810, 813, 816, 819, 822, 825,
+      828, 831, 834, 837, 840, 843, 846, 849, 852, 855, 858, 861,
+      864, 867, 870, 873, 876, 879, 882, 885, 888, 891, 894, 897,
+      900, 903, 906, 909, 912, 915, 918, 921, 924, 927, 930, 933,
+      936, 939, 942, 945, 948, 951, 954, 957, 960, 963, 966, 969,
+      972, 975, 978, 981, 984, 987, 990, 993, 996, 999, 1002, 1005,
+      1008, 1011, 1014, 1017, 1020, 1023, 1026, 1029, 1032, 1035, 1038, 1041,
+      1044, 1047, 1050, 1053, 1056, 1059, 1062, 1065, 1068, 1071, 1074, 1077,
+      1080, 1083, 1086, 1089, 1092, 1095, 1098, 1101, 1104, 1107, 1110, 1113,
+      1116, 1119, 1122, 1125, 1128, 1131, 1134, 1137, 1140, 1143, 1146, 1149,
+      1152, 1155, 1158, 1161, 1164, 1167, 1170, 1173, 1176, 1179, 1182, 1185,
+      1188, 1191, 1194, 1197, 1200, 1203, 1206, 1209, 1212, 1215, 1218, 1221,
+      1224, 1227, 1230, 1233, 1236, 1239, 1242, 1245, 1248, 1251, 1254, 1257,
+      1260, 1263, 1266, 1269, 1272, 1275, 1278, 1281, 1284, 1287, 1290, 1293,
+      1296, 1299, 1302, 1305, 1308, 1311, 1314, 1317, 1320, 1323, 1326, 1329,
+      1332, 1335, 1338, 1341, 1344, 1347, 1350
+   };
+   constexpr int m_tilings_triangle_16x16_faceIndex[] =
+   {
+      0, 1, 16, 1, 17, 16, 1, 2, 17, 2, 18, 17,
+      2, 3, 18, 3, 19, 18, 3, 4, 19, 4, 20, 19,
+      4, 5, 20, 5, 21, 20, 5, 6, 21, 6, 22, 21,
+      6, 7, 22, 7, 23, 22, 7, 8, 23, 8, 24, 23,
+      8, 9, 24, 9, 25, 24, 9, 10, 25, 10, 26, 25,
+      10, 11, 26, 11, 27, 26, 11, 12, 27, 12, 28, 27,
+      12, 13, 28, 13, 29, 28, 13, 14, 29, 14, 30, 29,
+      14, 15, 30, 15, 31, 30, 16, 17, 32, 17, 33, 32,
+      17, 18, 33, 18, 34, 33, 18, 19, 34, 19, 35, 34,
+      19, 20, 35, 20, 36, 35, 20, 21, 36, 21, 37, 36,
+      21, 22, 37, 22, 38, 37, 22, 23, 38, 23, 39, 38,
+      23, 24, 39, 24, 40, 39, 24, 25, 40, 25, 41, 40,
+      25, 26, 41, 26, 42, 41, 26, 27, 42, 27, 43, 42,
+      27, 28, 43, 28, 44, 43, 28, 29, 44, 29, 45, 44,
+      29, 30, 45, 30, 46, 45, 30, 31, 46, 31, 47, 46,
+      32, 33, 48, 33, 49, 48, 33, 34, 49, 34, 50, 49,
+      34, 35, 50, 35, 51, 50, 35, 36, 51, 36, 52, 51,
+      36, 37, 52, 37, 53, 52, 37, 38, 53, 38, 54, 53,
+      38, 39, 54, 39, 55, 54, 39, 40, 55, 40, 56, 55,
+      40, 41, 56, 41, 57, 56, 41, 42, 57, 42, 58, 57,
+      42, 43, 58, 43, 59, 58, 43, 44, 59, 44, 60, 59,
+      44, 45, 60, 45, 61, 60, 45, 46, 61, 46, 62, 61,
+      46, 47, 62, 47, 63, 62, 48, 49, 64, 49, 65, 64,
+      49, 50, 65, 50, 66, 65, 50, 51, 66, 51, 67, 66,
+      51, 52, 67, 52, 68, 67, 52, 53, 68, 53, 69, 68,
+      53, 54, 69, 54, 70, 69, 54, 55, 70, 55, 71, 70,
+      55, 56, 71, 56, 72, 71, 56, 57, 72, 57, 73, 72,
+      57, 58, 73, 58, 74, 73, 58, 59, 74, 59, 75, 74,
+      59, 60, 75, 60, 76, 75, 60, 61, 76, 61, 77, 76,
+      61, 62, 77, 62, 78, 77, 62, 63, 78, 63, 79, 78,
+      64, 65, 80, 65, 81, 80, 65, 66, 81, 66, 82, 81,
+      66, 67, 82, 67, 83, 82, 67, 68, 83, 68, 84, 83,
+      68, 69, 84, 69, 85, 84, 69, 70, 85, 70, 86, 85,
+      70, 71, 86, 71, 87, 86, 71, 72, 87, 72, 88, 87,
+      72, 73, 88, 73, 89, 88, 73, 74, 89, 74, 90, 89,
+      74, 75, 90, 75, 91, 90, 75, 76, 91, 76, 92, 91,
+      76, 77, 92, 77, 93, 92, 77, 78, 93, 78, 94, 93,
+      78, 79, 94, 79, 95, 94, 80, 81, 96, 81, 97, 96,
+      81, 82, 97, 82, 98, 97, 82, 83, 98, 83, 99, 98,
+      83, 84, 99, 84, 100, 99, 84, 85, 100, 85, 101, 100,
+      85, 86, 101, 86, 102, 101, 86, 87, 102, 87, 103, 102,
+      87, 88, 103, 88, 104, 103, 88, 89, 104, 89, 105, 104,
+      89, 90, 105, 90, 106, 105, 90, 91, 106, 91, 107, 106,
+      91, 92, 107, 92, 108, 107, 92, 93, 108, 93, 109, 108,
+      93, 94, 109, 94, 110, 109, 94, 95, 110, 95, 111, 110,
+      96, 97, 112, 97, 113, 112, 97, 98, 113, 98, 114, 113,
+      98, 99, 114, 99, 115, 114, 99, 100, 115, 100, 116, 115,
+      100, 101, 116, 101, 117, 116, 101, 102, 117, 102, 118, 117,
+      102, 103, 118, 103, 119, 118, 103, 104, 119, 104, 120, 119,
+      104, 105, 120, 105, 121, 120, 105, 106, 121, 106, 122, 121,
+      106, 107, 122, 107, 123, 122, 107, 108, 123, 108, 124, 123,
+      108, 109, 124, 109, 125, 124, 109, 110, 125, 110, 126, 125,
+      110, 111, 126, 111, 127, 126, 112, 113, 128, 113, 129, 128,
+      113, 114, 129, 114, 130, 129, 114, 115, 130, 115, 131, 130,
+      115, 116, 131, 116, 132, 131, 116, 117, 132, 117, 133, 132,
+      117, 118, 133, 118, 134, 133, 118, 119, 134, 119, 135, 134,
+      119, 120, 135, 120, 136, 135, 120, 121, 136, 121, 137, 136,
+      121, 122, 137, 122, 138, 137, 122, 123, 138, 123, 139, 138,
+      123, 124, 139, 124, 140, 139, 124, 125, 140, 125, 141, 140,
+      125, 126, 141, 126, 142, 141, 126, 127, 142, 127, 143, 142,
+      128, 129, 144, 129, 145, 144, 129, 130, 145, 130, 146, 145,
+      130, 131, 146, 131, 147, 146, 131, 132, 147, 132, 148, 147,
+      132, 133, 148, 133, 149, 148, 133, 134, 149, 134, 150, 149,
+      134, 135, 150, 135, 151, 150, 135, 136, 151, 136, 152, 151,
+      136, 137, 152, 137, 153, 152, 137, 138, 153, 138, 154, 153,
+      138, 139, 154, 139, 155, 154, 139, 140, 155, 140, 156, 155,
+      140, 141, 156, 141, 157, 156, 141, 142, 157, 142, 158, 157,
+      142, 143, 158, 143, 159, 158, 144, 145, 160, 145, 161, 160,
+      145, 146, 161, 146, 162, 161, 146, 147, 162, 147, 163, 162,
+      147, 148, 163, 148, 164, 163, 148, 149, 164, 149, 165, 164,
+      149, 150, 165, 150, 166, 165, 150, 151, 166, 151, 167, 166,
+      151, 152, 167, 152, 168, 167, 152, 153, 168, 153, 169, 168,
+      153, 154, 169, 154, 170, 169, 154, 155, 170, 155, 171, 170,
+      155, 156, 171, 156, 172, 171, 156, 157, 172, 157, 173, 172,
+      157, 158, 173, 158, 174, 173, 158, 159, 174, 159, 175, 174,
+      160, 161, 176, 161, 177, 176, 161, 162, 177, 162, 178, 177,
+      162, 163, 178, 163, 179, 178, 163, 164, 179, 164, 180, 179,
+      164, 165, 180, 165, 181, 180, 165, 166, 181, 166, 182, 181,
+      166, 167, 182, 167, 183, 182, 167, 168, 183, 168, 184, 183,
+      168, 169, 184, 169, 185, 184, 169, 170, 185, 170, 186, 185,
+      170, 171, 186, 171, 187, 186, 171, 172, 187, 172, 188, 187,
+      172, 173, 188, 173, 189, 188, 173, 174, 189, 174, 190, 189,
+      174, 175, 190, 175, 191, 190, 176, 177, 192, 177, 193, 192,
+      177, 178, 193, 178, 194, 193, 178, 179, 194, 179, 195, 194,
+      179, 180, 195, 180, 196, 195, 180, 181, 196, 181, 197, 196,
+      181, 182, 197, 182, 198, 197, 182, 183, 198, 183, 199, 198,
+      183, 184, 199, 184, 200, 199, 184, 185, 200, 185, 201, 200,
+      185, 186, 201, 186, 202, 201, 186, 187, 202, 187, 203, 202,
+      187, 188, 203, 188, 204, 203, 188, 189, 204, 189, 205, 204,
+      189, 190, 205, 190, 206, 205, 190, 191, 206, 191, 207, 206,
+      192, 193, 208, 193, 209, 208, 193, 194, 209, 194, 210, 209,
+      194, 195, 210, 195, 211, 210, 195, 196, 211, 196, 212, 211,
+      196, 197, 212, 197, 213, 212, 197, 198, 213, 198, 214, 213,
+      198, 199, 214, 199, 215, 214, 199, 200, 215, 200, 216, 215,
+      200, 201, 216, 201, 217, 216, 201, 202, 217, 202, 218, 217,
+      202, 203, 218, 203, 219, 218, 203, 204, 219, 204, 220, 219,
+      204, 205, 220, 205, 221, 220, 205, 206, 221, 206, 222, 221,
+      206, 207, 222, 207, 223, 222, 208, 209, 224, 209, 225, 224,
+      209, 210, 225, 210, 226, 225, 210, 211, 226, 211, 227, 226,
+      211, 212, 227, 212, 228, 227, 212, 213, 228, 213, 229, 228,
+      213, 214, 229, 214, 230, 229, 214, 215, 230, 215, 231, 230,
+      215, 216, 231, 216, 232, 231, 216, 217, 232, 217, 233, 232,
+      217, 218, 233, 218, 234, 233, 218, 219, 234, 219, 235, 234,
+      219, 220, 235, 220, 236, 235, 220, 221, 236, 221, 237, 236,
+      221, 222, 237, 222, 238, 237, 222, 223, 238, 223, 239, 238,
+      224, 225, 240, 225, 241, 240, 225, 226, 241, 226, 242, 241,
+      226, 227, 242, 227, 243, 242, 227, 228, 243, 228, 244, 243,
+      228, 229, 244, 229, 245, 244, 229, 230, 245, 230, 246, 245,
+      230, 231, 246, 231, 247, 246, 231, 232, 247, 232, 248, 247,
+      232, 233, 248, 233, 249, 248, 233, 234, 249, 234, 250, 249,
+      234, 235, 250, 235, 251, 250, 235, 236, 251, 236, 252, 251,
+      236, 237, 252, 237, 253, 252, 237, 238, 253, 238, 254, 253,
+      238, 239, 254, 239, 255, 254
+   };
+
+   // tilings/hexagon_16x16
+   constexpr float m_tilings_hexagon_16x16_vertex[] =
+   {
+      0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+      3.0f, 0.0f, 0.0f, 4.0f, 0.0f, 0.0f,
+      6.0f, 0.0f, 0.0f, 7.0f, 0.0f, 0.0f,
+      9.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+      12.0f, 0.0f, 0.0f, 13.0f, 0.0f, 0.0f,
+      15.0f, 0.0f, 0.0f, 16.0f, 0.0f, 0.0f,
+      18.0f, 0.0f, 0.0f, 19.0f, 0.0f, 0.0f,
+      21.0f, 0.0f, 0.0f, 22.0f, 0.0f, 0.0f,
+      -0.5f, 0.866025388f, 0.0f, 1.5f, 0.866025388f, 0.0f,
+      2.5f, 0.866025388f, 0.0f, 4.5f, 0.866025388f, 0.0f,
+      5.5f, 0.866025388f, 0.0f, 7.5f, 0.866025388f, 0.0f,
+      8.5f, 0.866025388f, 0.0f, 10.5f, 0.866025388f, 0.0f,
+      11.5f, 0.866025388f, 0.0f, 13.5f, 0.866025388f, 0.0f,
+      14.5f, 0.866025388f, 0.0f, 16.5f, 0.866025388f, 0.0f,
+      17.5f, 0.866025388f, 0.0f, 19.5f, 0.866025388f, 0.0f,
+      20.5f, 0.866025388f, 0.0f, 22.5f, 0.866025388f, 0.0f,
+      0.0f, 1.73205078f, 0.0f, 1.0f, 1.73205078f, 0.0f,
+      3.0f, 1.73205078f, 0.0f, 4.0f, 1.73205078f, 0.0f,
+      6.0f, 1.73205078f, 0.0f, 7.0f, 1.73205078f, 0.0f,
+      9.0f, 1.73205078f, 0.0f, 10.0f, 1.73205078f, 0.0f,
+      12.0f, 1.73205078f, 0.0f, 13.0f, 1.73205078f, 0.0f,
+      15.0f, 1.73205078f, 0.0f, 16.0f, 1.73205078f, 0.0f,
+      18.0f, 1.73205078f, 0.0f, 19.0f, 1.73205078f, 0.0f,
+      21.0f, 1.73205078f, 0.0f, 22.0f, 1.73205078f, 0.0f,
+      -0.5f, 2.59807611f, 0.0f, 1.5f, 2.59807611f, 0.0f,
+      2.5f, 2.59807611f, 0.0f, 4.5f, 2.59807611f, 0.0f,
+      5.5f, 2.59807611f, 0.0f, 7.5f, 2.59807611f, 0.0f,
+      8.5f, 2.59807611f, 0.0f, 10.5f, 2.59807611f, 0.0f,
+      11.5f, 2.59807611f, 0.0f, 13.5f, 2.59807611f, 0.0f,
+      14.5f, 2.59807611f, 0.0f, 16.5f, 2.59807611f, 0.0f,
+      17.5f, 2.59807611f, 0.0f, 19.5f, 2.59807611f, 0.0f,
+      20.5f, 2.59807611f, 0.0f, 22.5f, 2.59807611f, 0.0f,
+      0.0f, 3.46410155f, 0.0f, 1.0f, 3.46410155f, 0.0f,
+      3.0f, 3.46410155f, 0.0f, 4.0f, 3.46410155f, 0.0f,
+      6.0f, 3.46410155f, 0.0f, 7.0f, 3.46410155f, 0.0f,
+      9.0f, 3.46410155f, 0.0f, 10.0f, 3.46410155f, 0.0f,
+      12.0f, 3.46410155f, 0.0f, 13.0f, 3.46410155f, 0.0f,
+      15.0f, 3.46410155f, 0.0f, 16.0f, 3.46410155f, 0.0f,
+      18.0f, 3.46410155f, 0.0f, 19.0f, 3.46410155f, 0.0f,
+      21.0f, 3.46410155f, 0.0f, 22.0f, 3.46410155f, 0.0f,
+      -0.5f, 4.33012676f, 0.0f, 1.5f, 4.33012676f, 0.0f,
+      2.5f, 4.33012676f, 0.0f, 4.5f, 4.33012676f, 0.0f,
+      5.5f, 4.33012676f, 0.0f, 7.5f, 4.33012676f, 0.0f,
+      8.5f, 4.33012676f, 0.0f, 10.5f, 4.33012676f, 0.0f,
+      11.5f, 4.33012676f, 0.0f, 13.5f, 4.33012676f, 0.0f,
+      14.5f, 4.33012676f, 0.0f, 16.5f, 4.33012676f, 0.0f,
+      17.5f, 4.33012676f, 0.0f, 19.5f, 4.33012676f, 0.0f,
+      20.5f, 4.33012676f, 0.0f, 22.5f, 4.33012676f, 0.0f,
+      0.0f, 5.19615221f, 0.0f, 1.0f, 5.19615221f, 0.0f,
+      3.0f, 5.19615221f, 0.0f, 4.0f, 5.19615221f, 0.0f,
+      6.0f, 5.19615221f, 0.0f, 7.0f, 5.19615221f, 0.0f,
+      9.0f, 5.19615221f, 0.0f, 10.0f, 5.19615221f, 0.0f,
+      12.0f, 5.19615221f, 0.0f, 13.0f, 5.19615221f, 0.0f,
+      15.0f, 5.19615221f, 0.0f, 16.0f, 5.19615221f, 0.0f,
+      18.0f, 5.19615221f, 0.0f, 19.0f, 5.19615221f, 0.0f,
+      21.0f, 5.19615221f, 0.0f, 22.0f, 5.19615221f, 0.0f,
+      -0.5f, 6.06217766f, 0.0f, 1.5f, 6.06217766f, 0.0f,
+      2.5f, 6.06217766f, 0.0f, 4.5f, 6.06217766f, 0.0f,
+      5.5f, 6.06217766f, 0.0f, 7.5f, 6.06217766f, 0.0f,
+      8.5f, 6.06217766f, 0.0f, 10.5f, 6.06217766f, 0.0f,
+      11.5f, 6.06217766f, 0.0f, 13.5f, 6.06217766f, 0.0f,
+      14.5f, 6.06217766f, 0.0f, 16.5f, 6.06217766f, 0.0f,
+      17.5f, 6.06217766f, 0.0f, 19.5f, 6.06217766f, 0.0f,
+      20.5f, 6.06217766f, 0.0f, 22.5f, 6.06217766f, 0.0f,
+      0.0f, 6.92820311f, 0.0f, 1.0f, 6.92820311f, 0.0f,
+      3.0f, 6.92820311f, 0.0f, 4.0f, 6.92820311f, 0.0f,
+      6.0f, 6.92820311f, 0.0f, 7.0f, 6.92820311f, 0.0f,
+      9.0f, 6.92820311f, 0.0f, 10.0f, 6.92820311f, 0.0f,
+      12.0f, 6.92820311f, 0.0f, 13.0f, 6.92820311f, 0.0f,
+      15.0f, 6.92820311f, 0.0f, 16.0f, 6.92820311f, 0.0f,
+      18.0f, 6.92820311f, 0.0f, 19.0f, 6.92820311f, 0.0f,
+      21.0f, 6.92820311f, 0.0f, 22.0f, 6.92820311f, 0.0f,
+      -0.5f, 7.79422855f, 0.0f, 1.5f, 7.79422855f, 0.0f,
+      2.5f, 7.79422855f, 0.0f, 4.5f, 7.79422855f, 0.0f,
+      5.5f, 7.79422855f, 0.0f, 7.5f, 7.79422855f, 0.0f,
+      8.5f, 7.79422855f, 0.0f, 10.5f, 7.79422855f, 0.0f,
+      11.5f, 7.79422855f, 0.0f, 13.5f, 7.79422855f, 0.0f,
+      14.5f, 7.79422855f, 0.0f, 16.5f, 7.79422855f, 0.0f,
+      17.5f, 7.79422855f, 0.0f, 19.5f, 7.79422855f, 0.0f,
+      20.5f, 7.79422855f, 0.0f, 22.5f, 7.79422855f, 0.0f,
+      0.0f, 8.66025352f, 0.0f, 1.0f, 8.66025352f, 0.0f,
+      3.0f, 8.66025352f, 0.0f, 4.0f, 8.66025352f, 0.0f,
+      6.0f, 8.66025352f, 0.0f, 7.0f, 8.66025352f, 0.0f,
+      9.0f, 8.66025352f, 0.0f, 10.0f, 8.66025352f, 0.0f,
+      12.0f, 8.66025352f, 0.0f, 13.0f, 8.66025352f, 0.0f,
+      15.0f, 8.66025352f, 0.0f, 16.0f, 8.66025352f, 0.0f,
+      18.0f, 8.66025352f, 0.0f, 19.0f, 8.66025352f, 0.0f,
+      21.0f, 8.66025352f, 0.0f, 22.0f, 8.66025352f, 0.0f,
+      -0.5f, 9.52627945f, 0.0f, 1.5f, 9.52627945f, 0.0f,
+      2.5f, 9.52627945f, 0.0f, 4.5f, 9.52627945f, 0.0f,
+      5.5f, 9.52627945f, 0.0f, 7.5f, 9.52627945f, 0.0f,
+      8.5f, 9.52627945f, 0.0f, 10.5f, 9.52627945f, 0.0f,
+      11.5f, 9.52627945f, 0.0f, 13.5f, 9.52627945f, 0.0f,
+      14.5f, 9.52627945f, 0.0f, 16.5f, 9.52627945f, 0.0f,
+      17.5f, 9.52627945f, 0.0f, 19.5f, 9.52627945f, 0.0f,
+      20.5f, 9.52627945f, 0.0f, 22.5f, 9.52627945f, 0.0f,
+      0.0f, 10.3923044f, 0.0f, 1.0f, 10.3923044f, 0.0f,
+      3.0f, 10.3923044f, 0.0f, 4.0f, 10.3923044f, 0.0f,
+      6.0f, 10.3923044f, 0.0f, 7.0f, 10.3923044f, 0.0f,
+      9.0f, 10.3923044f, 0.0f, 10.0f, 10.3923044f, 0.0f,
+      12.0f, 10.3923044f, 0.0f, 13.0f, 10.3923044f, 0.0f,
+      15.0f, 10.3923044f, 0.0f, 16.0f, 10.3923044f, 0.0f,
+      18.0f, 10.3923044f, 0.0f, 19.0f, 10.3923044f, 0.0f,
+      21.0f, 10.3923044f, 0.0f, 22.0f, 10.3923044f, 0.0f,
+      -0.5f, 11.2583303f, 0.0f, 1.5f, 11.2583303f, 0.0f,
+      2.5f, 11.2583303f, 0.0f, 4.5f, 11.2583303f, 0.0f,
+      5.5f, 11.2583303f, 0.0f, 7.5f, 11.2583303f, 0.0f,
+      8.5f, 11.2583303f, 0.0f, 10.5f, 11.2583303f, 0.0f,
+      11.5f, 11.2583303f, 0.0f, 13.5f, 11.2583303f, 0.0f,
+      14.5f, 11.2583303f, 0.0f, 16.5f, 11.2583303f, 0.0f,
+      17.5f, 11.2583303f, 0.0f, 19.5f, 11.2583303f, 0.0f,
+      20.5f, 11.2583303f, 0.0f, 22.5f, 11.2583303f, 0.0f,
+      0.0f, 12.1243553f, 0.0f, 1.0f, 12.1243553f, 0.0f,
+      3.0f, 12.1243553f, 0.0f, 4.0f, 12.1243553f, 0.0f,
+      6.0f, 12.1243553f, 0.0f, 7.0f, 12.1243553f, 0.0f,
+      9.0f, 12.1243553f, 0.0f, 10.0f, 12.1243553f, 0.0f,
+      12.0f, 12.1243553f, 0.0f, 13.0f, 12.1243553f, 0.0f,
+      15.0f, 12.1243553f, 0.0f, 16.0f, 12.1243553f, 0.0f,
+      18.0f, 12.1243553f, 0.0f, 19.0f, 12.1243553f, 0.0f,
+      21.0f, 12.1243553f, 0.0f, 22.0f, 12.1243553f, 0.0f,
+      -0.5f, 12.9903812f, 0.0f, 1.5f, 12.9903812f, 0.0f,
+      2.5f, 12.9903812f, 0.0f, 4.5f, 12.9903812f, 0.0f,
+      5.5f, 12.9903812f, 0.0f, 7.5f, 12.9903812f, 0.0f,
+      8.5f, 12.9903812f, 0.0f, 10.5f, 12.9903812f, 0.0f,
+      11.5f, 12.9903812f, 0.0f, 13.5f, 12.9903812f, 0.0f,
+      14.5f, 12.9903812f, 0.0f, 16.5f, 12.9903812f, 0.0f,
+      17.5f, 12.9903812f, 0.0f, 19.5f, 12.9903812f, 0.0f,
+      20.5f, 12.9903812f, 0.0f, 22.5f, 12.9903812f, 0.0f
+   };
+   constexpr int m_tilings_hexagon_16x16_faceStart[] =
+   {
+      0, 6, 12, 18, 24, 30, 36, 42, 48, 54, 60, 66,
+      72, 78, 84, 90, 96, 102, 108, 114, 120, 126, 132, 138,
+      144, 150, 156, 162, 168, 174, 180, 186, 192, 198, 204, 210,
+      216, 222, 228, 234, 240, 246, 252, 258, 264, 270, 276, 282,
+      288, 294, 300, 306, 312, 318, 324, 330, 336, 342, 348, 354,
+      360, 366, 372, 378, 384, 390, 396, 402, 408, 414, 420, 426,
+      432, 438, 444, 450, 456, 462, 468, 474, 480, 486, 492, 498,
+      504, 510, 516, 522, 528, 534, 540, 546, 552, 558, 564, 570,
+      576, 582, 588, 594, 600, 606, 612, 618, 624, 630
+   };
+   constexpr int m_tilings_hexagon_16x16_faceIndex[] =
+   {
+      0, 1, 17, 33, 32, 16, 2, 3, 19, 35, 34, 18,
+      4, 5, 21, 37, 36, 20, 6, 7, 23, 39, 38, 22,
+      8, 9, 25, 41, 40, 24, 10, 11, 27, 43, 42, 26,
+      12, 13, 29, 45, 44, 28, 14, 15, 31, 47, 46, 30,
+      17, 18, 34, 50, 49, 33, 19, 20, 36, 52, 51, 35,
+      21, 22, 38, 54, 53, 37, 23, 24, 40, 56, 55, 39,
+      25, 26, 42, 58, 57, 41, 27, 28, 44, 60, 59, 43,
+      29, 30, 46, 62, 61, 45, 32, 33, 49, 65, 64, 48,
+      34, 35, 51, 67, 66, 50, 36, 37, 53, 69, 68, 52,
+      38, 39, 55, 71, 70, 54, 40, 41, 57, 73, 72, 56,
+      42, 43, 59, 75, 74, 58, 44, 45, 61, 77, 76, 60,
+      46, 47, 63, 79, 78, 62, 49, 50, 66, 82, 81, 65,
+      51, 52, 68, 84, 83, 67, 53, 54, 70, 86, 85, 69,
+      55, 56, 72, 88, 87, 71, 57, 58, 74, 90, 89, 73,
+      59, 60, 76, 92, 91, 75, 61, 62, 78, 94, 93, 77,
+      64, 65, 81, 97, 96, 80, 66, 67, 83, 99, 98, 82,
+      68, 69, 85, 101, 100, 84, 70, 71, 87, 103, 102, 86,
+      72, 73, 89, 105, 104, 88, 74, 75, 91, 107, 106, 90,
+      76, 77, 93, 109, 108, 92, 78, 79, 95, 111, 110, 94,
+      81, 82, 98, 114, 113, 97, 83, 84, 100, 116, 115, 99,
+      85, 86, 102, 118, 117, 101, 87, 88, 104, 120, 119, 103,
+      89, 90, 106, 122, 121, 105, 91, 92, 108, 124, 123, 107,
+      93, 94, 110, 126, 125, 109, 96, 97, 113, 129, 128, 112,
+      98, 99, 115, 131, 130, 114, 100, 101, 117, 133, 132, 116,
+      102, 103, 119, 135, 134, 118, 104, 105, 121, 137, 136, 120,
+      106, 107, 123, 139, 138, 122, 108, 109, 125, 141, 140, 124,
+      110, 111, 127, 143, 142, 126, 113, 114, 130, 146, 145, 129,
+      115, 116, 132, 148, 147, 131, 117, 118, 134, 150, 149, 133,
+      119, 120, 136, 152, 151, 135, 121, 122, 138, 154, 153, 137,
+      123, 124, 140, 156, 155, 139, 125, 126, 142, 158, 157, 141,
+      128, 129, 145, 161, 160, 144, 130, 131, 147, 163, 162, 146,
+      132, 133, 149, 165, 164, 148, 134, 135, 151, 167, 166, 150,
+      136, 137, 153, 169, 168, 152, 138, 139, 155, 171, 170, 154,
+      140, 141, 157, 173, 172, 156, 142, 143, 159, 175, 174, 158,
+      145, 146, 162, 178, 177, 161, 147, 148, 164, 180, 179, 163,
+      149, 150, 166, 182, 181, 165, 151, 152, 168, 184, 183, 167,
+      153, 154, 170, 186, 185, 169, 155, 156, 172, 188, 187, 171,
+      157, 158, 174, 190, 189, 173, 160, 161, 177, 193, 192, 176,
+      162, 163, 179, 195, 194, 178, 164, 165, 181, 197, 196, 180,
+      166, 167, 183, 199, 198, 182, 168, 169, 185, 201, 200, 184,
+      170, 171, 187, 203, 202, 186, 172, 173, 189, 205, 204, 188,
+      174, 175, 191, 207, 206, 190, 177, 178, 194, 210, 209, 193,
+      179, 180, 196, 212, 211, 195, 181, 182, 198, 214, 213, 197,
+      183, 184, 200, 216, 215, 199, 185, 186, 202, 218, 217, 201,
+      187, 188, 204, 220, 219, 203, 189, 190, 206, 222, 221, 205,
+      192, 193, 209, 225, 224, 208, 194, 195, 211, 227, 226, 210,
+      196, 197, 213, 229, 228, 212, 198, 199, 215, 231, 230, 214,
+      200, 201, 217, 233, 232, 216, 202, 203, 219, 235, 234, 218,
+      204, 205, 221, 237, 236, 220, 206, 207, 223, 239, 238, 222,
+      209, 210, 226, 242, 241, 225, 211, 212, 228, 244, 243, 227,
+      213, 214, 230, 246, 245, 229, 215, 216, 232, 248, 247, 231,
+      217, 218, 234, 250, 249, 233, 219, 220, 236, 252, 251, 235,
+      221, 222, 238, 254, 253, 237
+   };
+
+   // tilings/semi1_16x16
+   constexpr float m_tilings_semi1_16x16_vertex[] =
+   {
+      0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+      2.0f, 0.0f, 0.0f, 3.0f, 0.0f, 0.0f,
+      4.0f, 0.0f, 0.0f, 5.0f, 0.0f, 0.0f,
+      6.0f, 0.0f, 0.0f, 7.0f, 0.0f, 0.0f,
+      8.0f, 0.0f, 0.0f, 9.0f, 0.0f, 0.0f,
+      10.0f, 0.0f, 0.0f, 11.0f, 0.0f, 0.0f,
+      12.0f, 0.0f, 0.0f, 13.0f, 0.0f, 0.0f,
+      14.0f, 0.0f, 0.0f, 15.0f, 0.0f, 0.0f,
+      0.5f, 0.866025388f, 0.0f, 1.5f, 0.866025388f, 0.0f,
+      2.5f, 0.866025388f, 0.0f, 3.5f, 0.866025388f, 0.0f,
+      4.5f, 0.866025388f, 0.0f, 5.5f, 0.866025388f, 0.0f,
+      6.5f, 0.866025388f, 0.0f, 7.5f, 0.866025388f, 0.0f,
+      8.5f, 0.866025388f, 0.0f, 9.5f, 0.866025388f, 0.0f,
+      10.5f, 0.866025388f, 0.0f, 11.5f, 0.866025388f, 0.0f,
+      12.5f, 0.866025388f, 0.0f, 13.5f, 0.866025388f, 0.0f,
+      14.5f, 0.866025388f, 0.0f, 15.5f, 0.866025388f, 0.0f,
+      1.0f, 1.73205078f, 0.0f, 2.0f, 1.73205078f, 0.0f,
+      3.0f, 1.73205078f, 0.0f, 4.0f, 1.73205078f, 0.0f,
+      5.0f, 1.73205078f, 0.0f, 6.0f, 1.73205078f, 0.0f,
+      7.0f, 1.73205078f, 0.0f, 8.0f, 1.73205078f, 0.0f,
+      9.0f, 1.73205078f, 0.0f, 10.0f, 1.73205078f, 0.0f,
+      11.0f, 1.73205078f, 0.0f, 12.0f, 1.73205078f, 0.0f,
+      13.0f, 1.73205078f, 0.0f, 14.0f, 1.73205078f, 0.0f,
+      15.0f, 1.73205078f, 0.0f, 16.0f, 1.73205078f, 0.0f,
+      1.5f, 2.59807611f, 0.0f, 2.5f, 2.59807611f, 0.0f,
+      3.5f, 2.59807611f, 0.0f, 4.5f, 2.59807611f, 0.0f,
+      5.5f, 2.59807611f, 0.0f, 6.5f, 2.59807611f, 0.0f,
+      7.5f, 2.59807611f, 0.0f, 8.5f, 2.59807611f, 0.0f,
+      9.5f, 2.59807611f, 0.0f, 10.5f, 2.59807611f, 0.0f,
+      11.5f, 2.59807611f, 0.0f, 12.5f, 2.59807611f, 0.0f,
+      13.5f, 2.59807611f, 0.0f, 14.5f, 2.59807611f, 0.0f,
+      15.5f, 2.59807611f, 0.0f, 16.5f, 2.59807611f, 0.0f,
+      2.0f, 3.46410155f, 0.0f, 3.0f, 3.46410155f, 0.0f,
+      4.0f, 3.46410155f, 0.0f, 5.0f, 3.46410155f, 0.0f,
+      6.0f, 3.46410155f, 0.0f, 7.0f, 3.46410155f, 0.0f,
+      8.0f, 3.46410155f, 0.0f, 9.0f, 3.46410155f, 0.0f,
+      10.0f, 3.46410155f, 0.0f, 11.0f, 3.46410155f, 0.0f,
+      12.0f, 3.46410155f, 0.0f, 13.0f, 3.46410155f, 0.0f,
+      14.0f, 3.46410155f, 0.0f, 15.0f, 3.46410155f, 0.0f,
+      16.0f, 3.46410155f, 0.0f, 17.0f, 3.46410155f, 0.0f,
+      2.5f, 4.33012676f, 0.0f, 3.5f, 4.33012676f, 0.0f,
+      4.5f, 4.33012676f, 0.0f, 5.5f, 4.33012676f, 0.0f,
+      6.5f, 4.33012676f, 0.0f, 7.5f, 4.33012676f, 0.0f,
+      8.5f, 4.33012676f, 0.0f, 9.5f, 4.33012676f, 0.0f,
+      10.5f, 4.33012676f, 0.0f, 11.5f, 4.33012676f, 0.0f,
+      12.5f, 4.33012676f, 0.0f, 13.5f, 4.33012676f, 0.0f,
+      14.5f, 4.33012676f, 0.0f, 15.5f, 4.33012676f, 0.0f,
+      16.5f, 4.33012676f, 0.0f, 17.5f, 4.33012676f, 0.0f,
+      3.0f, 5.19615221f, 0.0f, 4.0f, 5.19615221f, 0.0f,
+      5.0f, 5.19615221f, 0.0f, 6.0f, 5.19615221f, 0.0f,
+      7.0f, 5.19615221f, 0.0f, 8.0f, 5.19615221f, 0.0f,
+      9.0f, 5.19615221f, 0.0f, 10.0f, 5.19615221f, 0.0f,
+      11.0f, 5.19615221f, 0.0f, 12.0f, 5.19615221f, 0.0f,
+      13.0f, 5.19615221f, 0.0f, 14.0f, 5.19615221f, 0.0f,
+      15.0f, 5.19615221f, 0.0f, 16.0f, 5.19615221f, 0.0f,
+      17.0f, 5.19615221f, 0.0f, 18.0f, 5.19615221f, 0.0f,
+      3.5f, 6.06217766f, 0.0f, 4.5f, 6.06217766f, 0.0f,
+      5.5f, 6.06217766f, 0.0f, 6.5f, 6.06217766f, 0.0f,
+      7.5f, 6.06217766f, 0.0f, 8.5f, 6.06217766f, 0.0f,
+      9.5f, 6.06217766f, 0.0f, 10.5f, 6.06217766f, 0.0f,
+      11.5f, 6.06217766f, 0.0f, 12.5f, 6.06217766f, 0.0f,
+      13.5f, 6.06217766f, 0.0f, 14.5f, 6.06217766f, 0.0f,
+      15.5f, 6.06217766f, 0.0f, 16.5f, 6.06217766f, 0.0f,
+      17.5f, 6.06217766f, 0.0f, 18.5f, 6.06217766f, 0.0f,
+      4.0f, 6.92820311f, 0.0f, 5.0f, 6.92820311f, 0.0f,
+      6.0f, 6.92820311f, 0.0f, 7.0f, 6.92820311f, 0.0f,
+      8.0f, 6.92820311f, 0.0f, 9.0f, 6.92820311f, 0.0f,
+      10.0f, 6.92820311f, 0.0f, 11.0f, 6.92820311f, 0.0f,
+      12.0f, 6.92820311f, 0.0f, 13.0f, 6.92820311f, 0.0f,
+      14.0f, 6.92820311f, 0.0f, 15.0f, 6.92820311f, 0.0f,
+      16.0f, 6.92820311f, 0.0f, 17.0f, 6.92820311f, 0.0f,
+      18.0f, 6.92820311f, 0.0f, 19.0f, 6.92820311f, 0.0f,
+      4.5f, 7.79422855f, 0.0f, 5.5f, 7.79422855f, 0.0f,
+      6.5f, 7.79422855f, 0.0f, 7.5f, 7.79422855f, 0.0f,
+      8.5f, 7.79422855f, 0.0f, 9.5f, 7.79422855f, 0.0f,
+      10.5f, 7.79422855f, 0.0f, 11.5f, 7.79422855f, 0.0f,
+      12.5f, 7.79422855f, 0.0f, 13.5f, 7.79422855f, 0.0f,
+      14.5f, 7.79422855f, 0.0f, 15.5f, 7.79422855f, 0.0f,
+      16.5f, 7.79422855f, 0.0f, 17.5f, 7.79422855f, 0.0f,
+      18.5f, 7.79422855f, 0.0f, 19.5f, 7.79422855f, 0.0f,
+      5.0f, 8.66025352f, 0.0f, 6.0f, 8.66025352f, 0.0f,
+      7.0f, 8.66025352f, 0.0f, 8.0f, 8.66025352f, 0.0f,
+      9.0f, 8.66025352f, 0.0f, 10.0f, 8.66025352f, 0.0f,
+      11.0f, 8.66025352f, 0.0f, 12.0f, 8.66025352f, 0.0f,
+      13.0f, 8.66025352f, 0.0f, 14.0f, 8.66025352f, 0.0f,
+      15.0f, 8.66025352f, 0.0f, 16.0f, 8.66025352f, 0.0f,
+      17.0f, 8.66025352f, 0.0f, 18.0f, 8.66025352f, 0.0f,
+      19.0f, 8.66025352f, 0.0f, 20.0f, 8.66025352f, 0.0f,
+      5.5f, 9.52627945f, 0.0f, 6.5f, 9.52627945f, 0.0f,
+      7.5f, 9.52627945f, 0.0f, 8.5f, 9.52627945f, 0.0f,
+      9.5f, 9.52627945f, 0.0f, 10.5f, 9.52627945f, 0.0f,
+      11.5f, 9.52627945f, 0.0f, 12.5f, 9.52627945f, 0.0f,
+      13.5f, 9.52627945f, 0.0f, 14.5f, 9.52627945f, 0.0f,
+      15.5f, 9.52627945f, 0.0f, 16.5f, 9.52627945f, 0.0f,
+      17.5f, 9.52627945f, 0.0f, 18.5f, 9.52627945f, 0.0f,
+      19.5f, 9.52627945f, 0.0f, 20.5f, 9.52627945f, 0.0f,
+      6.0f, 10.3923044f, 0.0f, 7.0f, 10.3923044f, 0.0f,
+      8.0f, 10.3923044f, 0.0f, 9.0f, 10.3923044f, 0.0f,
+      10.0f, 10.3923044f, 0.0f, 11.0f, 10.3923044f, 0.0f,
+      12.0f, 10.3923044f, 0.0f, 13.0f, 10.3923044f, 0.0f,
+      14.0f, 10.3923044f, 0.0f, 15.0f, 10.3923044f, 0.0f,
+      16.0f, 10.3923044f, 0.0f, 17.0f, 10.3923044f, 0.0f,
+      18.0f, 10.3923044f, 0.0f, 19.0f, 10.3923044f, 0.0f,
+      20.0f, 10.3923044f, 0.0f, 21.0f, 10.3923044f, 0.0f,
+      6.5f, 11.2583303f, 0.0f, 7.5f, 11.2583303f, 0.0f,
+      8.5f, 11.2583303f, 0.0f, 9.5f, 11.2583303f, 0.0f,
+      10.5f, 11.2583303f, 0.0f, 11.5f, 11.2583303f, 0.0f,
+      12.5f, 11.2583303f, 0.0f, 13.5f, 11.2583303f, 0.0f,
+      14.5f, 11.2583303f, 0.0f, 15.5f, 11.2583303f, 0.0f,
+      16.5f, 11.2583303f, 0.0f, 17.5f, 11.2583303f, 0.0f,
+      18.5f, 11.2583303f, 0.0f, 19.5f, 11.2583303f, 0.0f,
+      20.5f, 11.2583303f, 0.0f, 21.5f, 11.2583303f, 0.0f,
+      7.0f, 12.1243553f, 0.0f, 8.0f, 12.1243553f, 0.0f,
+      9.0f, 12.1243553f, 0.0f, 10.0f, 12.1243553f, 0.0f,
+      11.0f, 12.1243553f, 0.0f, 12.0f, 12.1243553f, 0.0f,
+      13.0f, 12.1243553f, 0.0f, 14.0f, 12.1243553f, 0.0f,
+      15.0f, 12.1243553f, 0.0f, 16.0f, 12.1243553f, 0.0f,
+      17.0f, 12.1243553f, 0.0f, 18.0f, 12.1243553f, 0.0f,
+      19.0f, 12.1243553f, 0.0f, 20.0f, 12.1243553f, 0.0f,
+      21.0f, 12.1243553f, 0.0f, 22.0f, 12.1243553f, 0.0f,
+      7.5f, 12.9903812f, 0.0f, 8.5f, 12.9903812f, 0.0f,
+      9.5f, 12.9903812f, 0.0f, 10.5f, 12.9903812f, 0.0f,
+      11.5f, 12.9903812f, 0.0f, 12.5f, 12.9903812f, 0.0f,
+      13.5f, 12.9903812f, 0.0f, 14.5f, 12.9903812f, 0.0f,
+      15.5f, 12.9903812f, 0.0f, 16.5f, 12.9903812f, 0.0f,
+      17.5f, 12.9903812f, 0.0f, 18.5f, 12.9903812f, 0.0f,
+      19.5f, 12.9903812f, 0.0f, 20.5f, 12.9903812f, 0.0f,
+      21.5f, 12.9903812f, 0.0f, 22.5f, 12.9903812f, 0.0f
+   };
+   constexpr int m_tilings_semi1_16x16_faceStart[] =
+   {
+      0, 3, 9, 12, 15, 18, 21, 24, 27, 30, 33, 39,
+      42, 45, 48, 51, 54, 57, 60, 63, 66, 69, 72, 78,
+      81, 84, 87, 90, 93, 96, 99, 102, 108, 111, 114, 117,
+      120, 123, 129, 132, 135, 138, 141, 144, 147, 150, 153, 159,
+      162, 165, 168, 171, 174, 177, 180, 183, 186, 189, 192, 195,
+      198, 204, 207, 210, 213, 216, 219, 222, 225, 228, 234, 237,
+      240, 243, 246, 249, 255, 258, 261, 264, 267, 270, 273, 276,
+      279, 285, 288, 291, 294, 297, 300, 303, 306, 309, 312, 315,
+      318, 321, 324, 330, 333, 336, 339, 342, 345, 348, 351, 354,
+      360, 363, 366, 369, 375, 378, 381, 384, 387, 390, 393, 396,
+      399, 405, 408, 411, 414, 417, 420, 423, 429, 432, 435, 438,
+      441, 444, 447, 450, 453, 459, 462, 465, 468, 471, 474, 477,
+      480, 483, 486, 489, 492, 498, 501, 504, 507, 510, 513, 516,
+      519, 522, 528, 531, 534, 537, 540, 543, 549, 552, 555, 558,
+      561, 564, 567, 570, 573, 579, 582, 585, 588, 591, 594, 597,
+      600, 603, 606, 609, 612, 615, 618, 624, 627, 630, 633, 636,
+      639, 642, 645, 648, 654, 657, 660, 663, 666, 669, 675, 678,
+      681, 684, 687, 690, 693, 696, 699, 705, 708, 711, 714, 717,
+      720, 723, 726, 729, 732, 735, 738, 741, 744, 750, 753, 756,
+      759, 762, 765, 768, 771, 774, 780, 783, 786, 789, 795, 798,
+      801, 804, 807, 810, 813, 816, 819, 825, 828, 831, 834, 837,
+      840
+   };
+   constexpr int m_tilings_semi1_16x16_faceIndex[] =
+   {
+      18, 34, 33, 18, 33, 32, 16, 1, 2, 18, 19, 34,
+      19, 35, 34, 19, 20, 35, 20, 36, 35, 20, 21, 36,
+      22, 23, 38, 23, 39, 38, 25, 41, 40, 25, 40, 39,
+      23, 8, 9, 25, 26, 41, 26, 42, 41, 26, 27, 42,
+      27, 43, 42, 27, 28, 43, 29, 30, 45, 30, 46, 45,
+      33, 34, 49, 35, 36, 51, 36, 52, 51, 38, 54, 53,
+      38, 53, 52, 36, 21, 22, 38, 39, 54, 39, 55, 54,
+      39, 40, 55, 40, 56, 55, 40, 41, 56, 42, 43, 58,
+      43, 59, 58, 45, 61, 60, 45, 60, 59, 43, 28, 29,
+      45, 46, 61, 46, 62, 61, 46, 47, 62, 47, 63, 62,
+      51, 67, 66, 51, 66, 65, 49, 34, 35, 51, 52, 67,
+      52, 68, 67, 52, 53, 68, 53, 69, 68, 53, 54, 69,
+      55, 56, 71, 56, 72, 71, 58, 74, 73, 58, 73, 72,
+      56, 41, 42, 58, 59, 74, 59, 75, 74, 59, 60, 75,
+      60, 76, 75, 60, 61, 76, 62, 63, 78, 63, 79, 78,
+      65, 66, 81, 66, 82, 81, 66, 67, 82, 68, 69, 84,
+      69, 85, 84, 71, 87, 86, 71, 86, 85, 69, 54, 55,
+      71, 72, 87, 72, 88, 87, 72, 73, 88, 73, 89, 88,
+      73, 74, 89, 75, 76, 91, 76, 92, 91, 78, 94, 93,
+      78, 93, 92, 76, 61, 62, 78, 79, 94, 79, 95, 94,
+      81, 82, 97, 82, 98, 97, 84, 100, 99, 84, 99, 98,
+      82, 67, 68, 84, 85, 100, 85, 101, 100, 85, 86, 101,
+      86, 102, 101, 86, 87, 102, 88, 89, 104, 89, 105, 104,
+      91, 107, 106, 91, 106, 105, 89, 74, 75, 91, 92, 107,
+      92, 108, 107, 92, 93, 108, 93, 109, 108, 93, 94, 109,
+      97, 98, 113, 98, 114, 113, 98, 99, 114, 99, 115, 114,
+      99, 100, 115, 101, 102, 117, 102, 118, 117, 104, 120, 119,
+      104, 119, 118, 102, 87, 88, 104, 105, 120, 105, 121, 120,
+      105, 106, 121, 106, 122, 121, 106, 107, 122, 108, 109, 124,
+      109, 125, 124, 111, 127, 126, 111, 126, 125, 109, 94, 95,
+      114, 115, 130, 115, 131, 130, 117, 133, 132, 117, 132, 131,
+      115, 100, 101, 117, 118, 133, 118, 134, 133, 118, 119, 134,
+      119, 135, 134, 119, 120, 135, 121, 122, 137, 122, 138, 137,
+      124, 140, 139, 124, 139, 138, 122, 107, 108, 124, 125, 140,
+      125, 141, 140, 125, 126, 141, 126, 142, 141, 126, 127, 142,
+      130, 146, 145, 130, 145, 144, 128, 113, 114, 130, 131, 146,
+      131, 147, 146, 131, 132, 147, 132, 148, 147, 132, 133, 148,
+      134, 135, 150, 135, 151, 150, 137, 153, 152, 137, 152, 151,
+      135, 120, 121, 137, 138, 153, 138, 154, 153, 138, 139, 154,
+      139, 155, 154, 139, 140, 155, 141, 142, 157, 142, 158, 157,
+      145, 146, 161, 147, 148, 163, 148, 164, 163, 150, 166, 165,
+      150, 165, 164, 148, 133, 134, 150, 151, 166, 151, 167, 166,
+      151, 152, 167, 152, 168, 167, 152, 153, 168, 154, 155, 170,
+      155, 171, 170, 157, 173, 172, 157, 172, 171, 155, 140, 141,
+      157, 158, 173, 158, 174, 173, 158, 159, 174, 159, 175, 174,
+      163, 179, 178, 163, 178, 177, 161, 146, 147, 163, 164, 179,
+      164, 180, 179, 164, 165, 180, 165, 181, 180, 165, 166, 181,
+      167, 168, 183, 168, 184, 183, 170, 186, 185, 170, 185, 184,
+      168, 153, 154, 170, 171, 186, 171, 187, 186, 171, 172, 187,
+      172, 188, 187, 172, 173, 188, 174, 175, 190, 175, 191, 190,
+      177, 178, 193, 178, 194, 193, 178, 179, 194, 180, 181, 196,
+      181, 197, 196, 183, 199, 198, 183, 198, 197, 181, 166, 167,
+      183, 184, 199, 184, 200, 199, 184, 185, 200, 185, 201, 200,
+      185, 186, 201, 187, 188, 203, 188, 204, 203, 190, 206, 205,
+      190, 205, 204, 188, 173, 174, 190, 191, 206, 191, 207, 206,
+      193, 194, 209, 194, 210, 209, 196, 212, 211, 196, 211, 210,
+      194, 179, 180, 196, 197, 212, 197, 213, 212, 197, 198, 213,
+      198, 214, 213, 198, 199, 214, 200, 201, 216, 201, 217, 216,
+      203, 219, 218, 203, 218, 217, 201, 186, 187, 203, 204, 219,
+      204, 220, 219, 204, 205, 220, 205, 221, 220, 205, 206, 221,
+      209, 210, 225, 210, 226, 225, 210, 211, 226, 211, 227, 226,
+      211, 212, 227, 213, 214, 229, 214, 230, 229, 216, 232, 231,
+      216, 231, 230, 214, 199, 200, 216, 217, 232, 217, 233, 232,
+      217, 218, 233, 218, 234, 233, 218, 219, 234, 220, 221, 236,
+      221, 237, 236, 223, 239, 238, 223, 238, 237, 221, 206, 207,
+      226, 227, 242, 227, 243, 242, 229, 245, 244, 229, 244, 243,
+      227, 212, 213, 229, 230, 245, 230, 246, 245, 230, 231, 246,
+      231, 247, 246, 231, 232, 247, 233, 234, 249, 234, 250, 249,
+      236, 252, 251, 236, 251, 250, 234, 219, 220, 236, 237, 252,
+      237, 253, 252, 237, 238, 253, 238, 254, 253, 238, 239, 254
+   };
+
+   // tilings/semi2_16x16
+   constexpr float m_tilings_semi2_16x16_vertex[] =
+   {
+      0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+      3.41421366f, 0.0f, 0.0f, 4.41421366f, 0.0f, 0.0f,
+      6.82842731f, 0.0f, 0.0f, 7.82842731f, 0.0f, 0.0f,
+      10.2426414f, 0.0f, 0.0f, 11.2426414f, 0.0f, 0.0f,
+      13.6568546f, 0.0f, 0.0f, 14.6568546f, 0.0f, 0.0f,
+      17.0710678f, 0.0f, 0.0f, 18.0710678f, 0.0f, 0.0f,
+      20.4852829f, 0.0f, 0.0f, 21.4852829f, 0.0f, 0.0f,
+      23.8994961f, 0.0f, 0.0f, 24.8994961f, 0.0f, 0.0f,
+      0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+      3.41421366f, 1.0f, 0.0f, 4.41421366f, 1.0f, 0.0f,
+      6.82842731f, 1.0f, 0.0f, 7.82842731f, 1.0f, 0.0f,
+      10.2426414f, 1.0f, 0.0f, 11.2426414f, 1.0f, 0.0f,
+      13.6568546f, 1.0f, 0.0f, 14.6568546f, 1.0f, 0.0f,
+      17.0710678f, 1.0f, 0.0f, 18.0710678f, 1.0f, 0.0f,
+      20.4852829f, 1.0f, 0.0f, 21.4852829f, 1.0f, 0.0f,
+      23.8994961f, 1.0f, 0.0f, 24.8994961f, 1.0f, 0.0f,
+      1.70710683f, 1.70710683f, 0.0f, 2.70710683f, 1.70710683f, 0.0f,
+      5.12132072f, 1.70710683f, 0.0f, 6.12132072f, 1.70710683f, 0.0f,
+      8.53553391f, 1.70710683f, 0.0f, 9.53553391f, 1.70710683f, 0.0f,
+      11.949748f, 1.70710683f, 0.0f, 12.949748f, 1.70710683f, 0.0f,
+      15.3639612f, 1.70710683f, 0.0f, 16.3639622f, 1.70710683f, 0.0f,
+      18.7781754f, 1.70710683f, 0.0f, 19.7781754f, 1.70710683f, 0.0f,
+      22.1923904f, 1.70710683f, 0.0f, 23.1923904f, 1.70710683f, 0.0f,
+      25.6066036f, 1.70710683f, 0.0f, 26.6066036f, 1.70710683f, 0.0f,
+      1.70710683f, 2.70710683f, 0.0f, 2.70710683f, 2.70710683f, 0.0f,
+      5.12132072f, 2.70710683f, 0.0f, 6.12132072f, 2.70710683f, 0.0f,
+      8.53553391f, 2.70710683f, 0.0f, 9.53553391f, 2.70710683f, 0.0f,
+      11.949748f, 2.70710683f, 0.0f, 12.949748f, 2.70710683f, 0.0f,
+      15.3639612f, 2.70710683f, 0.0f, 16.3639622f, 2.70710683f, 0.0f,
+      18.7781754f, 2.70710683f, 0.0f, 19.7781754f, 2.70710683f, 0.0f,
+      22.1923904f, 2.70710683f, 0.0f, 23.1923904f, 2.70710683f, 0.0f,
+      25.6066036f, 2.70710683f, 0.0f, 26.6066036f, 2.70710683f, 0.0f,
+      3.41421366f, 3.41421366f, 0.0f, 4.41421366f, 3.41421366f, 0.0f,
+      6.82842731f, 3.41421366f, 0.0f, 7.82842731f, 3.41421366f, 0.0f,
+      10.2426414f, 3.41421366f, 0.0f, 11.2426414f, 3.41421366f, 0.0f,
+      13.6568546f, 3.41421366f, 0.0f, 14.6568546f, 3.41421366f, 0.0f,
+      17.0710678f, 3.41421366f, 0.0f, 18.0710678f, 3.41421366f, 0.0f,
+      20.485281f, 3.41421366f, 0.0f, 21.485281f, 3.41421366f, 0.0f,
+      23.8994961f, 3.41421366f, 0.0f, 24.8994961f, 3.41421366f, 0.0f,
+      27.3137093f, 3.41421366f, 0.0f, 28.3137093f, 3.41421366f, 0.0f,
+      3.41421366f, 4.41421366f, 0.0f, 4.41421366f, 4.41421366f, 0.0f,
+      6.82842731f, 4.41421366f, 0.0f, 7.82842731f, 4.41421366f, 0.0f,
+      10.2426414f, 4.41421366f, 0.0f, 11.2426414f, 4.41421366f, 0.0f,
+      13.6568546f, 4.41421366f, 0.0f, 14.6568546f, 4.41421366f, 0.0f,
+      17.0710678f, 4.41421366f, 0.0f, 18.0710678f, 4.41421366f, 0.0f,
+      20.485281f, 4.41421366f, 0.0f, 21.485281f, 4.41421366f, 0.0f,
+      23.8994961f, 4.41421366f, 0.0f, 24.8994961f, 4.41421366f, 0.0f,
+      27.3137093f, 4.41421366f, 0.0f, 28.3137093f, 4.41421366f, 0.0f,
+      5.12132072f, 5.12132072f, 0.0f, 6.12132072f, 5.12132072f, 0.0f,
+      8.53553391f, 5.12132072f, 0.0f, 9.53553391f, 5.12132072f, 0.0f,
+      11.949748f, 5.12132072f, 0.0f, 12.949748f, 5.12132072f, 0.0f,
+      15.3639622f, 5.12132072f, 0.0f, 16.3639622f, 5.12132072f, 0.0f,
+      18.7781754f, 5.12132072f, 0.0f, 19.7781754f, 5.12132072f, 0.0f,
+      22.1923885f, 5.12132072f, 0.0f, 23.1923885f, 5.12132072f, 0.0f,
+      25.6066036f, 5.12132072f, 0.0f, 26.6066036f, 5.12132072f, 0.0f,
+      29.0208168f, 5.12132072f, 0.0f, 30.0208168f, 5.12132072f, 0.0f,
+      5.12132072f, 6.12132072f, 0.0f, 6.12132072f, 6.12132072f, 0.0f,
+      8.53553391f, 6.12132072f, 0.0f, 9.53553391f, 6.12132072f, 0.0f,
+      11.949748f, 6.12132072f, 0.0f, 12.949748f, 6.12132072f, 0.0f,
+      15.3639622f, 6.12132072f, 0.0f, 16.3639622f, 6.12132072f, 0.0f,
+      18.7781754f, 6.12132072f, 0.0f, 19.7781754f, 6.12132072f, 0.0f,
+      22.1923885f, 6.12132072f, 0.0f, 23.1923885f, 6.12132072f, 0.0f,
+      25.6066036f, 6.12132072f, 0.0f, 26.6066036f, 6.12132072f, 0.0f,
+      29.0208168f, 6.12132072f, 0.0f, 30.0208168f, 6.12132072f, 0.0f,
+      6.82842731f, 6.82842731f, 0.0f, 7.82842731f, 6.82842731f, 0.0f,
+      10.2426414f, 6.82842731f, 0.0f, 11.2426414f, 6.82842731f, 0.0f,
+      13.6568546f, 6.82842731f, 0.0f, 14.6568546f, 6.82842731f, 0.0f,
+      17.0710678f, 6.82842731f, 0.0f, 18.0710678f, 6.82842731f, 0.0f,
+      20.4852829f, 6.82842731f, 0.0f, 21.4852829f, 6.82842731f, 0.0f,
+      23.8994942f, 6.82842731f, 0.0f, 24.8994942f, 6.82842731f, 0.0f,
+      27.3137093f, 6.82842731f, 0.0f, 28.3137093f, 6.82842731f, 0.0f,
+      30.7279243f, 6.82842731f, 0.0f, 31.7279243f, 6.82842731f, 0.0f,
+      6.82842731f, 7.82842731f, 0.0f, 7.82842731f, 7.82842731f, 0.0f,
+      10.2426414f, 7.82842731f, 0.0f, 11.2426414f, 7.82842731f, 0.0f,
+      13.6568546f, 7.82842731f, 0.0f, 14.6568546f, 7.82842731f, 0.0f,
+      17.0710678f, 7.82842731f, 0.0f, 18.0710678f, 7.82842731f, 0.0f,
+      20.4852829f, 7.82842731f, 0.0f, 21.4852829f, 7.82842731f, 0.0f,
+      23.8994942f, 7.82842731f, 0.0f, 24.8994942f, 7.82842731f, 0.0f,
+      27.3137093f, 7.82842731f, 0.0f, 28.3137093f, 7.82842731f, 0.0f,
+      30.7279243f, 7.82842731f, 0.0f, 31.7279243f, 7.82842731f, 0.0f,
+      8.53553391f, 8.53553391f, 0.0f, 9.53553391f, 8.53553391f, 0.0f,
+      11.9497471f, 8.53553391f, 0.0f, 12.9497471f, 8.53553391f, 0.0f,
+      15.3639612f, 8.53553391f, 0.0f, 16.3639603f, 8.53553391f, 0.0f,
+      18.7781754f, 8.53553391f, 0.0f, 19.7781754f, 8.53553391f, 0.0f,
+      22.1923885f, 8.53553391f, 0.0f, 23.1923885f, 8.53553391f, 0.0f,
+      25.6066017f, 8.53553391f, 0.0f, 26.6066017f, 8.53553391f, 0.0f,
+      29.0208168f, 8.53553391f, 0.0f, 30.0208168f, 8.53553391f, 0.0f,
+      32.4350281f, 8.53553391f, 0.0f, 33.4350281f, 8.53553391f, 0.0f,
+      8.53553391f, 9.53553391f, 0.0f, 9.53553391f, 9.53553391f, 0.0f,
+      11.9497471f, 9.53553391f, 0.0f, 12.9497471f, 9.53553391f, 0.0f,
+      15.3639612f, 9.53553391f, 0.0f, 16.3639603f, 9.53553391f, 0.0f,
+      18.7781754f, 9.53553391f, 0.0f, 19.7781754f, 9.53553391f, 0.0f,
+      22.1923885f, 9.53553391f, 0.0f, 23.1923885f, 9.53553391f, 0.0f,
+      25.6066017f, 9.53553391f, 0.0f, 26.6066017f, 9.53553391f, 0.0f,
+      29.0208168f, 9.53553391f, 0.0f, 30.0208168f, 9.53553391f, 0.0f,
+      32.4350281f, 9.53553391f, 0.0f, 33.4350281f, 9.53553391f, 0.0f,
+      10.2426414f, 10.2426414f, 0.0f, 11.2426414f, 10.2426414f, 0.0f,
+      13.6568546f, 10.2426414f, 0.0f, 14.6568546f, 10.2426414f, 0.0f,
+      17.0710678f, 10.2426414f, 0.0f, 18.0710678f, 10.2426414f, 0.0f,
+      20.4852829f, 10.2426414f, 0.0f, 21.4852829f, 10.2426414f, 0.0f,
+      23.8994961f, 10.2426414f, 0.0f, 24.8994961f, 10.2426414f, 0.0f,
+      27.3137093f, 10.2426414f, 0.0f, 28.3137093f, 10.2426414f, 0.0f,
+      30.7279243f, 10.2426414f, 0.0f, 31.7279243f, 10.2426414f, 0.0f,
+      34.1421356f, 10.2426414f, 0.0f, 35.1421356f, 10.2426414f, 0.0f,
+      10.2426414f, 11.2426414f, 0.0f, 11.2426414f, 11.2426414f, 0.0f,
+      13.6568546f, 11.2426414f, 0.0f, 14.6568546f, 11.2426414f, 0.0f,
+      17.0710678f, 11.2426414f, 0.0f, 18.0710678f, 11.2426414f, 0.0f,
+      20.4852829f, 11.2426414f, 0.0f, 21.4852829f, 11.2426414f, 0.0f,
+      23.8994961f, 11.2426414f, 0.0f, 24.8994961f, 11.2426414f, 0.0f,
+      27.3137093f, 11.2426414f, 0.0f, 28.3137093f, 11.2426414f, 0.0f,
+      30.7279243f, 11.2426414f, 0.0f, 31.7279243f, 11.2426414f, 0.0f,
+      34.1421356f, 11.2426414f, 0.0f, 35.1421356f, 11.2426414f, 0.0f,
+      11.949748f, 11.949748f, 0.0f, 12.949748f, 11.949748f, 0.0f,
+      15.3639622f, 11.949748f, 0.0f, 16.3639622f, 11.949748f, 0.0f,
+      18.7781754f, 11.949748f, 0.0f, 19.7781754f, 11.949748f, 0.0f,
+      22.1923904f, 11.949748f, 0.0f, 23.1923904f, 11.949748f, 0.0f,
+      25.6066017f, 11.949748f, 0.0f, 26.6066017f, 11.949748f, 0.0f,
+      29.0208168f, 11.949748f, 0.0f, 30.0208168f, 11.949748f, 0.0f,
+      32.4350319f, 11.949748f, 0.0f, 33.4350319f, 11.949748f, 0.0f,
+      35.8492432f, 11.949748f, 0.0f, 36.8492432f, 11.949748f, 0.0f,
+      11.949748f, 12.949748f, 0.0f, 12.949748f, 12.949748f, 0.0f,
+      15.3639622f, 12.949748f, 0.0f, 16.3639622f, 12.949748f, 0.0f,
+      18.7781754f, 12.949748f, 0.0f, 19.7781754f, 12.949748f, 0.0f,
+      22.1923904f, 12.949748f, 0.0f, 23.1923904f, 12.949748f, 0.0f,
+      25.6066017f, 12.949748f, 0.0f, 26.6066017f, 12.949748f, 0.0f,
+      29.0208168f, 12.949748f, 0.0f, 30.0208168f, 12.949748f, 0.0f,
+      32.4350319f, 12.949748f, 0.0f, 33.4350319f, 12.949748f, 0.0f,
+      35.8492432f, 12.949748f, 0.0f, 36.8492432f, 12.949748f, 0.0f
+   };
+   constexpr int m_tilings_semi2_16x16_faceStart[] =
+   {
+      0, 8, 16, 24, 32, 40, 48, 56, 64, 72, 80, 88,
+      96, 104, 112, 120, 128, 136, 144, 152, 160, 168, 176, 184,
+      192, 200, 208, 216, 224, 232, 240, 248, 256, 264, 272, 280,
+      288, 296, 304, 312, 320, 328, 336, 340, 344, 348, 352, 356,
+      360, 364, 368, 372, 376, 380, 384, 388, 392, 396, 400, 404,
+      408, 412, 416, 420, 424, 428, 432, 436, 440, 444, 448, 452,
+      456, 460, 464, 468, 472, 476, 480, 484, 488, 492, 496, 500,
+      504, 508, 512, 516, 520, 524, 528, 532, 536, 540, 544, 548,
+      552, 556, 560, 564, 568, 572, 576, 580, 584, 588, 592
+   };
+   constexpr int m_tilings_semi2_16x16_faceIndex[] =
+   {
+      33, 18, 19, 34, 50, 65, 64, 49, 35, 20, 21, 36,
+      52, 67, 66, 51, 37, 22, 23, 38, 54, 69, 68, 53,
+      39, 24, 25, 40, 56, 71, 70, 55, 41, 26, 27, 42,
+      58, 73, 72, 57, 43, 28, 29, 44, 60, 75, 74, 59,
+      45, 30, 31, 46, 62, 77, 76, 61, 65, 50, 51, 66,
+      82, 97, 96, 81, 67, 52, 53, 68, 84, 99, 98, 83,
+      69, 54, 55, 70, 86, 101, 100, 85, 71, 56, 57, 72,
+      88, 103, 102, 87, 73, 58, 59, 74, 90, 105, 104, 89,
+      75, 60, 61, 76, 92, 107, 106, 91, 77, 62, 63, 78,
+      94, 109, 108, 93, 97, 82, 83, 98, 114, 129, 128, 113,
+      99, 84, 85, 100, 116, 131, 130, 115, 101, 86, 87, 102,
+      118, 133, 132, 117, 103, 88, 89, 104, 120, 135, 134, 119,
+      105, 90, 91, 106, 122, 137, 136, 121, 107, 92, 93, 108,
+      124, 139, 138, 123, 109, 94, 95, 110, 126, 141, 140, 125,
+      129, 114, 115, 130, 146, 161, 160, 145, 131, 116, 117, 132,
+      148, 163, 162, 147, 133, 118, 119, 134, 150, 165, 164, 149,
+      135, 120, 121, 136, 152, 167, 166, 151, 137, 122, 123, 138,
+      154, 169, 168, 153, 139, 124, 125, 140, 156, 171, 170, 155,
+      141, 126, 127, 142, 158, 173, 172, 157, 161, 146, 147, 162,
+      178, 193, 192, 177, 163, 148, 149, 164, 180, 195, 194, 179,
+      165, 150, 151, 166, 182, 197, 196, 181, 167, 152, 153, 168,
+      184, 199, 198, 183, 169, 154, 155, 170, 186, 201, 200, 185,
+      171, 156, 157, 172, 188, 203, 202, 187, 173, 158, 159, 174,
+      190, 205, 204, 189, 193, 178, 179, 194, 210, 225, 224, 209,
+      195, 180, 181, 196, 212, 227, 226, 211, 197, 182, 183, 198,
+      214, 229, 228, 213, 199, 184, 185, 200, 216, 231, 230, 215,
+      201, 186, 187, 202, 218, 233, 232, 217, 203, 188, 189, 204,
+      220, 235, 234, 219, 205, 190, 191, 206, 222, 237, 236, 221,
+      0, 1, 17, 16, 2, 3, 19, 18, 4, 5, 21, 20,
+      6, 7, 23, 22, 8, 9, 25, 24, 10, 11, 27, 26,
+      12, 13, 29, 28, 14, 15, 31, 30, 32, 33, 49, 48,
+      34, 35, 51, 50, 36, 37, 53, 52, 38, 39, 55, 54,
+      40, 41, 57, 56, 42, 43, 59, 58, 44, 45, 61, 60,
+      46, 47, 63, 62, 64, 65, 81, 80, 66, 67, 83, 82,
+      68, 69, 85, 84, 70, 71, 87, 86, 72, 73, 89, 88,
+      74, 75, 91, 90, 76, 77, 93, 92, 78, 79, 95, 94,
+      96, 97, 113, 112, 98, 99, 115, 114, 100, 101, 117, 116,
+      102, 103, 119, 118, 104, 105, 121, 120, 106, 107, 123, 122,
+      108, 109, 125, 124, 110, 111, 127, 126, 128, 129, 145, 144,
+      130, 131, 147, 146, 132, 133, 149, 148, 134, 135, 151, 150,
+      136, 137, 153, 152, 138, 139, 155, 154, 140, 141, 157, 156,
+      142, 143, 159, 158, 160, 161, 177, 176, 162, 163, 179, 178,
+      164, 165, 181, 180, 166, 167, 183, 182, 168, 169, 185, 184,
+      170, 171, 187, 186, 172, 173, 189, 188, 174, 175, 191, 190,
+      192, 193, 209, 208, 194, 195, 211, 210, 196, 197, 213, 212,
+      198, 199, 215, 214, 200, 201, 217, 216, 202, 203, 219, 218,
+      204, 205, 221, 220, 206, 207, 223, 222, 224, 225, 241, 240,
+      226, 227, 243, 242, 228, 229, 245, 244, 230, 231, 247, 246,
+      232, 233, 249, 248, 234, 235, 251, 250, 236, 237, 253, 252,
+      238, 239, 255, 254
+   };
+
+   // tilings/semi3_16x16
+   constexpr float m_tilings_semi3_16x16_vertex[] =
+   {
+      0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+      2.0f, 0.0f, 0.0f, 3.0f, 0.0f, 0.0f,
+      4.0f, 0.0f, 0.0f, 5.0f, 0.0f, 0.0f,
+      6.0f, 0.0f, 0.0f, 7.0f, 0.0f, 0.0f,
+      8.0f, 0.0f, 0.0f, 9.0f, 0.0f, 0.0f,
+      10.0f, 0.0f, 0.0f, 11.0f, 0.0f, 0.0f,
+      12.0f, 0.0f, 0.0f, 13.0f, 0.0f, 0.0f,
+      14.0f, 0.0f, 0.0f, 15.0f, 0.0f, 0.0f,
+      0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+      2.0f, 1.0f, 0.0f, 3.0f, 1.0f, 0.0f,
+      4.0f, 1.0f, 0.0f, 5.0f, 1.0f, 0.0f,
+      6.0f, 1.0f, 0.0f, 7.0f, 1.0f, 0.0f,
+      8.0f, 1.0f, 0.0f, 9.0f, 1.0f, 0.0f,
+      10.0f, 1.0f, 0.0f, 11.0f, 1.0f, 0.0f,
+      12.0f, 1.0f, 0.0f, 13.0f, 1.0f, 0.0f,
+      14.0f, 1.0f, 0.0f, 15.0f, 1.0f, 0.0f,
+      0.5f, 1.86602545f, 0.0f, 1.5f, 1.86602545f, 0.0f,
+      2.5f, 1.86602545f, 0.0f, 3.5f, 1.86602545f, 0.0f,
+      4.5f, 1.86602545f, 0.0f, 5.5f, 1.86602545f, 0.0f,
+      6.5f, 1.86602545f, 0.0f, 7.5f, 1.86602545f, 0.0f,
+      8.5f, 1.86602545f, 0.0f, 9.5f, 1.86602545f, 0.0f,
+      10.5f, 1.86602545f, 0.0f, 11.5f, 1.86602545f, 0.0f,
+      12.5f, 1.86602545f, 0.0f, 13.5f, 1.86602545f, 0.0f,
+      14.5f, 1.86602545f, 0.0f, 15.5f, 1.86602545f, 0.0f,
+      0.5f, 2.86602545f, 0.0f, 1.5f, 2.86602545f, 0.0f,
+      2.5f, 2.86602545f, 0.0f, 3.5f, 2.86602545f, 0.0f,
+      4.5f, 2.86602545f, 0.0f, 5.5f, 2.86602545f, 0.0f,
+      6.5f, 2.86602545f, 0.0f, 7.5f, 2.86602545f, 0.0f,
+      8.5f, 2.86602545f, 0.0f, 9.5f, 2.86602545f, 0.0f,
+      10.5f, 2.86602545f, 0.0f, 11.5f, 2.86602545f, 0.0f,
+      12.5f, 2.86602545f, 0.0f, 13.5f, 2.86602545f, 0.0f,
+      14.5f, 2.86602545f, 0.0f, 15.5f, 2.86602545f, 0.0f,
+      1.0f, 3.7320509f, 0.0f, 2.0f, 3.7320509f, 0.0f,
+      3.0f, 3.7320509f, 0.0f, 4.0f, 3.7320509f, 0.0f,
+      5.0f, 3.7320509f, 0.0f, 6.0f, 3.7320509f, 0.0f,
+      7.0f, 3.7320509f, 0.0f, 8.0f, 3.7320509f, 0.0f,
+      9.0f, 3.7320509f, 0.0f, 10.0f, 3.7320509f, 0.0f,
+      11.0f, 3.7320509f, 0.0f, 12.0f, 3.7320509f, 0.0f,
+      13.0f, 3.7320509f, 0.0f, 14.0f, 3.7320509f, 0.0f,
+      15.0f, 3.7320509f, 0.0f, 16.0f, 3.7320509f, 0.0f,
+      1.0f, 4.7320509f, 0.0f, 2.0f, 4.7320509f, 0.0f,
+      3.0f, 4.7320509f, 0.0f, 4.0f, 4.7320509f, 0.0f,
+      5.0f, 4.7320509f, 0.0f, 6.0f, 4.7320509f, 0.0f,
+      7.0f, 4.7320509f, 0.0f, 8.0f, 4.7320509f, 0.0f,
+      9.0f, 4.7320509f, 0.0f, 10.0f, 4.7320509f, 0.0f,
+      11.0f, 4.7320509f, 0.0f, 12.0f, 4.7320509f, 0.0f,
+      13.0f, 4.7320509f, 0.0f, 14.0f, 4.7320509f, 0.0f,
+      15.0f, 4.7320509f, 0.0f, 16.0f, 4.7320509f, 0.0f,
+      1.5f, 5.59807634f, 0.0f, 2.5f, 5.59807634f, 0.0f,
+      3.5f, 5.59807634f, 0.0f, 4.5f, 5.59807634f, 0.0f,
+      5.5f, 5.59807634f, 0.0f, 6.5f, 5.59807634f, 0.0f,
+      7.5f, 5.59807634f, 0.0f, 8.5f, 5.59807634f, 0.0f,
+      9.5f, 5.59807634f, 0.0f, 10.5f, 5.59807634f, 0.0f,
+      11.5f, 5.59807634f, 0.0f, 12.5f, 5.59807634f, 0.0f,
+      13.5f, 5.59807634f, 0.0f, 14.5f, 5.59807634f, 0.0f,
+      15.5f, 5.59807634f, 0.0f, 16.5f, 5.59807634f, 0.0f,
+      1.5f, 6.59807634f, 0.0f, 2.5f, 6.59807634f, 0.0f,
+      3.5f, 6.59807634f, 0.0f, 4.5f, 6.59807634f, 0.0f,
+      5.5f, 6.59807634f, 0.0f, 6.5f, 6.59807634f, 0.0f,
+      7.5f, 6.59807634f, 0.0f, 8.5f, 6.59807634f, 0.0f,
+      9.5f, 6.59807634f, 0.0f, 10.5f, 6.59807634f, 0.0f,
+      11.5f, 6.59807634f, 0.0f, 12.5f, 6.59807634f, 0.0f,
+      13.5f, 6.59807634f, 0.0f, 14.5f, 6.59807634f, 0.0f,
+      15.5f, 6.59807634f, 0.0f, 16.5f, 6.59807634f, 0.0f,
+      2.0f, 7.46410179f, 0.0f, 3.0f, 7.46410179f, 0.0f,
+      4.0f, 7.46410179f, 0.0f, 5.0f, 7.46410179f, 0.0f,
+      6.0f, 7.46410179f, 0.0f, 7.0f, 7.46410179f, 0.0f,
+      8.0f, 7.46410179f, 0.0f, 9.0f, 7.46410179f, 0.0f,
+      10.0f, 7.46410179f, 0.0f, 11.0f, 7.46410179f, 0.0f,
+      12.0f, 7.46410179f, 0.0f, 13.0f, 7.46410179f, 0.0f,
+      14.0f, 7.46410179f, 0.0f, 15.0f, 7.46410179f, 0.0f,
+      16.0f, 7.46410179f, 0.0f, 17.0f, 7.46410179f, 0.0f,
+      2.0f, 8.46410179f, 0.0f, 3.0f, 8.46410179f, 0.0f,
+      4.0f, 8.46410179f, 0.0f, 5.0f, 8.46410179f, 0.0f,
+      6.0f, 8.46410179f, 0.0f, 7.0f, 8.46410179f, 0.0f,
+      8.0f, 8.46410179f, 0.0f, 9.0f, 8.46410179f, 0.0f,
+      10.0f, 8.46410179f, 0.0f, 11.0f, 8.46410179f, 0.0f,
+      12.0f, 8.46410179f, 0.0f, 13.0f, 8.46410179f, 0.0f,
+      14.0f, 8.46410179f, 0.0f, 15.0f, 8.46410179f, 0.0f,
+      16.0f, 8.46410179f, 0.0f, 17.0f, 8.46410179f, 0.0f,
+      2.5f, 9.33012772f, 0.0f, 3.5f, 9.33012772f, 0.0f,
+      4.5f, 9.33012772f, 0.0f, 5.5f, 9.33012772f, 0.0f,
+      6.5f, 9.33012772f, 0.0f, 7.5f, 9.33012772f, 0.0f,
+      8.5f, 9.33012772f, 0.0f, 9.5f, 9.33012772f, 0.0f,
+      10.5f, 9.33012772f, 0.0f, 11.5f, 9.33012772f, 0.0f,
+      12.5f, 9.33012772f, 0.0f, 13.5f, 9.33012772f, 0.0f,
+      14.5f, 9.33012772f, 0.0f, 15.5f, 9.33012772f, 0.0f,
+      16.5f, 9.33012772f, 0.0f, 17.5f, 9.33012772f, 0.0f,
+      2.5f, 10.3301277f, 0.0f, 3.5f, 10.3301277f, 0.0f,
+      4.5f, 10.3301277f, 0.0f, 5.5f, 10.3301277f, 0.0f,
+      6.5f, 10.3301277f, 0.0f, 7.5f, 10.3301277f, 0.0f,
+      8.5f, 10.3301277f, 0.0f, 9.5f, 10.3301277f, 0.0f,
+      10.5f, 10.3301277f, 0.0f, 11.5f, 10.3301277f, 0.0f,
+      12.5f, 10.3301277f, 0.0f, 13.5f, 10.3301277f, 0.0f,
+      14.5f, 10.3301277f, 0.0f, 15.5f, 10.3301277f, 0.0f,
+      16.5f, 10.3301277f, 0.0f, 17.5f, 10.3301277f, 0.0f,
+      3.0f, 11.1961527f, 0.0f, 4.0f, 11.1961527f, 0.0f,
+      5.0f, 11.1961527f, 0.0f, 6.0f, 11.1961527f, 0.0f,
+      7.0f, 11.1961527f, 0.0f, 8.0f, 11.1961527f, 0.0f,
+      9.0f, 11.1961527f, 0.0f, 10.0f, 11.1961527f, 0.0f,
+      11.0f, 11.1961527f, 0.0f, 12.0f, 11.1961527f, 0.0f,
+      13.0f, 11.1961527f, 0.0f, 14.0f, 11.1961527f, 0.0f,
+      15.0f, 11.1961527f, 0.0f, 16.0f, 11.1961527f, 0.0f,
+      17.0f, 11.1961527f, 0.0f, 18.0f, 11.1961527f, 0.0f,
+      3.0f, 12.1961527f, 0.0f, 4.0f, 12.1961527f, 0.0f,
+      5.0f, 12.1961527f, 0.0f, 6.0f, 12.1961527f, 0.0f,
+      7.0f, 12.1961527f, 0.0f, 8.0f, 12.1961527f, 0.0f,
+      9.0f, 12.1961527f, 0.0f, 10.0f, 12.1961527f, 0.0f,
+      11.0f, 12.1961527f, 0.0f, 12.0f, 12.1961527f, 0.0f,
+      13.0f, 12.1961527f, 0.0f, 14.0f, 12.1961527f, 0.0f,
+      15.0f, 12.1961527f, 0.0f, 16.0f, 12.1961527f, 0.0f,
+      17.0f, 12.1961527f, 0.0f, 18.0f, 12.1961527f, 0.0f,
+      3.5f, 13.0621777f, 0.0f, 4.5f, 13.0621777f, 0.0f,
+      5.5f, 13.0621777f, 0.0f, 6.5f, 13.0621777f, 0.0f,
+      7.5f, 13.0621777f, 0.0f, 8.5f, 13.0621777f, 0.0f,
+      9.5f, 13.0621777f, 0.0f, 10.5f, 13.0621777f, 0.0f,
+      11.5f, 13.0621777f, 0.0f, 12.5f, 13.0621777f, 0.0f,
+      13.5f, 13.0621777f, 0.0f, 14.5f, 13.0621777f, 0.0f,
+      15.5f, 13.0621777f, 0.0f, 16.5f, 13.0621777f, 0.0f,
+      17.5f, 13.0621777f, 0.0f, 18.5f, 13.0621777f, 0.0f,
+      3.5f, 14.0621777f, 0.0f, 4.5f, 14.0621777f, 0.0f,
+      5.5f, 14.0621777f, 0.0f, 6.5f, 14.0621777f, 0.0f,
+      7.5f, 14.0621777f, 0.0f, 8.5f, 14.0621777f, 0.0f,
+      9.5f, 14.0621777f, 0.0f, 10.5f, 14.0621777f, 0.0f,
+      11.5f, 14.0621777f, 0.0f, 12.5f, 14.0621777f, 0.0f,
+      13.5f, 14.0621777f, 0.0f, 14.5f, 14.0621777f, 0.0f,
+      15.5f, 14.0621777f, 0.0f, 16.5f, 14.0621777f, 0.0f,
+      17.5f, 14.0621777f, 0.0f, 18.5f, 14.0621777f, 0.0f
+   };
+   constexpr int m_tilings_semi3_16x16_faceStart[] =
+   {
+      0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44,
+      48, 52, 56, 60, 63, 66, 69, 72, 75, 78, 81, 84,
+      87, 90, 93, 96, 99, 102, 105, 108, 111, 114, 117, 120,
+      123, 126, 129, 132, 135, 138, 141, 144, 147, 150, 154, 158,
+      162, 166, 170, 174, 178, 182, 186, 190, 194, 198, 202, 206,
+      210, 213, 216, 219, 222, 225, 228, 231, 234, 237, 240, 243,
+      246, 249, 252, 255, 258, 261, 264, 267, 270, 273, 276, 279,
+      282, 285, 288, 291, 294, 297, 300, 304, 308, 312, 316, 320,
+      324, 328, 332, 336, 340, 344, 348, 352, 356, 360, 363, 366,
+      369, 372, 375, 378, 381, 384, 387, 390, 393, 396, 399, 402,
+      405, 408, 411, 414, 417, 420, 423, 426, 429, 432, 435, 438,
+      441, 444, 447, 450, 454, 458, 462, 466, 470, 474, 478, 482,
+      486, 490, 494, 498, 502, 506, 510, 513, 516, 519, 522, 525,
+      528, 531, 534, 537, 540, 543, 546, 549, 552, 555, 558, 561,
+      564, 567, 570, 573, 576, 579, 582, 585, 588, 591, 594, 597,
+      600, 604, 608, 612, 616, 620, 624, 628, 632, 636, 640, 644,
+      648, 652, 656, 660, 663, 666, 669, 672, 675, 678, 681, 684,
+      687, 690, 693, 696, 699, 702, 705, 708, 711, 714, 717, 720,
+      723, 726, 729, 732, 735, 738, 741, 744, 747, 750, 754, 758,
+      762, 766, 770, 774, 778, 782, 786, 790, 794, 798, 802, 806,
+      810, 813, 816, 819, 822, 825, 828, 831, 834, 837, 840, 843,
+      846, 849, 852, 855, 858, 861, 864, 867, 870, 873, 876, 879,
+      882, 885, 888, 891, 894, 897, 900, 904, 908, 912, 916, 920,
+      924, 928, 932, 936, 940, 944, 948, 952, 956, 960, 963, 966,
+      969, 972, 975, 978, 981, 984, 987, 990, 993, 996, 999, 1002,
+      1005, 1008, 1011, 1014, 1017, 1020, 1023, 1026, 1029, 1032, 1035, 1038,
+      1041, 1044, 1047, 1050, 1054, 1058, 1062, 1066, 1070, 1074, 1078, 1082,
+      1086, 1090, 1094, 1098, 1102, 1106, 1110
+   };
+   constexpr int m_tilings_semi3_16x16_faceIndex[] =
+   {
+      0, 1, 17, 16, 1, 2, 18, 17, 2, 3, 19, 18,
+      3, 4, 20, 19, 4, 5, 21, 20, 5, 6, 22, 21,
+      6, 7, 23, 22, 7, 8, 24, 23, 8, 9, 25, 24,
+      9, 10, 26, 25, 10, 11, 27, 26, 11, 12, 28, 27,
+      12, 13, 29, 28, 13, 14, 30, 29, 14, 15, 31, 30,
+      16, 17, 32, 17, 33, 32, 17, 18, 33, 18, 34, 33,
+      18, 19, 34, 19, 35, 34, 19, 20, 35, 20, 36, 35,
+      20, 21, 36, 21, 37, 36, 21, 22, 37, 22, 38, 37,
+      22, 23, 38, 23, 39, 38, 23, 24, 39, 24, 40, 39,
+      24, 25, 40, 25, 41, 40, 25, 26, 41, 26, 42, 41,
+      26, 27, 42, 27, 43, 42, 27, 28, 43, 28, 44, 43,
+      28, 29, 44, 29, 45, 44, 29, 30, 45, 30, 46, 45,
+      30, 31, 46, 31, 47, 46, 32, 33, 49, 48, 33, 34,
+      50, 49, 34, 35, 51, 50, 35, 36, 52, 51, 36, 37,
+      53, 52, 37, 38, 54, 53, 38, 39, 55, 54, 39, 40,
+      56, 55, 40, 41, 57, 56, 41, 42, 58, 57, 42, 43,
+      59, 58, 43, 44, 60, 59, 44, 45, 61, 60, 45, 46,
+      62, 61, 46, 47, 63, 62, 48, 49, 64, 49, 65, 64,
+      49, 50, 65, 50, 66, 65, 50, 51, 66, 51, 67, 66,
+      51, 52, 67, 52, 68, 67, 52, 53, 68, 53, 69, 68,
+      53, 54, 69, 54, 70, 69, 54, 55, 70, 55, 71, 70,
+      55, 56, 71, 56, 72, 71, 56, 57, 72, 57, 73, 72,
+      57, 58, 73, 58, 74, 73, 58, 59, 74, 59, 75, 74,
+      59, 60, 75, 60, 76, 75, 60, 61, 76, 61, 77, 76,
+      61, 62, 77, 62, 78, 77, 62, 63, 78, 63, 79, 78,
+      64, 65, 81, 80, 65, 66, 82, 81, 66, 67, 83, 82,
+      67, 68, 84, 83, 68, 69, 85, 84, 69, 70, 86, 85,
+      70, 71, 87, 86, 71, 72, 88, 87, 72, 73, 89, 88,
+      73, 74, 90, 89, 74, 75, 91, 90, 75, 76, 92, 91,
+      76, 77, 93, 92, 77, 78, 94, 93, 78, 79, 95, 94,
+      80, 81, 96, 81, 97, 96, 81, 82, 97, 82, 98, 97,
+      82, 83, 98, 83, 99, 98, 83, 84, 99, 84, 100, 99,
+      84, 85, 100, 85, 101, 100, 85, 86, 101, 86, 102, 101,
+      86, 87, 102, 87, 103, 102, 87, 88, 103, 88, 104, 103,
+      88, 89, 104, 89, 105, 104, 89, 90, 105, 90, 106, 105,
+      90, 91, 106, 91, 107, 106, 91, 92, 107, 92, 108, 107,
+      92, 93, 108, 93, 109, 108, 93, 94, 109, 94, 110, 109,
+      94, 95, 110, 95, 111, 110, 96, 97, 113, 112, 97, 98,
+      114, 113, 98, 99, 115, 114, 99, 100, 116, 115, 100, 101,
+      117, 116, 101, 102, 118, 117, 102, 103, 119, 118, 103, 104,
+      120, 119, 104, 105, 121, 120, 105, 106, 122, 121, 106, 107,
+      123, 122, 107, 108, 124, 123, 108, 109, 125, 124, 109, 110,
+      126, 125, 110, 111, 127, 126, 112, 113, 128, 113, 129, 128,
+      113, 114, 129, 114, 130, 129, 114, 115, 130, 115, 131, 130,
+      115, 116, 131, 116, 132, 131, 116, 117, 132, 117, 133, 132,
+      117, 118, 133, 118, 134, 133, 118, 119, 134, 119, 135, 134,
+      119, 120, 135, 120, 136, 135, 120, 121, 136, 121, 137, 136,
+      121, 122, 137, 122, 138, 137, 122, 123, 138, 123, 139, 138,
+      123, 124, 139, 124, 140, 139, 124, 125, 140, 125, 141, 140,
+      125, 126, 141, 126, 142, 141, 126, 127, 142, 127, 143, 142,
+      128, 129, 145, 144, 129, 130, 146, 145, 130, 131, 147, 146,
+      131, 132, 148, 147, 132, 133, 149, 148, 133, 134, 150, 149,
+      134, 135, 151, 150, 135, 136, 152, 151, 136, 137, 153, 152,
+      137, 138, 154, 153, 138, 139, 155, 154, 139, 140, 156, 155,
+      140, 141, 157, 156, 141, 142, 158, 157, 142, 143, 159, 158,
+      144, 145, 160, 145, 161, 160, 145, 146, 161, 146, 162, 161,
+      146, 147, 162, 147, 163, 162, 147, 148, 163, 148, 164, 163,
+      148, 149, 164, 149, 165, 164, 149, 150, 165, 150, 166, 165,
+      150, 151, 166, 151, 167, 166, 151, 152, 167, 152, 168, 167,
+      152, 153, 168, 153, 169, 168, 153, 154, 169, 154, 170, 169,
+      154, 155, 170, 155, 171, 170, 155, 156, 171, 156, 172, 171,
+      156, 157, 172, 157, 173, 172, 157, 158, 173, 158, 174, 173,
+      158, 159, 174, 159, 175, 174, 160, 161, 177, 176, 161, 162,
+      178, 177, 162, 163, 179, 178, 163, 164, 180, 179, 164, 165,
+      181, 180, 165, 166, 182, 181, 166, 167, 183, 182, 167, 168,
+      184, 183, 168, 169, 185, 184, 169, 170, 186, 185, 170, 171,
+      187, 186, 171, 172, 188, 187, 172, 173, 189, 188, 173, 174,
+      190, 189, 174, 175, 191, 190, 176, 177, 192, 177, 193, 192,
+      177, 178, 193, 178, 194, 193, 178, 179, 194, 179, 195, 194,
+      179, 180, 195, 180, 196, 195, 180, 181, 196, 181, 197, 196,
+      181, 182, 197, 182, 198, 197, 182, 183, 198, 183, 199, 198,
+      183, 184, 199, 184, 200, 199, 184, 185, 200, 185, 201, 200,
+      185, 186, 201, 186, 202, 201, 186, 187, 202, 187, 203, 202,
+      187, 188, 203, 188, 204, 203, 188, 189, 204, 189, 205, 204,
+      189, 190, 205, 190, 206, 205, 190, 191, 206, 191, 207, 206,
+      192, 193, 209, 208, 193, 194, 210, 209, 194, 195, 211, 210,
+      195, 196, 212, 211, 196, 197, 213, 212, 197, 198, 214, 213,
+      198, 199, 215, 214, 199, 200, 216, 215, 200, 201, 217, 216,
+      201, 202, 218, 217, 202, 203, 219, 218, 203, 204, 220, 219,
+      204, 205, 221, 220, 205, 206, 222, 221, 206, 207, 223, 222,
+      208, 209, 224, 209, 225, 224, 209, 210, 225, 210, 226, 225,
+      210, 211, 226, 211, 227, 226, 211, 212, 227, 212, 228, 227,
+      212, 213, 228, 213, 229, 228, 213, 214, 229, 214, 230, 229,
+      214, 215, 230, 215, 231, 230, 215, 216, 231, 216, 232, 231,
+      216, 217, 232, 217, 233, 232, 217, 218, 233, 218, 234, 233,
+      218, 219, 234, 219, 235, 234, 219, 220, 235, 220, 236, 235,
+      220, 221, 236, 221, 237, 236, 221, 222, 237, 222, 238, 237,
+      222, 223, 238, 223, 239, 238, 224, 225, 241, 240, 225, 226,
+      242, 241, 226, 227, 243, 242, 227, 228, 244, 243, 228, 229,
+      245, 244, 229, 230, 246, 245, 230, 231, 247, 246, 231, 232,
+      248, 247, 232, 233, 249, 248, 233, 234, 250, 249, 234, 235,
+      251, 250, 235, 236, 252, 251, 236, 237, 253, 252, 237, 238,
+      254, 253, 238, 239, 255, 254
+   };
+
+   // tilings/semi4_16x16
+   constexpr float m_tilings_semi4_16x16_vertex[] =
+   {
+      0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+      2.0f, 0.0f, 0.0f, 3.0f, 0.0f, 0.0f,
+      4.0f, 0.0f, 0.0f, 5.0f, 0.0f, 0.0f,
+      6.0f, 0.0f, 0.0f, 7.0f, 0.0f, 0.0f,
+      8.0f, 0.0f, 0.0f, 9.0f, 0.0f, 0.0f,
+      10.0f, 0.0f, 0.0f, 11.0f, 0.0f, 0.0f,
+      12.0f, 0.0f, 0.0f, 13.0f, 0.0f, 0.0f,
+      14.0f, 0.0f, 0.0f, 15.0f, 0.0f, 0.0f,
+      0.5f, 0.866025388f, 0.0f, 1.5f, 0.866025388f, 0.0f,
+      2.5f, 0.866025388f, 0.0f, 3.5f, 0.866025388f, 0.0f,
+      4.5f, 0.866025388f, 0.0f, 5.5f, 0.866025388f, 0.0f,
+      6.5f, 0.866025388f, 0.0f, 7.5f, 0.866025388f, 0.0f,
+      8.5f, 0.866025388f, 0.0f, 9.5f, 0.866025388f, 0.0f,
+      10.5f, 0.866025388f, 0.0f, 11.5f, 0.866025388f, 0.0f,
+      12.5f, 0.866025388f, 0.0f, 13.5f, 0.866025388f, 0.0f,
+      14.5f, 0.866025388f, 0.0f, 15.5f, 0.866025388f, 0.0f,
+      1.0f, 1.73205078f, 0.0f, 2.0f, 1.73205078f, 0.0f,
+      3.0f, 1.73205078f, 0.0f, 4.0f, 1.73205078f, 0.0f,
+      5.0f, 1.73205078f, 0.0f, 6.0f, 1.73205078f, 0.0f,
+      7.0f, 1.73205078f, 0.0f, 8.0f, 1.73205078f, 0.0f,
+      9.0f, 1.73205078f, 0.0f, 10.0f, 1.73205078f, 0.0f,
+      11.0f, 1.73205078f, 0.0f, 12.0f, 1.73205078f, 0.0f,
+      13.0f, 1.73205078f, 0.0f, 14.0f, 1.73205078f, 0.0f,
+      15.0f, 1.73205078f, 0.0f, 16.0f, 1.73205078f, 0.0f,
+      1.5f, 2.59807611f, 0.0f, 2.5f, 2.59807611f, 0.0f,
+      3.5f, 2.59807611f, 0.0f, 4.5f, 2.59807611f, 0.0f,
+      5.5f, 2.59807611f, 0.0f, 6.5f, 2.59807611f, 0.0f,
+      7.5f, 2.59807611f, 0.0f, 8.5f, 2.59807611f, 0.0f,
+      9.5f, 2.59807611f, 0.0f, 10.5f, 2.59807611f, 0.0f,
+      11.5f, 2.59807611f, 0.0f, 12.5f, 2.59807611f, 0.0f,
+      13.5f, 2.59807611f, 0.0f, 14.5f, 2.59807611f, 0.0f,
+      15.5f, 2.59807611f, 0.0f, 16.5f, 2.59807611f, 0.0f,
+      2.0f, 3.46410155f, 0.0f, 3.0f, 3.46410155f, 0.0f,
+      4.0f, 3.46410155f, 0.0f, 5.0f, 3.46410155f, 0.0f,
+      6.0f, 3.46410155f, 0.0f, 7.0f, 3.46410155f, 0.0f,
+      8.0f, 3.46410155f, 0.0f, 9.0f, 3.46410155f, 0.0f,
+      10.0f, 3.46410155f, 0.0f, 11.0f, 3.46410155f, 0.0f,
+      12.0f, 3.46410155f, 0.0f, 13.0f, 3.46410155f, 0.0f,
+      14.0f, 3.46410155f, 0.0f, 15.0f, 3.46410155f, 0.0f,
+      16.0f, 3.46410155f, 0.0f, 17.0f, 3.46410155f, 0.0f,
+      2.5f, 4.33012676f, 0.0f, 3.5f, 4.33012676f, 0.0f,
+      4.5f, 4.33012676f, 0.0f, 5.5f, 4.33012676f, 0.0f,
+      6.5f, 4.33012676f, 0.0f, 7.5f, 4.33012676f, 0.0f,
+      8.5f, 4.33012676f, 0.0f, 9.5f, 4.33012676f, 0.0f,
+      10.5f, 4.33012676f, 0.0f, 11.5f, 4.33012676f, 0.0f,
+      12.5f, 4.33012676f, 0.0f, 13.5f, 4.33012676f, 0.0f,
+      14.5f, 4.33012676f, 0.0f, 15.5f, 4.33012676f, 0.0f,
+      16.5f, 4.33012676f, 0.0f, 17.5f, 4.33012676f, 0.0f,
+      3.0f, 5.19615221f, 0.0f, 4.0f, 5.19615221f, 0.0f,
+      5.0f, 5.19615221f, 0.0f, 6.0f, 5.19615221f, 0.0f,
+      7.0f, 5.19615221f, 0.0f, 8.0f, 5.19615221f, 0.0f,
+      9.0f, 5.19615221f, 0.0f, 10.0f, 5.19615221f, 0.0f,
+      11.0f, 5.19615221f, 0.0f, 12.0f, 5.19615221f, 0.0f,
+      13.0f, 5.19615221f, 0.0f, 14.0f, 5.19615221f, 0.0f,
+      15.0f, 5.19615221f, 0.0f, 16.0f, 5.19615221f, 0.0f,
+      17.0f, 5.19615221f, 0.0f, 18.0f, 5.19615221f, 0.0f,
+      3.5f, 6.06217766f, 0.0f, 4.5f, 6.06217766f, 0.0f,
+      5.5f, 6.06217766f, 0.0f, 6.5f, 6.06217766f, 0.0f,
+      7.5f, 6.06217766f, 0.0f, 8.5f, 6.06217766f, 0.0f,
+      9.5f, 6.06217766f, 0.0f, 10.5f, 6.06217766f, 0.0f,
+      11.5f, 6.06217766f, 0.0f, 12.5f, 6.06217766f, 0.0f,
+      13.5f, 6.06217766f, 0.0f, 14.5f, 6.06217766f, 0.0f,
+      15.5f, 6.06217766f, 0.0f, 16.5f, 6.06217766f, 0.0f,
+      17.5f, 6.06217766f, 0.0f, 18.5f, 6.06217766f, 0.0f,
+      4.0f, 6.92820311f, 0.0f, 5.0f, 6.92820311f, 0.0f,
+      6.0f, 6.92820311f, 0.0f, 7.0f, 6.92820311f, 0.0f,
+      8.0f, 6.92820311f, 0.0f, 9.0f, 6.92820311f, 0.0f,
+      10.0f, 6.92820311f, 0.0f, 11.0f, 6.92820311f, 0.0f,
+      12.0f, 6.92820311f, 0.0f, 13.0f, 6.92820311f, 0.0f,
+      14.0f, 6.92820311f, 0.0f, 15.0f, 6.92820311f, 0.0f,
+      16.0f, 6.92820311f, 0.0f, 17.0f, 6.92820311f, 0.0f,
+      18.0f, 6.92820311f, 0.0f, 19.0f, 6.92820311f, 0.0f,
+      4.5f, 7.79422855f, 0.0f, 5.5f, 7.79422855f, 0.0f,
+      6.5f, 7.79422855f, 0.0f, 7.5f, 7.79422855f, 0.0f,
+      8.5f, 7.79422855f, 0.0f, 9.5f, 7.79422855f, 0.0f,
+      10.5f, 7.79422855f, 0.0f, 11.5f, 7.79422855f, 0.0f,
+      12.5f, 7.79422855f, 0.0f, 13.5f, 7.79422855f, 0.0f,
+      14.5f, 7.79422855f, 0.0f, 15.5f, 7.79422855f, 0.0f,
+      16.5f, 7.79422855f, 0.0f, 17.5f, 7.79422855f, 0.0f,
+      18.5f, 7.79422855f, 0.0f, 19.5f, 7.79422855f, 0.0f,
+      5.0f, 8.66025352f, 0.0f, 6.0f, 8.66025352f, 0.0f,
+      7.0f, 8.66025352f, 0.0f, 8.0f, 8.66025352f, 0.0f,
+      9.0f, 8.66025352f, 0.0f, 10.0f, 8.66025352f, 0.0f,
+      11.0f, 8.66025352f, 0.0f, 12.0f, 8.66025352f, 0.0f,
+      13.0f, 8.66025352f, 0.0f, 14.0f, 8.66025352f, 0.0f,
+      15.0f, 8.66025352f, 0.0f, 16.0f, 8.66025352f, 0.0f,
+      17.0f, 8.66025352f, 0.0f, 18.0f, 8.66025352f, 0.0f,
+      19.0f, 8.66025352f, 0.0f, 20.0f, 8.66025352f, 0.0f,
+      5.5f, 9.52627945f, 0.0f, 6.5f, 9.52627945f, 0.0f,
+      7.5f, 9.52627945f, 0.0f, 8.5f, 9.52627945f, 0.0f,
+      9.5f, 9.52627945f, 0.0f, 10.5f, 9.52627945f, 0.0f,
+      11.5f, 9.52627945f, 0.0f, 12.5f, 9.52627945f, 0.0f,
+      13.5f, 9.52627945f, 0.0f, 14.5f, 9.52627945f, 0.0f,
+      15.5f, 9.52627945f, 0.0f, 16.5f, 9.52627945f, 0.0f,
+      17.5f, 9.52627945f, 0.0f, 18.5f, 9.52627945f, 0.0f,
+      19.5f, 9.52627945f, 0.0f, 20.5f, 9.52627945f, 0.0f,
+      6.0f, 10.3923044f, 0.0f, 7.0f, 10.3923044f, 0.0f,
+      8.0f, 10.3923044f, 0.0f, 9.0f, 10.3923044f, 0.0f,
+      10.0f, 10.3923044f, 0.0f, 11.0f, 10.3923044f, 0.0f,
+      12.0f, 10.3923044f, 0.0f, 13.0f, 10.3923044f, 0.0f,
+      14.0f, 10.3923044f, 0.0f, 15.0f, 10.3923044f, 0.0f,
+      16.0f, 10.3923044f, 0.0f, 17.0f, 10.3923044f, 0.0f,
+      18.0f, 10.3923044f, 0.0f, 19.0f, 10.3923044f, 0.0f,
+      20.0f, 10.3923044f, 0.0f, 21.0f, 10.3923044f, 0.0f,
+      6.5f, 11.2583303f, 0.0f, 7.5f, 11.2583303f, 0.0f,
+      8.5f, 11.2583303f, 0.0f, 9.5f, 11.2583303f, 0.0f,
+      10.5f, 11.2583303f, 0.0f, 11.5f, 11.2583303f, 0.0f,
+      12.5f, 11.2583303f, 0.0f, 13.5f, 11.2583303f, 0.0f,
+      14.5f, 11.2583303f, 0.0f, 15.5f, 11.2583303f, 0.0f,
+      16.5f, 11.2583303f, 0.0f, 17.5f, 11.2583303f, 0.0f,
+      18.5f, 11.2583303f, 0.0f, 19.5f, 11.2583303f, 0.0f,
+      20.5f, 11.2583303f, 0.0f, 21.5f, 11.2583303f, 0.0f,
+      7.0f, 12.1243553f, 0.0f, 8.0f, 12.1243553f, 0.0f,
+      9.0f, 12.1243553f, 0.0f, 10.0f, 12.1243553f, 0.0f,
+      11.0f, 12.1243553f, 0.0f, 12.0f, 12.1243553f, 0.0f,
+      13.0f, 12.1243553f, 0.0f, 14.0f, 12.1243553f, 0.0f,
+      15.0f, 12.1243553f, 0.0f, 16.0f, 12.1243553f, 0.0f,
+      17.0f, 12.1243553f, 0.0f, 18.0f, 12.1243553f, 0.0f,
+      19.0f, 12.1243553f, 0.0f, 20.0f, 12.1243553f, 0.0f,
+      21.0f, 12.1243553f, 0.0f, 22.0f, 12.1243553f, 0.0f,
+      7.5f, 12.9903812f, 0.0f, 8.5f, 12.9903812f, 0.0f,
+      9.5f, 12.9903812f, 0.0f, 10.5f, 12.9903812f, 0.0f,
+      11.5f, 12.9903812f, 0.0f, 12.5f, 12.9903812f, 0.0f,
+      13.5f, 12.9903812f, 0.0f, 14.5f, 12.9903812f, 0.0f,
+      15.5f, 12.9903812f, 0.0f, 16.5f, 12.9903812f, 0.0f,
+      17.5f, 12.9903812f, 0.0f, 18.5f, 12.9903812f, 0.0f,
+      19.5f, 12.9903812f, 0.0f, 20.5f, 12.9903812f, 0.0f,
+      21.5f, 12.9903812f, 0.0f, 22.5f, 12.9903812f, 0.0f
+   };
+   constexpr int m_tilings_semi4_16x16_faceStart[] =
+   {
+      0, 6, 9, 15, 18, 24, 27, 33, 36, 42, 45, 51,
+      54, 60, 63, 66, 69, 72, 75, 78, 81, 84, 90, 93,
+      99, 102, 108, 111, 117, 120, 126, 129, 135, 138, 144, 147,
+      150, 153, 156, 159, 162, 165, 168, 174, 177, 183, 186, 192,
+      195, 201, 204, 210, 213, 219, 222, 228, 231, 234, 237, 240,
+      243, 246, 249, 252, 258, 261, 267, 270, 276, 279, 285, 288,
+      294, 297, 303, 306, 312, 315, 318, 321, 324, 327, 330, 333,
+      336, 342, 345, 351, 354, 360, 363, 369, 372, 378, 381, 387,
+      390, 396, 399, 402, 405, 408, 411, 414, 417, 420, 426, 429,
+      435, 438, 444, 447, 453, 456, 462, 465, 471, 474, 480, 483,
+      486, 489, 492, 495, 498, 501, 504, 510, 513, 519, 522, 528,
+      531, 537, 540, 546, 549, 555, 558, 564, 567, 570, 573, 576,
+      579, 582, 585, 588
+   };
+   constexpr int m_tilings_semi4_16x16_faceIndex[] =
+   {
+      1, 2, 18, 33, 32, 16, 2, 3, 18, 3, 4, 20,
+      35, 34, 18, 4, 5, 20, 5, 6, 22, 37, 36, 20,
+      6, 7, 22, 7, 8, 24, 39, 38, 22, 8, 9, 24,
+      9, 10, 26, 41, 40, 24, 10, 11, 26, 11, 12, 28,
+      43, 42, 26, 12, 13, 28, 13, 14, 30, 45, 44, 28,
+      14, 15, 30, 18, 34, 33, 20, 36, 35, 22, 38, 37,
+      24, 40, 39, 26, 42, 41, 28, 44, 43, 30, 46, 45,
+      33, 34, 50, 65, 64, 48, 34, 35, 50, 35, 36, 52,
+      67, 66, 50, 36, 37, 52, 37, 38, 54, 69, 68, 52,
+      38, 39, 54, 39, 40, 56, 71, 70, 54, 40, 41, 56,
+      41, 42, 58, 73, 72, 56, 42, 43, 58, 43, 44, 60,
+      75, 74, 58, 44, 45, 60, 45, 46, 62, 77, 76, 60,
+      46, 47, 62, 50, 66, 65, 52, 68, 67, 54, 70, 69,
+      56, 72, 71, 58, 74, 73, 60, 76, 75, 62, 78, 77,
+      65, 66, 82, 97, 96, 80, 66, 67, 82, 67, 68, 84,
+      99, 98, 82, 68, 69, 84, 69, 70, 86, 101, 100, 84,
+      70, 71, 86, 71, 72, 88, 103, 102, 86, 72, 73, 88,
+      73, 74, 90, 105, 104, 88, 74, 75, 90, 75, 76, 92,
+      107, 106, 90, 76, 77, 92, 77, 78, 94, 109, 108, 92,
+      78, 79, 94, 82, 98, 97, 84, 100, 99, 86, 102, 101,
+      88, 104, 103, 90, 106, 105, 92, 108, 107, 94, 110, 109,
+      97, 98, 114, 129, 128, 112, 98, 99, 114, 99, 100, 116,
+      131, 130, 114, 100, 101, 116, 101, 102, 118, 133, 132, 116,
+      102, 103, 118, 103, 104, 120, 135, 134, 118, 104, 105, 120,
+      105, 106, 122, 137, 136, 120, 106, 107, 122, 107, 108, 124,
+      139, 138, 122, 108, 109, 124, 109, 110, 126, 141, 140, 124,
+      110, 111, 126, 114, 130, 129, 116, 132, 131, 118, 134, 133,
+      120, 136, 135, 122, 138, 137, 124, 140, 139, 126, 142, 141,
+      129, 130, 146, 161, 160, 144, 130, 131, 146, 131, 132, 148,
+      163, 162, 146, 132, 133, 148, 133, 134, 150, 165, 164, 148,
+      134, 135, 150, 135, 136, 152, 167, 166, 150, 136, 137, 152,
+      137, 138, 154, 169, 168, 152, 138, 139, 154, 139, 140, 156,
+      171, 170, 154, 140, 141, 156, 141, 142, 158, 173, 172, 156,
+      142, 143, 158, 146, 162, 161, 148, 164, 163, 150, 166, 165,
+      152, 168, 167, 154, 170, 169, 156, 172, 171, 158, 174, 173,
+      161, 162, 178, 193, 192, 176, 162, 163, 178, 163, 164, 180,
+      195, 194, 178, 164, 165, 180, 165, 166, 182, 197, 196, 180,
+      166, 167, 182, 167, 168, 184, 199, 198, 182, 168, 169, 184,
+      169, 170, 186, 201, 200, 184, 170, 171, 186, 171, 172, 188,
+      203, 202, 186, 172, 173, 188, 173, 174, 190, 205, 204, 188,
+      174, 175, 190, 178, 194, 193, 180, 196, 195, 182, 198, 197,
+      184, 200, 199, 186, 202, 201, 188, 204, 203, 190, 206, 205,
+      193, 194, 210, 225, 224, 208, 194, 195, 210, 195, 196, 212,
+      227, 226, 210, 196, 197, 212, 197, 198, 214, 229, 228, 212,
+      198, 199, 214, 199, 200, 216, 231, 230, 214, 200, 201, 216,
+      201, 202, 218, 233, 232, 216, 202, 203, 218, 203, 204, 220,
+      235, 234, 218, 204, 205, 220, 205, 206, 222, 237, 236, 220,
+      206, 207, 222, 210, 226, 225, 212, 228, 227, 214, 230, 229,
+      216, 232, 231, 218, 234, 233, 220, 236, 235, 222, 238, 237
+   };
+
+   // tilings/semi5_16x16
+   constexpr float m_tilings_semi5_16x16_vertex[] =
+   {
+      0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+      1.86602545f, 0.5f, 0.0f, 2.86602545f, 0.5f, 0.0f,
+      3.7320509f, 1.0f, 0.0f, 4.7320509f, 1.0f, 0.0f,
+      5.59807634f, 1.5f, 0.0f, 6.59807634f, 1.5f, 0.0f,
+      7.46410179f, 2.0f, 0.0f, 8.46410179f, 2.0f, 0.0f,
+      9.33012772f, 2.5f, 0.0f, 10.3301277f, 2.5f, 0.0f,
+      11.1961527f, 3.0f, 0.0f, 12.1961527f, 3.0f, 0.0f,
+      13.0621777f, 3.5f, 0.0f, 14.0621777f, 3.5f, 0.0f,
+      0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+      1.86602545f, 1.5f, 0.0f, 2.86602545f, 1.5f, 0.0f,
+      3.7320509f, 2.0f, 0.0f, 4.7320509f, 2.0f, 0.0f,
+      5.59807634f, 2.5f, 0.0f, 6.59807634f, 2.5f, 0.0f,
+      7.46410179f, 3.0f, 0.0f, 8.46410179f, 3.0f, 0.0f,
+      9.33012772f, 3.5f, 0.0f, 10.3301277f, 3.5f, 0.0f,
+      11.1961527f, 4.0f, 0.0f, 12.1961527f, 4.0f, 0.0f,
+      13.0621777f, 4.5f, 0.0f, 14.0621777f, 4.5f, 0.0f,
+      -0.5f, 1.86602545f, 0.0f, 0.5f, 1.86602545f, 0.0f,
+      1.36602545f, 2.36602545f, 0.0f, 2.36602545f, 2.36602545f, 0.0f,
+      3.2320509f, 2.86602545f, 0.0f, 4.2320509f, 2.86602545f, 0.0f,
+      5.09807634f, 3.36602545f, 0.0f, 6.09807634f, 3.36602545f, 0.0f,
+      6.96410179f, 3.86602545f, 0.0f, 7.96410179f, 3.86602545f, 0.0f,
+      8.83012772f, 4.36602545f, 0.0f, 9.83012772f, 4.36602545f, 0.0f,
+      10.6961527f, 4.86602545f, 0.0f, 11.6961527f, 4.86602545f, 0.0f,
+      12.5621777f, 5.36602545f, 0.0f, 13.5621777f, 5.36602545f, 0.0f,
+      -0.5f, 2.86602545f, 0.0f, 0.5f, 2.86602545f, 0.0f,
+      1.36602545f, 3.36602545f, 0.0f, 2.36602545f, 3.36602545f, 0.0f,
+      3.2320509f, 3.86602545f, 0.0f, 4.2320509f, 3.86602545f, 0.0f,
+      5.09807634f, 4.36602545f, 0.0f, 6.09807634f, 4.36602545f, 0.0f,
+      6.96410179f, 4.86602545f, 0.0f, 7.96410179f, 4.86602545f, 0.0f,
+      8.83012772f, 5.36602545f, 0.0f, 9.83012772f, 5.36602545f, 0.0f,
+      10.6961527f, 5.86602545f, 0.0f, 11.6961527f, 5.86602545f, 0.0f,
+      12.5621777f, 6.36602545f, 0.0f, 13.5621777f, 6.36602545f, 0.0f,
+      -1.0f, 3.7320509f, 0.0f, 0.0f, 3.7320509f, 0.0f,
+      0.866025448f, 4.2320509f, 0.0f, 1.86602545f, 4.2320509f, 0.0f,
+      2.7320509f, 4.7320509f, 0.0f, 3.7320509f, 4.7320509f, 0.0f,
+      4.59807634f, 5.2320509f, 0.0f, 5.59807634f, 5.2320509f, 0.0f,
+      6.46410179f, 5.7320509f, 0.0f, 7.46410179f, 5.7320509f, 0.0f,
+      8.33012772f, 6.2320509f, 0.0f, 9.33012772f, 6.2320509f, 0.0f,
+      10.1961527f, 6.7320509f, 0.0f, 11.1961527f, 6.7320509f, 0.0f,
+      12.0621777f, 7.2320509f, 0.0f, 13.0621777f, 7.2320509f, 0.0f,
+      -1.0f, 4.7320509f, 0.0f, 0.0f, 4.7320509f, 0.0f,
+      0.866025448f, 5.2320509f, 0.0f, 1.86602545f, 5.2320509f, 0.0f,
+      2.7320509f, 5.7320509f, 0.0f, 3.7320509f, 5.7320509f, 0.0f,
+      4.59807634f, 6.2320509f, 0.0f, 5.59807634f, 6.2320509f, 0.0f,
+      6.46410179f, 6.7320509f, 0.0f, 7.46410179f, 6.7320509f, 0.0f,
+      8.33012772f, 7.2320509f, 0.0f, 9.33012772f, 7.2320509f, 0.0f,
+      10.1961527f, 7.7320509f, 0.0f, 11.1961527f, 7.7320509f, 0.0f,
+      12.0621777f, 8.2320509f, 0.0f, 13.0621777f, 8.2320509f, 0.0f,
+      -1.5f, 5.59807634f, 0.0f, -0.5f, 5.59807634f, 0.0f,
+      0.366025448f, 6.09807634f, 0.0f, 1.36602545f, 6.09807634f, 0.0f,
+      2.2320509f, 6.59807634f, 0.0f, 3.2320509f, 6.59807634f, 0.0f,
+      4.09807634f, 7.09807634f, 0.0f, 5.09807634f, 7.09807634f, 0.0f,
+      5.96410179f, 7.59807634f, 0.0f, 6.96410179f, 7.59807634f, 0.0f,
+      7.83012772f, 8.09807587f, 0.0f, 8.83012772f, 8.09807587f, 0.0f,
+      9.69615269f, 8.59807587f, 0.0f, 10.6961527f, 8.59807587f, 0.0f,
+      11.5621777f, 9.09807587f, 0.0f, 12.5621777f, 9.09807587f, 0.0f,
+      -1.5f, 6.59807634f, 0.0f, -0.5f, 6.59807634f, 0.0f,
+      0.366025448f, 7.09807634f, 0.0f, 1.36602545f, 7.09807634f, 0.0f,
+      2.2320509f, 7.59807634f, 0.0f, 3.2320509f, 7.59807634f, 0.0f,
+      4.09807634f, 8.09807587f, 0.0f, 5.09807634f, 8.09807587f, 0.0f,
+      5.96410179f, 8.59807587f, 0.0f, 6.96410179f, 8.59807587f, 0.0f,
+      7.83012772f, 9.09807587f, 0.0f, 8.83012772f, 9.09807587f, 0.0f,
+      9.69615269f, 9.59807587f, 0.0f, 10.6961527f, 9.59807587f, 0.0f,
+      11.5621777f, 10.0980759f, 0.0f, 12.5621777f, 10.0980759f, 0.0f,
+      -2.0f, 7.46410179f, 0.0f, -1.0f, 7.46410179f, 0.0f,
+      -0.133974552f, 7.96410179f, 0.0f, 0.866025448f, 7.96410179f, 0.0f,
+      1.7320509f, 8.46410179f, 0.0f, 2.7320509f, 8.46410179f, 0.0f,
+      3.59807634f, 8.96410179f, 0.0f, 4.59807634f, 8.96410179f, 0.0f,
+      5.46410179f, 9.46410179f, 0.0f, 6.46410179f, 9.46410179f, 0.0f,
+      7.33012772f, 9.96410179f, 0.0f, 8.33012772f, 9.96410179f, 0.0f,
+      9.19615269f, 10.4641018f, 0.0f, 10.1961527f, 10.4641018f, 0.0f,
+      11.0621777f, 10.9641018f, 0.0f, 12.0621777f, 10.9641018f, 0.0f,
+      -2.0f, 8.46410179f, 0.0f, -1.0f, 8.46410179f, 0.0f,
+      -0.133974552f, 8.96410179f, 0.0f, 0.866025448f, 8.96410179f, 0.0f,
+      1.7320509f, 9.46410179f, 0.0f, 2.7320509f, 9.46410179f, 0.0f,
+      3.59807634f, 9.96410179f, 0.0f, 4.59807634f, 9.96410179f, 0.0f,
+      5.46410179f, 10.4641018f, 0.0f, 6.46410179f, 10.4641018f, 0.0f,
+      7.33012772f, 10.9641018f, 0.0f, 8.33012772f, 10.9641018f, 0.0f,
+      9.19615269f, 11.4641018f, 0.0f, 10.1961527f, 11.4641018f, 0.0f,
+      11.0621777f, 11.9641018f, 0.0f, 12.0621777f, 11.9641018f, 0.0f,
+      -2.5f, 9.33012772f, 0.0f, -1.5f, 9.33012772f, 0.0f,
+      -0.633974552f, 9.83012772f, 0.0f, 0.366025448f, 9.83012772f, 0.0f,
+      1.2320509f, 10.3301277f, 0.0f, 2.2320509f, 10.3301277f, 0.0f,
+      3.09807634f, 10.8301277f, 0.0f, 4.09807634f, 10.8301277f, 0.0f,
+      4.96410179f, 11.3301277f, 0.0f, 5.96410179f, 11.3301277f, 0.0f,
+      6.83012772f, 11.8301277f, 0.0f, 7.83012772f, 11.8301277f, 0.0f,
+      8.69615269f, 12.3301277f, 0.0f, 9.69615269f, 12.3301277f, 0.0f,
+      10.5621777f, 12.8301277f, 0.0f, 11.5621777f, 12.8301277f, 0.0f,
+      -2.5f, 10.3301277f, 0.0f, -1.5f, 10.3301277f, 0.0f,
+      -0.633974552f, 10.8301277f, 0.0f, 0.366025448f, 10.8301277f, 0.0f,
+      1.2320509f, 11.3301277f, 0.0f, 2.2320509f, 11.3301277f, 0.0f,
+      3.09807634f, 11.8301277f, 0.0f, 4.09807634f, 11.8301277f, 0.0f,
+      4.96410179f, 12.3301277f, 0.0f, 5.96410179f, 12.3301277f, 0.0f,
+      6.83012772f, 12.8301277f, 0.0f, 7.83012772f, 12.8301277f, 0.0f,
+      8.69615269f, 13.3301277f, 0.0f, 9.69615269f, 13.3301277f, 0.0f,
+      10.5621777f, 13.8301277f, 0.0f, 11.5621777f, 13.8301277f, 0.0f,
+      -3.0f, 11.1961527f, 0.0f, -2.0f, 11.1961527f, 0.0f,
+      -1.13397455f, 11.6961527f, 0.0f, -0.133974552f, 11.6961527f, 0.0f,
+      0.732050896f, 12.1961527f, 0.0f, 1.7320509f, 12.1961527f, 0.0f,
+      2.59807634f, 12.6961527f, 0.0f, 3.59807634f, 12.6961527f, 0.0f,
+      4.46410179f, 13.1961527f, 0.0f, 5.46410179f, 13.1961527f, 0.0f,
+      6.33012772f, 13.6961527f, 0.0f, 7.33012772f, 13.6961527f, 0.0f,
+      8.19615269f, 14.1961527f, 0.0f, 9.19615269f, 14.1961527f, 0.0f,
+      10.0621777f, 14.6961527f, 0.0f, 11.0621777f, 14.6961527f, 0.0f,
+      -3.0f, 12.1961527f, 0.0f, -2.0f, 12.1961527f, 0.0f,
+      -1.13397455f, 12.6961527f, 0.0f, -0.133974552f, 12.6961527f, 0.0f,
+      0.732050896f, 13.1961527f, 0.0f, 1.7320509f, 13.1961527f, 0.0f,
+      2.59807634f, 13.6961527f, 0.0f, 3.59807634f, 13.6961527f, 0.0f,
+      4.46410179f, 14.1961527f, 0.0f, 5.46410179f, 14.1961527f, 0.0f,
+      6.33012772f, 14.6961527f, 0.0f, 7.33012772f, 14.6961527f, 0.0f,
+      8.19615269f, 15.1961527f, 0.0f, 9.19615269f, 15.1961527f, 0.0f,
+      10.0621777f, 15.6961527f, 0.0f, 11.0621777f, 15.6961527f, 0.0f,
+      -3.5f, 13.0621777f, 0.0f, -2.5f, 13.0621777f, 0.0f,
+      -1.63397455f, 13.5621777f, 0.0f, -0.633974552f, 13.5621777f, 0.0f,
+      0.232050896f, 14.0621777f, 0.0f, 1.2320509f, 14.0621777f, 0.0f,
+      2.09807634f, 14.5621777f, 0.0f, 3.09807634f, 14.5621777f, 0.0f,
+      3.96410179f, 15.0621777f, 0.0f, 4.96410179f, 15.0621777f, 0.0f,
+      5.83012772f, 15.5621777f, 0.0f, 6.83012772f, 15.5621777f, 0.0f,
+      7.69615269f, 16.0621777f, 0.0f, 8.69615269f, 16.0621777f, 0.0f,
+      9.56217766f, 16.5621777f, 0.0f, 10.5621777f, 16.5621777f, 0.0f,
+      -3.5f, 14.0621777f, 0.0f, -2.5f, 14.0621777f, 0.0f,
+      -1.63397455f, 14.5621777f, 0.0f, -0.633974552f, 14.5621777f, 0.0f,
+      0.232050896f, 15.0621777f, 0.0f, 1.2320509f, 15.0621777f, 0.0f,
+      2.09807634f, 15.5621777f, 0.0f, 3.09807634f, 15.5621777f, 0.0f,
+      3.96410179f, 16.0621777f, 0.0f, 4.96410179f, 16.0621777f, 0.0f,
+      5.83012772f, 16.5621777f, 0.0f, 6.83012772f, 16.5621777f, 0.0f,
+      7.69615269f, 17.0621777f, 0.0f, 8.69615269f, 17.0621777f, 0.0f,
+      9.56217766f, 17.5621777f, 0.0f, 10.5621777f, 17.5621777f, 0.0f
+   };
+   constexpr int m_tilings_semi5_16x16_faceStart[] =
+   {
+      0, 3, 7, 10, 13, 17, 20, 23, 27, 30, 33, 37,
+      40, 43, 47, 50, 53, 57, 60, 63, 67, 70, 74, 77,
+      80, 84, 87, 90, 94, 97, 100, 104, 107, 110, 114, 117,
+      120, 124, 127, 130, 134, 137, 140, 143, 147, 150, 153, 157,
+      160, 163, 167, 170, 173, 177, 180, 183, 187, 190, 193, 197,
+      200, 203, 207, 210, 214, 217, 220, 224, 227, 230, 234, 237,
+      240, 244, 247, 250, 254, 257, 260, 264, 267, 270, 274, 277,
+      280, 283, 287, 290, 293, 297, 300, 303, 307, 310, 313, 317,
+      320, 323, 327, 330, 333, 337, 340, 343, 347, 350, 354, 357,
+      360, 364, 367, 370, 374, 377, 380, 384, 387, 390, 394, 397,
+      400, 404, 407, 410, 414, 417, 420, 423, 427, 430, 433, 437,
+      440, 443, 447, 450, 453, 457, 460, 463, 467, 470, 473, 477,
+      480, 483, 487, 490, 494, 497, 500, 504, 507, 510, 514, 517,
+      520, 524, 527, 530, 534, 537, 540, 544, 547, 550, 554, 557,
+      560, 563, 567, 570, 573, 577, 580, 583, 587, 590, 593, 597,
+      600, 603, 607, 610, 613, 617, 620, 623, 627, 630, 634, 637,
+      640, 644, 647, 650, 654, 657, 660, 664, 667, 670, 674, 677,
+      680, 684, 687, 690, 694, 697, 700, 703, 707, 710, 713, 717,
+      720, 723, 727, 730, 733, 737, 740, 743, 747, 750, 753, 757,
+      760, 763, 767, 770, 774, 777, 780, 784, 787, 790, 794, 797,
+      800, 804, 807, 810, 814, 817, 820, 824, 827, 830, 834, 837,
+      840, 843, 847, 850, 853, 857, 860, 863, 867, 870, 873, 877,
+      880, 883, 887, 890, 893, 897, 900, 903, 907, 910, 914, 917,
+      920, 924, 927, 930, 934, 937, 940, 944, 947, 950, 954, 957,
+      960, 964, 967, 970, 974, 977, 980, 983, 987, 990, 993, 997,
+      1000, 1003, 1007, 1010, 1013, 1017, 1020, 1023, 1027, 1030, 1033, 1037,
+      1040, 1043, 1047, 1050
+   };
+   constexpr int m_tilings_semi5_16x16_faceIndex[] =
+   {
+      1, 2, 17, 2, 3, 19, 18, 2, 18, 17, 3, 4,
+      19, 4, 5, 21, 20, 4, 20, 19, 5, 6, 21, 6,
+      7, 23, 22, 6, 22, 21, 7, 8, 23, 8, 9, 25,
+      24, 8, 24, 23, 9, 10, 25, 10, 11, 27, 26, 10,
+      26, 25, 11, 12, 27, 12, 13, 29, 28, 12, 28, 27,
+      13, 14, 29, 14, 15, 31, 30, 14, 30, 29, 17, 18,
+      34, 33, 18, 19, 35, 18, 35, 34, 19, 20, 36, 35,
+      20, 21, 37, 20, 37, 36, 21, 22, 38, 37, 22, 23,
+      39, 22, 39, 38, 23, 24, 40, 39, 24, 25, 41, 24,
+      41, 40, 25, 26, 42, 41, 26, 27, 43, 26, 43, 42,
+      27, 28, 44, 43, 28, 29, 45, 28, 45, 44, 29, 30,
+      46, 45, 30, 31, 47, 30, 47, 46, 33, 34, 49, 34,
+      35, 51, 50, 34, 50, 49, 35, 36, 51, 36, 37, 53,
+      52, 36, 52, 51, 37, 38, 53, 38, 39, 55, 54, 38,
+      54, 53, 39, 40, 55, 40, 41, 57, 56, 40, 56, 55,
+      41, 42, 57, 42, 43, 59, 58, 42, 58, 57, 43, 44,
+      59, 44, 45, 61, 60, 44, 60, 59, 45, 46, 61, 46,
+      47, 63, 62, 46, 62, 61, 49, 50, 66, 65, 50, 51,
+      67, 50, 67, 66, 51, 52, 68, 67, 52, 53, 69, 52,
+      69, 68, 53, 54, 70, 69, 54, 55, 71, 54, 71, 70,
+      55, 56, 72, 71, 56, 57, 73, 56, 73, 72, 57, 58,
+      74, 73, 58, 59, 75, 58, 75, 74, 59, 60, 76, 75,
+      60, 61, 77, 60, 77, 76, 61, 62, 78, 77, 62, 63,
+      79, 62, 79, 78, 65, 66, 81, 66, 67, 83, 82, 66,
+      82, 81, 67, 68, 83, 68, 69, 85, 84, 68, 84, 83,
+      69, 70, 85, 70, 71, 87, 86, 70, 86, 85, 71, 72,
+      87, 72, 73, 89, 88, 72, 88, 87, 73, 74, 89, 74,
+      75, 91, 90, 74, 90, 89, 75, 76, 91, 76, 77, 93,
+      92, 76, 92, 91, 77, 78, 93, 78, 79, 95, 94, 78,
+      94, 93, 81, 82, 98, 97, 82, 83, 99, 82, 99, 98,
+      83, 84, 100, 99, 84, 85, 101, 84, 101, 100, 85, 86,
+      102, 101, 86, 87, 103, 86, 103, 102, 87, 88, 104, 103,
+      88, 89, 105, 88, 105, 104, 89, 90, 106, 105, 90, 91,
+      107, 90, 107, 106, 91, 92, 108, 107, 92, 93, 109, 92,
+      109, 108, 93, 94, 110, 109, 94, 95, 111, 94, 111, 110,
+      97, 98, 113, 98, 99, 115, 114, 98, 114, 113, 99, 100,
+      115, 100, 101, 117, 116, 100, 116, 115, 101, 102, 117, 102,
+      103, 119, 118, 102, 118, 117, 103, 104, 119, 104, 105, 121,
+      120, 104, 120, 119, 105, 106, 121, 106, 107, 123, 122, 106,
+      122, 121, 107, 108, 123, 108, 109, 125, 124, 108, 124, 123,
+      109, 110, 125, 110, 111, 127, 126, 110, 126, 125, 113, 114,
+      130, 129, 114, 115, 131, 114, 131, 130, 115, 116, 132, 131,
+      116, 117, 133, 116, 133, 132, 117, 118, 134, 133, 118, 119,
+      135, 118, 135, 134, 119, 120, 136, 135, 120, 121, 137, 120,
+      137, 136, 121, 122, 138, 137, 122, 123, 139, 122, 139, 138,
+      123, 124, 140, 139, 124, 125, 141, 124, 141, 140, 125, 126,
+      142, 141, 126, 127, 143, 126, 143, 142, 129, 130, 145, 130,
+      131, 147, 146, 130, 146, 145, 131, 132, 147, 132, 133, 149,
+      148, 132, 148, 147, 133, 134, 149, 134, 135, 151, 150, 134,
+      150, 149, 135, 136, 151, 136, 137, 153, 152, 136, 152, 151,
+      137, 138, 153, 138, 139, 155, 154, 138, 154, 153, 139, 140,
+      155, 140, 141, 157, 156, 140, 156, 155, 141, 142, 157, 142,
+      143, 159, 158, 142, 158, 157, 145, 146, 162, 161, 146, 147,
+      163, 146, 163, 162, 147, 148, 164, 163, 148, 149, 165, 148,
+      165, 164, 149, 150, 166, 165, 150, 151, 167, 150, 167, 166,
+      151, 152, 168, 167, 152, 153, 169, 152, 169, 168, 153, 154,
+      170, 169, 154, 155, 171, 154, 171, 170, 155, 156, 172, 171,
+      156, 157, 173, 156, 173, 172, 157, 158, 174, 173, 158, 159,
+      175, 158, 175, 174, 161, 162, 177, 162, 163, 179, 178, 162,
+      178, 177, 163, 164, 179, 164, 165, 181, 180, 164, 180, 179,
+      165, 166, 181, 166, 167, 183, 182, 166, 182, 181, 167, 168,
+      183, 168, 169, 185, 184, 168, 184, 183, 169, 170, 185, 170,
+      171, 187, 186, 170, 186, 185, 171, 172, 187, 172, 173, 189,
+      188, 172, 188, 187, 173, 174, 189, 174, 175, 191, 190, 174,
+      190, 189, 177, 178, 194, 193, 178, 179, 195, 178, 195, 194,
+      179, 180, 196, 195, 180, 181, 197, 180, 197, 196, 181, 182,
+      198, 197, 182, 183, 199, 182, 199, 198, 183, 184, 200, 199,
+      184, 185, 201, 184, 201, 200, 185, 186, 202, 201, 186, 187,
+      203, 186, 203, 202, 187, 188, 204, 203, 188, 189, 205, 188,
+      205, 204, 189, 190, 206, 205, 190, 191, 207, 190, 207, 206,
+      193, 194, 209, 194, 195, 211, 210, 194, 210, 209, 195, 196,
+      211, 196, 197, 213, 212, 196, 212, 211, 197, 198, 213, 198,
+      199, 215, 214, 198, 214, 213, 199, 200, 215, 200, 201, 217,
+      216, 200, 216, 215, 201, 202, 217, 202, 203, 219, 218, 202,
+      218, 217, 203, 204, 219, 204, 205, 221, 220, 204, 220, 219,
+      205, 206, 221, 206, 207, 223, 222, 206, 222, 221, 209, 210,
+      226, 225, 210, 211, 227, 210, 227, 226, 211, 212, 228, 227,
+      212, 213, 229, 212, 229, 228, 213, 214, 230, 229, 214, 215,
+      231, 214, 231, 230, 215, 216, 232, 231, 216, 217, 233, 216,
+      233, 232, 217, 218, 234, 233, 218, 219, 235, 218, 235, 234,
+      219, 220, 236, 235, 220, 221, 237, 220, 237, 236, 221, 222,
+      238, 237, 222, 223, 239, 222, 239, 238, 225, 226, 241, 226,
+      227, 243, 242, 226, 242, 241, 227, 228, 243, 228, 229, 245,
+      244, 228, 244, 243, 229, 230, 245, 230, 231, 247, 246, 230,
+      246, 245, 231, 232, 247, 232, 233, 249, 248, 232, 248, 247,
+      233, 234, 249, 234, 235, 251, 250, 234, 250, 249, 235, 236,
+      251, 236, 237, 253, 252, 236, 252, 251, 237, 238, 253, 238,
+      239, 255, 254, 238, 254, 253
+   };
+
+   // tilings/semi6_16x16
+   constexpr float m_tilings_semi6_16x16_vertex[] =
+   {
+      0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+      3.7320509f, 0.0f, 0.0f, 4.7320509f, 0.0f, 0.0f,
+      7.46410179f, 0.0f, 0.0f, 8.46410179f, 0.0f, 0.0f,
+      11.1961527f, 0.0f, 0.0f, 12.1961527f, 0.0f, 0.0f,
+      14.9282036f, 0.0f, 0.0f, 15.9282036f, 0.0f, 0.0f,
+      18.6602554f, 0.0f, 0.0f, 19.6602554f, 0.0f, 0.0f,
+      22.3923054f, 0.0f, 0.0f, 23.3923054f, 0.0f, 0.0f,
+      26.1243553f, 0.0f, 0.0f, 27.1243553f, 0.0f, 0.0f,
+      0.5f, 0.866025388f, 0.0f, 1.5f, 0.866025388f, 0.0f,
+      4.2320509f, 0.866025388f, 0.0f, 5.2320509f, 0.866025388f, 0.0f,
+      7.96410179f, 0.866025388f, 0.0f, 8.96410179f, 0.866025388f, 0.0f,
+      11.6961527f, 0.866025388f, 0.0f, 12.6961527f, 0.866025388f, 0.0f,
+      15.4282036f, 0.866025388f, 0.0f, 16.4282036f, 0.866025388f, 0.0f,
+      19.1602554f, 0.866025388f, 0.0f, 20.1602554f, 0.866025388f, 0.0f,
+      22.8923054f, 0.866025388f, 0.0f, 23.8923054f, 0.866025388f, 0.0f,
+      26.6243553f, 0.866025388f, 0.0f, 27.6243553f, 0.866025388f, 0.0f,
+      0.5f, 1.86602545f, 0.0f, 1.5f, 1.86602545f, 0.0f,
+      4.2320509f, 1.86602545f, 0.0f, 5.2320509f, 1.86602545f, 0.0f,
+      7.96410179f, 1.86602545f, 0.0f, 8.96410179f, 1.86602545f, 0.0f,
+      11.6961527f, 1.86602545f, 0.0f, 12.6961527f, 1.86602545f, 0.0f,
+      15.4282036f, 1.86602545f, 0.0f, 16.4282036f, 1.86602545f, 0.0f,
+      19.1602554f, 1.86602545f, 0.0f, 20.1602554f, 1.86602545f, 0.0f,
+      22.8923054f, 1.86602545f, 0.0f, 23.8923054f, 1.86602545f, 0.0f,
+      26.6243553f, 1.86602545f, 0.0f, 27.6243553f, 1.86602545f, 0.0f,
+      0.0f, 2.7320509f, 0.0f, 1.0f, 2.7320509f, 0.0f,
+      3.7320509f, 2.7320509f, 0.0f, 4.7320509f, 2.7320509f, 0.0f,
+      7.46410179f, 2.7320509f, 0.0f, 8.46410179f, 2.7320509f, 0.0f,
+      11.1961527f, 2.7320509f, 0.0f, 12.1961527f, 2.7320509f, 0.0f,
+      14.9282036f, 2.7320509f, 0.0f, 15.9282036f, 2.7320509f, 0.0f,
+      18.6602554f, 2.7320509f, 0.0f, 19.6602554f, 2.7320509f, 0.0f,
+      22.3923054f, 2.7320509f, 0.0f, 23.3923054f, 2.7320509f, 0.0f,
+      26.1243553f, 2.7320509f, 0.0f, 27.1243553f, 2.7320509f, 0.0f,
+      1.86602545f, 3.2320509f, 0.0f, 2.86602545f, 3.2320509f, 0.0f,
+      5.59807634f, 3.2320509f, 0.0f, 6.59807634f, 3.2320509f, 0.0f,
+      9.33012772f, 3.2320509f, 0.0f, 10.3301277f, 3.2320509f, 0.0f,
+      13.0621777f, 3.2320509f, 0.0f, 14.0621777f, 3.2320509f, 0.0f,
+      16.7942295f, 3.2320509f, 0.0f, 17.7942295f, 3.2320509f, 0.0f,
+      20.5262814f, 3.2320509f, 0.0f, 21.5262814f, 3.2320509f, 0.0f,
+      24.2583313f, 3.2320509f, 0.0f, 25.2583313f, 3.2320509f, 0.0f,
+      27.9903812f, 3.2320509f, 0.0f, 28.9903812f, 3.2320509f, 0.0f,
+      2.36602545f, 4.09807634f, 0.0f, 3.36602545f, 4.09807634f, 0.0f,
+      6.09807634f, 4.09807634f, 0.0f, 7.09807634f, 4.09807634f, 0.0f,
+      9.83012772f, 4.09807634f, 0.0f, 10.8301277f, 4.09807634f, 0.0f,
+      13.5621777f, 4.09807634f, 0.0f, 14.5621777f, 4.09807634f, 0.0f,
+      17.2942295f, 4.09807634f, 0.0f, 18.2942295f, 4.09807634f, 0.0f,
+      21.0262814f, 4.09807634f, 0.0f, 22.0262814f, 4.09807634f, 0.0f,
+      24.7583313f, 4.09807634f, 0.0f, 25.7583313f, 4.09807634f, 0.0f,
+      28.4903812f, 4.09807634f, 0.0f, 29.4903812f, 4.09807634f, 0.0f,
+      2.36602545f, 5.09807634f, 0.0f, 3.36602545f, 5.09807634f, 0.0f,
+      6.09807634f, 5.09807634f, 0.0f, 7.09807634f, 5.09807634f, 0.0f,
+      9.83012772f, 5.09807634f, 0.0f, 10.8301277f, 5.09807634f, 0.0f,
+      13.5621777f, 5.09807634f, 0.0f, 14.5621777f, 5.09807634f, 0.0f,
+      17.2942295f, 5.09807634f, 0.0f, 18.2942295f, 5.09807634f, 0.0f,
+      21.0262814f, 5.09807634f, 0.0f, 22.0262814f, 5.09807634f, 0.0f,
+      24.7583313f, 5.09807634f, 0.0f, 25.7583313f, 5.09807634f, 0.0f,
+      28.4903812f, 5.09807634f, 0.0f, 29.4903812f, 5.09807634f, 0.0f,
+      1.86602545f, 5.96410179f, 0.0f, 2.86602545f, 5.96410179f, 0.0f,
+      5.59807634f, 5.96410179f, 0.0f, 6.59807634f, 5.96410179f, 0.0f,
+      9.33012772f, 5.96410179f, 0.0f, 10.3301277f, 5.96410179f, 0.0f,
+      13.0621777f, 5.96410179f, 0.0f, 14.0621777f, 5.96410179f, 0.0f,
+      16.7942295f, 5.96410179f, 0.0f, 17.7942295f, 5.96410179f, 0.0f,
+      20.5262814f, 5.96410179f, 0.0f, 21.5262814f, 5.96410179f, 0.0f,
+      24.2583313f, 5.96410179f, 0.0f, 25.2583313f, 5.96410179f, 0.0f,
+      27.9903812f, 5.96410179f, 0.0f, 28.9903812f, 5.96410179f, 0.0f,
+      3.7320509f, 6.46410179f, 0.0f, 4.7320509f, 6.46410179f, 0.0f,
+      7.46410179f, 6.46410179f, 0.0f, 8.46410179f, 6.46410179f, 0.0f,
+      11.1961527f, 6.46410179f, 0.0f, 12.1961527f, 6.46410179f, 0.0f,
+      14.9282036f, 6.46410179f, 0.0f, 15.9282036f, 6.46410179f, 0.0f,
+      18.6602554f, 6.46410179f, 0.0f, 19.6602554f, 6.46410179f, 0.0f,
+      22.3923073f, 6.46410179f, 0.0f, 23.3923073f, 6.46410179f, 0.0f,
+      26.1243553f, 6.46410179f, 0.0f, 27.1243553f, 6.46410179f, 0.0f,
+      29.8564072f, 6.46410179f, 0.0f, 30.8564072f, 6.46410179f, 0.0f,
+      4.2320509f, 7.33012724f, 0.0f, 5.2320509f, 7.33012724f, 0.0f,
+      7.96410179f, 7.33012724f, 0.0f, 8.96410179f, 7.33012724f, 0.0f,
+      11.6961527f, 7.33012724f, 0.0f, 12.6961527f, 7.33012724f, 0.0f,
+      15.4282036f, 7.33012724f, 0.0f, 16.4282036f, 7.33012724f, 0.0f,
+      19.1602554f, 7.33012724f, 0.0f, 20.1602554f, 7.33012724f, 0.0f,
+      22.8923073f, 7.33012724f, 0.0f, 23.8923073f, 7.33012724f, 0.0f,
+      26.6243553f, 7.33012724f, 0.0f, 27.6243553f, 7.33012724f, 0.0f,
+      30.3564072f, 7.33012724f, 0.0f, 31.3564072f, 7.33012724f, 0.0f,
+      4.2320509f, 8.33012772f, 0.0f, 5.2320509f, 8.33012772f, 0.0f,
+      7.96410179f, 8.33012772f, 0.0f, 8.96410179f, 8.33012772f, 0.0f,
+      11.6961527f, 8.33012772f, 0.0f, 12.6961527f, 8.33012772f, 0.0f,
+      15.4282036f, 8.33012772f, 0.0f, 16.4282036f, 8.33012772f, 0.0f,
+      19.1602554f, 8.33012772f, 0.0f, 20.1602554f, 8.33012772f, 0.0f,
+      22.8923073f, 8.33012772f, 0.0f, 23.8923073f, 8.33012772f, 0.0f,
+      26.6243553f, 8.33012772f, 0.0f, 27.6243553f, 8.33012772f, 0.0f,
+      30.3564072f, 8.33012772f, 0.0f, 31.3564072f, 8.33012772f, 0.0f,
+      3.7320509f, 9.19615269f, 0.0f, 4.7320509f, 9.19615269f, 0.0f,
+      7.46410179f, 9.19615269f, 0.0f, 8.46410179f, 9.19615269f, 0.0f,
+      11.1961527f, 9.19615269f, 0.0f, 12.1961527f, 9.19615269f, 0.0f,
+      14.9282036f, 9.19615269f, 0.0f, 15.9282036f, 9.19615269f, 0.0f,
+      18.6602554f, 9.19615269f, 0.0f, 19.6602554f, 9.19615269f, 0.0f,
+      22.3923073f, 9.19615269f, 0.0f, 23.3923073f, 9.19615269f, 0.0f,
+      26.1243553f, 9.19615269f, 0.0f, 27.1243553f, 9.19615269f, 0.0f,
+      29.8564072f, 9.19615269f, 0.0f, 30.8564072f, 9.19615269f, 0.0f,
+      5.59807634f, 9.69615269f, 0.0f, 6.59807634f, 9.69615269f, 0.0f,
+      9.33012772f, 9.69615269f, 0.0f, 10.3301277f, 9.69615269f, 0.0f,
+      13.0621777f, 9.69615269f, 0.0f, 14.0621777f, 9.69615269f, 0.0f,
+      16.7942295f, 9.69615269f, 0.0f, 17.7942295f, 9.69615269f, 0.0f,
+      20.5262794f, 9.69615269f, 0.0f, 21.5262794f, 9.69615269f, 0.0f,
+      24.2583313f, 9.69615269f, 0.0f, 25.2583313f, 9.69615269f, 0.0f,
+      27.9903812f, 9.69615269f, 0.0f, 28.9903812f, 9.69615269f, 0.0f,
+      31.7224312f, 9.69615269f, 0.0f, 32.7224312f, 9.69615269f, 0.0f,
+      6.09807634f, 10.5621777f, 0.0f, 7.09807634f, 10.5621777f, 0.0f,
+      9.83012772f, 10.5621777f, 0.0f, 10.8301277f, 10.5621777f, 0.0f,
+      13.5621777f, 10.5621777f, 0.0f, 14.5621777f, 10.5621777f, 0.0f,
+      17.2942295f, 10.5621777f, 0.0f, 18.2942295f, 10.5621777f, 0.0f,
+      21.0262794f, 10.5621777f, 0.0f, 22.0262794f, 10.5621777f, 0.0f,
+      24.7583313f, 10.5621777f, 0.0f, 25.7583313f, 10.5621777f, 0.0f,
+      28.4903812f, 10.5621777f, 0.0f, 29.4903812f, 10.5621777f, 0.0f,
+      32.2224312f, 10.5621777f, 0.0f, 33.2224312f, 10.5621777f, 0.0f,
+      6.09807634f, 11.5621777f, 0.0f, 7.09807634f, 11.5621777f, 0.0f,
+      9.83012772f, 11.5621777f, 0.0f, 10.8301277f, 11.5621777f, 0.0f,
+      13.5621777f, 11.5621777f, 0.0f, 14.5621777f, 11.5621777f, 0.0f,
+      17.2942295f, 11.5621777f, 0.0f, 18.2942295f, 11.5621777f, 0.0f,
+      21.0262794f, 11.5621777f, 0.0f, 22.0262794f, 11.5621777f, 0.0f,
+      24.7583313f, 11.5621777f, 0.0f, 25.7583313f, 11.5621777f, 0.0f,
+      28.4903812f, 11.5621777f, 0.0f, 29.4903812f, 11.5621777f, 0.0f,
+      32.2224312f, 11.5621777f, 0.0f, 33.2224312f, 11.5621777f, 0.0f,
+      5.59807634f, 12.4282036f, 0.0f, 6.59807634f, 12.4282036f, 0.0f,
+      9.33012772f, 12.4282036f, 0.0f, 10.3301277f, 12.4282036f, 0.0f,
+      13.0621777f, 12.4282036f, 0.0f, 14.0621777f, 12.4282036f, 0.0f,
+      16.7942295f, 12.4282036f, 0.0f, 17.7942295f, 12.4282036f, 0.0f,
+      20.5262794f, 12.4282036f, 0.0f, 21.5262794f, 12.4282036f, 0.0f,
+      24.2583313f, 12.4282036f, 0.0f, 25.2583313f, 12.4282036f, 0.0f,
+      27.9903812f, 12.4282036f, 0.0f, 28.9903812f, 12.4282036f, 0.0f,
+      31.7224312f, 12.4282036f, 0.0f, 32.7224312f, 12.4282036f, 0.0f
+   };
+   constexpr int m_tilings_semi6_16x16_faceStart[] =
+   {
+      0, 3, 6, 9, 12, 15, 18, 21, 33, 36, 48, 51,
+      63, 66, 78, 81, 93, 96, 108, 111, 123, 126, 129, 132,
+      135, 138, 141, 144, 147, 159, 162, 174, 177, 189, 192, 204,
+      207, 219, 222, 234, 237, 249, 252, 255, 258, 261, 264, 267,
+      270, 273
+   };
+   constexpr int m_tilings_semi6_16x16_faceIndex[] =
+   {
+      32, 49, 48, 34, 51, 50, 36, 53, 52, 38, 55, 54,
+      40, 57, 56, 42, 59, 58, 44, 61, 60, 65, 50, 51,
+      66, 82, 98, 114, 129, 128, 113, 96, 80, 64, 65, 80,
+      67, 52, 53, 68, 84, 100, 116, 131, 130, 115, 98, 82,
+      66, 67, 82, 69, 54, 55, 70, 86, 102, 118, 133, 132,
+      117, 100, 84, 68, 69, 84, 71, 56, 57, 72, 88, 104,
+      120, 135, 134, 119, 102, 86, 70, 71, 86, 73, 58, 59,
+      74, 90, 106, 122, 137, 136, 121, 104, 88, 72, 73, 88,
+      75, 60, 61, 76, 92, 108, 124, 139, 138, 123, 106, 90,
+      74, 75, 90, 77, 62, 63, 78, 94, 110, 126, 141, 140,
+      125, 108, 92, 76, 77, 92, 96, 113, 112, 98, 115, 114,
+      100, 117, 116, 102, 119, 118, 104, 121, 120, 106, 123, 122,
+      108, 125, 124, 129, 114, 115, 130, 146, 162, 178, 193, 192,
+      177, 160, 144, 128, 129, 144, 131, 116, 117, 132, 148, 164,
+      180, 195, 194, 179, 162, 146, 130, 131, 146, 133, 118, 119,
+      134, 150, 166, 182, 197, 196, 181, 164, 148, 132, 133, 148,
+      135, 120, 121, 136, 152, 168, 184, 199, 198, 183, 166, 150,
+      134, 135, 150, 137, 122, 123, 138, 154, 170, 186, 201, 200,
+      185, 168, 152, 136, 137, 152, 139, 124, 125, 140, 156, 172,
+      188, 203, 202, 187, 170, 154, 138, 139, 154, 141, 126, 127,
+      142, 158, 174, 190, 205, 204, 189, 172, 156, 140, 141, 156,
+      160, 177, 176, 162, 179, 178, 164, 181, 180, 166, 183, 182,
+      168, 185, 184, 170, 187, 186, 172, 189, 188
+   };
+
+   // tilings/semi7_16x16
+   constexpr float m_tilings_semi7_16x16_vertex[] =
+   {
+      0.866025388f, -0.5f, 0.0f, 2.59807611f, -0.5f, 0.0f,
+      3.59807634f, -0.5f, 0.0f, 5.33012724f, -0.5f, 0.0f,
+      6.33012724f, -0.5f, 0.0f, 8.06217766f, -0.5f, 0.0f,
+      9.06217766f, -0.5f, 0.0f, 10.7942286f, -0.5f, 0.0f,
+      11.7942286f, -0.5f, 0.0f, 13.5262794f, -0.5f, 0.0f,
+      14.5262794f, -0.5f, 0.0f, 16.2583313f, -0.5f, 0.0f,
+      17.2583313f, -0.5f, 0.0f, 18.9903812f, -0.5f, 0.0f,
+      19.9903812f, -0.5f, 0.0f, 21.7224312f, -0.5f, 0.0f,
+      0.0f, 0.0f, 0.0f, 1.73205078f, 0.0f, 0.0f,
+      2.7320509f, 0.0f, 0.0f, 4.46410179f, 0.0f, 0.0f,
+      5.46410179f, 0.0f, 0.0f, 7.19615269f, 0.0f, 0.0f,
+      8.19615269f, 0.0f, 0.0f, 9.92820358f, 0.0f, 0.0f,
+      10.9282036f, 0.0f, 0.0f, 12.6602545f, 0.0f, 0.0f,
+      13.6602545f, 0.0f, 0.0f, 15.3923054f, 0.0f, 0.0f,
+      16.3923054f, 0.0f, 0.0f, 18.1243553f, 0.0f, 0.0f,
+      19.1243553f, 0.0f, 0.0f, 20.8564053f, 0.0f, 0.0f,
+      0.0f, 1.0f, 0.0f, 1.73205078f, 1.0f, 0.0f,
+      2.7320509f, 1.0f, 0.0f, 4.46410179f, 1.0f, 0.0f,
+      5.46410179f, 1.0f, 0.0f, 7.19615269f, 1.0f, 0.0f,
+      8.19615269f, 1.0f, 0.0f, 9.92820358f, 1.0f, 0.0f,
+      10.9282036f, 1.0f, 0.0f, 12.6602545f, 1.0f, 0.0f,
+      13.6602545f, 1.0f, 0.0f, 15.3923054f, 1.0f, 0.0f,
+      16.3923054f, 1.0f, 0.0f, 18.1243553f, 1.0f, 0.0f,
+      19.1243553f, 1.0f, 0.0f, 20.8564053f, 1.0f, 0.0f,
+      0.866025388f, 1.5f, 0.0f, 2.59807611f, 1.5f, 0.0f,
+      3.59807634f, 1.5f, 0.0f, 5.33012724f, 1.5f, 0.0f,
+      6.33012724f, 1.5f, 0.0f, 8.06217766f, 1.5f, 0.0f,
+      9.06217766f, 1.5f, 0.0f, 10.7942286f, 1.5f, 0.0f,
+      11.7942286f, 1.5f, 0.0f, 13.5262794f, 1.5f, 0.0f,
+      14.5262794f, 1.5f, 0.0f, 16.2583313f, 1.5f, 0.0f,
+      17.2583313f, 1.5f, 0.0f, 18.9903812f, 1.5f, 0.0f,
+      19.9903812f, 1.5f, 0.0f, 21.7224312f, 1.5f, 0.0f,
+      2.2320509f, 1.86602545f, 0.0f, 3.96410179f, 1.86602545f, 0.0f,
+      4.96410179f, 1.86602545f, 0.0f, 6.69615269f, 1.86602545f, 0.0f,
+      7.69615269f, 1.86602545f, 0.0f, 9.42820263f, 1.86602545f, 0.0f,
+      10.4282026f, 1.86602545f, 0.0f, 12.1602545f, 1.86602545f, 0.0f,
+      13.1602545f, 1.86602545f, 0.0f, 14.8923044f, 1.86602545f, 0.0f,
+      15.8923044f, 1.86602545f, 0.0f, 17.6243572f, 1.86602545f, 0.0f,
+      18.6243572f, 1.86602545f, 0.0f, 20.3564072f, 1.86602545f, 0.0f,
+      21.3564072f, 1.86602545f, 0.0f, 23.0884571f, 1.86602545f, 0.0f,
+      1.36602545f, 2.36602545f, 0.0f, 3.09807634f, 2.36602545f, 0.0f,
+      4.09807634f, 2.36602545f, 0.0f, 5.83012724f, 2.36602545f, 0.0f,
+      6.83012724f, 2.36602545f, 0.0f, 8.56217766f, 2.36602545f, 0.0f,
+      9.56217766f, 2.36602545f, 0.0f, 11.2942295f, 2.36602545f, 0.0f,
+      12.2942295f, 2.36602545f, 0.0f, 14.0262794f, 2.36602545f, 0.0f,
+      15.0262794f, 2.36602545f, 0.0f, 16.7583313f, 2.36602545f, 0.0f,
+      17.7583313f, 2.36602545f, 0.0f, 19.4903812f, 2.36602545f, 0.0f,
+      20.4903812f, 2.36602545f, 0.0f, 22.2224312f, 2.36602545f, 0.0f,
+      1.36602545f, 3.36602545f, 0.0f, 3.09807634f, 3.36602545f, 0.0f,
+      4.09807634f, 3.36602545f, 0.0f, 5.83012724f, 3.36602545f, 0.0f,
+      6.83012724f, 3.36602545f, 0.0f, 8.56217766f, 3.36602545f, 0.0f,
+      9.56217766f, 3.36602545f, 0.0f, 11.2942295f, 3.36602545f, 0.0f,
+      12.2942295f, 3.36602545f, 0.0f, 14.0262794f, 3.36602545f, 0.0f,
+      15.0262794f, 3.36602545f, 0.0f, 16.7583313f, 3.36602545f, 0.0f,
+      17.7583313f, 3.36602545f, 0.0f, 19.4903812f, 3.36602545f, 0.0f,
+      20.4903812f, 3.36602545f, 0.0f, 22.2224312f, 3.36602545f, 0.0f,
+      2.2320509f, 3.86602545f, 0.0f, 3.96410179f, 3.86602545f, 0.0f,
+      4.96410179f, 3.86602545f, 0.0f, 6.69615269f, 3.86602545f, 0.0f,
+      7.69615269f, 3.86602545f, 0.0f, 9.42820263f, 3.86602545f, 0.0f,
+      10.4282026f, 3.86602545f, 0.0f, 12.1602545f, 3.86602545f, 0.0f,
+      13.1602545f, 3.86602545f, 0.0f, 14.8923044f, 3.86602545f, 0.0f,
+      15.8923044f, 3.86602545f, 0.0f, 17.6243572f, 3.86602545f, 0.0f,
+      18.6243572f, 3.86602545f, 0.0f, 20.3564072f, 3.86602545f, 0.0f,
+      21.3564072f, 3.86602545f, 0.0f, 23.0884571f, 3.86602545f, 0.0f,
+      3.59807634f, 4.2320509f, 0.0f, 5.33012724f, 4.2320509f, 0.0f,
+      6.33012724f, 4.2320509f, 0.0f, 8.06217766f, 4.2320509f, 0.0f,
+      9.06217766f, 4.2320509f, 0.0f, 10.7942286f, 4.2320509f, 0.0f,
+      11.7942286f, 4.2320509f, 0.0f, 13.5262794f, 4.2320509f, 0.0f,
+      14.5262794f, 4.2320509f, 0.0f, 16.2583313f, 4.2320509f, 0.0f,
+      17.2583313f, 4.2320509f, 0.0f, 18.9903812f, 4.2320509f, 0.0f,
+      19.9903812f, 4.2320509f, 0.0f, 21.7224331f, 4.2320509f, 0.0f,
+      22.7224331f, 4.2320509f, 0.0f, 24.4544811f, 4.2320509f, 0.0f,
+      2.7320509f, 4.7320509f, 0.0f, 4.46410179f, 4.7320509f, 0.0f,
+      5.46410179f, 4.7320509f, 0.0f, 7.19615269f, 4.7320509f, 0.0f,
+      8.19615269f, 4.7320509f, 0.0f, 9.92820358f, 4.7320509f, 0.0f,
+      10.9282036f, 4.7320509f, 0.0f, 12.6602545f, 4.7320509f, 0.0f,
+      13.6602545f, 4.7320509f, 0.0f, 15.3923054f, 4.7320509f, 0.0f,
+      16.3923054f, 4.7320509f, 0.0f, 18.1243553f, 4.7320509f, 0.0f,
+      19.1243553f, 4.7320509f, 0.0f, 20.8564072f, 4.7320509f, 0.0f,
+      21.8564072f, 4.7320509f, 0.0f, 23.5884552f, 4.7320509f, 0.0f,
+      2.7320509f, 5.7320509f, 0.0f, 4.46410179f, 5.7320509f, 0.0f,
+      5.46410179f, 5.7320509f, 0.0f, 7.19615269f, 5.7320509f, 0.0f,
+      8.19615269f, 5.7320509f, 0.0f, 9.92820358f, 5.7320509f, 0.0f,
+      10.9282036f, 5.7320509f, 0.0f, 12.6602545f, 5.7320509f, 0.0f,
+      13.6602545f, 5.7320509f, 0.0f, 15.3923054f, 5.7320509f, 0.0f,
+      16.3923054f, 5.7320509f, 0.0f, 18.1243553f, 5.7320509f, 0.0f,
+      19.1243553f, 5.7320509f, 0.0f, 20.8564072f, 5.7320509f, 0.0f,
+      21.8564072f, 5.7320509f, 0.0f, 23.5884552f, 5.7320509f, 0.0f,
+      3.59807634f, 6.2320509f, 0.0f, 5.33012724f, 6.2320509f, 0.0f,
+      6.33012724f, 6.2320509f, 0.0f, 8.06217766f, 6.2320509f, 0.0f,
+      9.06217766f, 6.2320509f, 0.0f, 10.7942286f, 6.2320509f, 0.0f,
+      11.7942286f, 6.2320509f, 0.0f, 13.5262794f, 6.2320509f, 0.0f,
+      14.5262794f, 6.2320509f, 0.0f, 16.2583313f, 6.2320509f, 0.0f,
+      17.2583313f, 6.2320509f, 0.0f, 18.9903812f, 6.2320509f, 0.0f,
+      19.9903812f, 6.2320509f, 0.0f, 21.7224331f, 6.2320509f, 0.0f,
+      22.7224331f, 6.2320509f, 0.0f, 24.4544811f, 6.2320509f, 0.0f,
+      4.96410179f, 6.59807634f, 0.0f, 6.69615269f, 6.59807634f, 0.0f,
+      7.69615269f, 6.59807634f, 0.0f, 9.42820263f, 6.59807634f, 0.0f,
+      10.4282026f, 6.59807634f, 0.0f, 12.1602545f, 6.59807634f, 0.0f,
+      13.1602545f, 6.59807634f, 0.0f, 14.8923044f, 6.59807634f, 0.0f,
+      15.8923044f, 6.59807634f, 0.0f, 17.6243572f, 6.59807634f, 0.0f,
+      18.6243572f, 6.59807634f, 0.0f, 20.3564072f, 6.59807634f, 0.0f,
+      21.3564072f, 6.59807634f, 0.0f, 23.0884571f, 6.59807634f, 0.0f,
+      24.0884571f, 6.59807634f, 0.0f, 25.820507f, 6.59807634f, 0.0f,
+      4.09807634f, 7.09807634f, 0.0f, 5.83012724f, 7.09807634f, 0.0f,
+      6.83012724f, 7.09807634f, 0.0f, 8.56217766f, 7.09807634f, 0.0f,
+      9.56217766f, 7.09807634f, 0.0f, 11.2942295f, 7.09807634f, 0.0f,
+      12.2942295f, 7.09807634f, 0.0f, 14.0262794f, 7.09807634f, 0.0f,
+      15.0262794f, 7.09807634f, 0.0f, 16.7583313f, 7.09807634f, 0.0f,
+      17.7583313f, 7.09807634f, 0.0f, 19.4903812f, 7.09807634f, 0.0f,
+      20.4903812f, 7.09807634f, 0.0f, 22.2224312f, 7.09807634f, 0.0f,
+      23.2224312f, 7.09807634f, 0.0f, 24.9544811f, 7.09807634f, 0.0f,
+      4.09807634f, 8.09807587f, 0.0f, 5.83012724f, 8.09807587f, 0.0f,
+      6.83012724f, 8.09807587f, 0.0f, 8.56217766f, 8.09807587f, 0.0f,
+      9.56217766f, 8.09807587f, 0.0f, 11.2942295f, 8.09807587f, 0.0f,
+      12.2942295f, 8.09807587f, 0.0f, 14.0262794f, 8.09807587f, 0.0f,
+      15.0262794f, 8.09807587f, 0.0f, 16.7583313f, 8.09807587f, 0.0f,
+      17.7583313f, 8.09807587f, 0.0f, 19.4903812f, 8.09807587f, 0.0f,
+      20.4903812f, 8.09807587f, 0.0f, 22.2224312f, 8.09807587f, 0.0f,
+      23.2224312f, 8.09807587f, 0.0f, 24.9544811f, 8.09807587f, 0.0f,
+      4.96410179f, 8.59807587f, 0.0f, 6.69615269f, 8.59807587f, 0.0f,
+      7.69615269f, 8.59807587f, 0.0f, 9.42820263f, 8.59807587f, 0.0f,
+      10.4282026f, 8.59807587f, 0.0f, 12.1602545f, 8.59807587f, 0.0f,
+      13.1602545f, 8.59807587f, 0.0f, 14.8923044f, 8.59807587f, 0.0f,
+      15.8923044f, 8.59807587f, 0.0f, 17.6243572f, 8.59807587f, 0.0f,
+      18.6243572f, 8.59807587f, 0.0f, 20.3564072f, 8.59807587f, 0.0f,
+      21.3564072f, 8.59807587f, 0.0f, 23.0884571f, 8.59807587f, 0.0f,
+      24.0884571f, 8.59807587f, 0.0f, 25.820507f, 8.59807587f, 0.0f
+   };
+   constexpr int m_tilings_semi7_16x16_faceStart[] =
+   {
+      0, 3, 7, 10, 14, 17, 21, 24, 28, 31, 35, 38,
+      42, 48, 52, 55, 61, 65, 68, 74, 78, 81, 87, 91,
+      94, 100, 104, 107, 113, 117, 120, 124, 128, 132, 136, 140,
+      144, 147, 151, 154, 158, 161, 165, 168, 172, 175, 179, 182,
+      186, 192, 196, 199, 205, 209, 212, 218, 222, 225, 231, 235,
+      238, 244, 248, 251, 257, 261, 264, 268, 272, 276, 280, 284,
+      288, 291, 295, 298, 302, 305, 309, 312, 316, 319, 323, 326,
+      330, 336, 340, 343, 349, 353, 356, 362, 366, 369, 375, 379,
+      382, 388, 392, 395, 401, 405, 408
+   };
+   constexpr int m_tilings_semi7_16x16_faceIndex[] =
+   {
+      33, 34, 64, 35, 66, 82, 50, 35, 36, 66, 37, 68,
+      84, 52, 37, 38, 68, 39, 70, 86, 54, 39, 40, 70,
+      41, 72, 88, 56, 41, 42, 72, 43, 74, 90, 58, 43,
+      44, 74, 45, 76, 92, 60, 66, 83, 99, 114, 98, 82,
+      66, 36, 52, 83, 83, 52, 84, 68, 85, 101, 116, 100,
+      84, 68, 38, 54, 85, 85, 54, 86, 70, 87, 103, 118,
+      102, 86, 70, 40, 56, 87, 87, 56, 88, 72, 89, 105,
+      120, 104, 88, 72, 42, 58, 89, 89, 58, 90, 74, 91,
+      107, 122, 106, 90, 74, 44, 60, 91, 91, 60, 92, 76,
+      93, 109, 124, 108, 92, 76, 46, 62, 93, 93, 62, 94,
+      83, 84, 100, 99, 85, 86, 102, 101, 87, 88, 104, 103,
+      89, 90, 106, 105, 91, 92, 108, 107, 93, 94, 110, 109,
+      97, 98, 128, 99, 130, 146, 114, 99, 100, 130, 101, 132,
+      148, 116, 101, 102, 132, 103, 134, 150, 118, 103, 104, 134,
+      105, 136, 152, 120, 105, 106, 136, 107, 138, 154, 122, 107,
+      108, 138, 109, 140, 156, 124, 130, 147, 163, 178, 162, 146,
+      130, 100, 116, 147, 147, 116, 148, 132, 149, 165, 180, 164,
+      148, 132, 102, 118, 149, 149, 118, 150, 134, 151, 167, 182,
+      166, 150, 134, 104, 120, 151, 151, 120, 152, 136, 153, 169,
+      184, 168, 152, 136, 106, 122, 153, 153, 122, 154, 138, 155,
+      171, 186, 170, 154, 138, 108, 124, 155, 155, 124, 156, 140,
+      157, 173, 188, 172, 156, 140, 110, 126, 157, 157, 126, 158,
+      147, 148, 164, 163, 149, 150, 166, 165, 151, 152, 168, 167,
+      153, 154, 170, 169, 155, 156, 172, 171, 157, 158, 174, 173,
+      161, 162, 192, 163, 194, 210, 178, 163, 164, 194, 165, 196,
+      212, 180, 165, 166, 196, 167, 198, 214, 182, 167, 168, 198,
+      169, 200, 216, 184, 169, 170, 200, 171, 202, 218, 186, 171,
+      172, 202, 173, 204, 220, 188, 194, 211, 227, 242, 226, 210,
+      194, 164, 180, 211, 211, 180, 212, 196, 213, 229, 244, 228,
+      212, 196, 166, 182, 213, 213, 182, 214, 198, 215, 231, 246,
+      230, 214, 198, 168, 184, 215, 215, 184, 216, 200, 217, 233,
+      248, 232, 216, 200, 170, 186, 217, 217, 186, 218, 202, 219,
+      235, 250, 234, 218, 202, 172, 188, 219, 219, 188, 220, 204,
+      221, 237, 252, 236, 220, 204, 174, 190, 221, 221, 190, 222
+   };
+
+   // tilings/semi8_16x16
+   constexpr float m_tilings_semi8_16x16_vertex[] =
+   {
+      0.866025388f, -0.5f, 0.0f, 2.59807611f, -0.5f, 0.0f,
+      3.59807634f, -0.5f, 0.0f, 5.33012724f, -0.5f, 0.0f,
+      9.0621767f, -0.5f, 0.0f, 10.7942276f, -0.5f, 0.0f,
+      11.7942276f, -0.5f, 0.0f, 13.5262785f, -0.5f, 0.0f,
+      17.2583294f, -0.5f, 0.0f, 18.9903793f, -0.5f, 0.0f,
+      19.9903793f, -0.5f, 0.0f, 21.7224312f, -0.5f, 0.0f,
+      25.4544811f, -0.5f, 0.0f, 27.1865311f, -0.5f, 0.0f,
+      28.1865311f, -0.5f, 0.0f, 29.9185829f, -0.5f, 0.0f,
+      0.0f, 0.0f, 0.0f, 1.73205078f, 0.0f, 0.0f,
+      2.7320509f, 0.0f, 0.0f, 4.46410179f, 0.0f, 0.0f,
+      8.19615173f, 0.0f, 0.0f, 9.92820263f, 0.0f, 0.0f,
+      10.9282026f, 0.0f, 0.0f, 12.6602535f, 0.0f, 0.0f,
+      16.3923035f, 0.0f, 0.0f, 18.1243534f, 0.0f, 0.0f,
+      19.1243553f, 0.0f, 0.0f, 20.8564053f, 0.0f, 0.0f,
+      24.5884552f, 0.0f, 0.0f, 26.3205051f, 0.0f, 0.0f,
+      27.320507f, 0.0f, 0.0f, 29.052557f, 0.0f, 0.0f,
+      0.0f, 1.0f, 0.0f, 1.73205078f, 1.0f, 0.0f,
+      2.7320509f, 1.0f, 0.0f, 4.46410179f, 1.0f, 0.0f,
+      8.19615173f, 1.0f, 0.0f, 9.92820263f, 1.0f, 0.0f,
+      10.9282026f, 1.0f, 0.0f, 12.6602535f, 1.0f, 0.0f,
+      16.3923035f, 1.0f, 0.0f, 18.1243534f, 1.0f, 0.0f,
+      19.1243553f, 1.0f, 0.0f, 20.8564053f, 1.0f, 0.0f,
+      24.5884552f, 1.0f, 0.0f, 26.3205051f, 1.0f, 0.0f,
+      27.320507f, 1.0f, 0.0f, 29.052557f, 1.0f, 0.0f,
+      0.866025388f, 1.5f, 0.0f, 2.59807611f, 1.5f, 0.0f,
+      3.59807634f, 1.5f, 0.0f, 5.33012724f, 1.5f, 0.0f,
+      9.0621767f, 1.5f, 0.0f, 10.7942276f, 1.5f, 0.0f,
+      11.7942276f, 1.5f, 0.0f, 13.5262785f, 1.5f, 0.0f,
+      17.2583294f, 1.5f, 0.0f, 18.9903793f, 1.5f, 0.0f,
+      19.9903793f, 1.5f, 0.0f, 21.7224312f, 1.5f, 0.0f,
+      25.4544811f, 1.5f, 0.0f, 27.1865311f, 1.5f, 0.0f,
+      28.1865311f, 1.5f, 0.0f, 29.9185829f, 1.5f, 0.0f,
+      4.96410131f, 1.86602545f, 0.0f, 6.69615221f, 1.86602545f, 0.0f,
+      7.69615221f, 1.86602545f, 0.0f, 9.42820358f, 1.86602545f, 0.0f,
+      13.1602526f, 1.86602545f, 0.0f, 14.8923035f, 1.86602545f, 0.0f,
+      15.8923035f, 1.86602545f, 0.0f, 17.6243553f, 1.86602545f, 0.0f,
+      21.3564053f, 1.86602545f, 0.0f, 23.0884552f, 1.86602545f, 0.0f,
+      24.0884552f, 1.86602545f, 0.0f, 25.820507f, 1.86602545f, 0.0f,
+      29.552557f, 1.86602545f, 0.0f, 31.2846069f, 1.86602545f, 0.0f,
+      32.2846069f, 1.86602545f, 0.0f, 34.0166588f, 1.86602545f, 0.0f,
+      4.09807587f, 2.36602545f, 0.0f, 5.83012676f, 2.36602545f, 0.0f,
+      6.83012676f, 2.36602545f, 0.0f, 8.56217766f, 2.36602545f, 0.0f,
+      12.2942276f, 2.36602545f, 0.0f, 14.0262785f, 2.36602545f, 0.0f,
+      15.0262785f, 2.36602545f, 0.0f, 16.7583294f, 2.36602545f, 0.0f,
+      20.4903793f, 2.36602545f, 0.0f, 22.2224293f, 2.36602545f, 0.0f,
+      23.2224312f, 2.36602545f, 0.0f, 24.9544811f, 2.36602545f, 0.0f,
+      28.6865311f, 2.36602545f, 0.0f, 30.418581f, 2.36602545f, 0.0f,
+      31.4185829f, 2.36602545f, 0.0f, 33.1506348f, 2.36602545f, 0.0f,
+      4.09807587f, 3.36602545f, 0.0f, 5.83012676f, 3.36602545f, 0.0f,
+      6.83012676f, 3.36602545f, 0.0f, 8.56217766f, 3.36602545f, 0.0f,
+      12.2942276f, 3.36602545f, 0.0f, 14.0262785f, 3.36602545f, 0.0f,
+      15.0262785f, 3.36602545f, 0.0f, 16.7583294f, 3.36602545f, 0.0f,
+      20.4903793f, 3.36602545f, 0.0f, 22.2224293f, 3.36602545f, 0.0f,
+      23.2224312f, 3.36602545f, 0.0f, 24.9544811f, 3.36602545f, 0.0f,
+      28.6865311f, 3.36602545f, 0.0f, 30.418581f, 3.36602545f, 0.0f,
+      31.4185829f, 3.36602545f, 0.0f, 33.1506348f, 3.36602545f, 0.0f,
+      4.96410131f, 3.86602545f, 0.0f, 6.69615221f, 3.86602545f, 0.0f,
+      7.69615221f, 3.86602545f, 0.0f, 9.42820358f, 3.86602545f, 0.0f,
+      13.1602526f, 3.86602545f, 0.0f, 14.8923035f, 3.86602545f, 0.0f,
+      15.8923035f, 3.86602545f, 0.0f, 17.6243553f, 3.86602545f, 0.0f,
+      21.3564053f, 3.86602545f, 0.0f, 23.0884552f, 3.86602545f, 0.0f,
+      24.0884552f, 3.86602545f, 0.0f, 25.820507f, 3.86602545f, 0.0f,
+      29.552557f, 3.86602545f, 0.0f, 31.2846069f, 3.86602545f, 0.0f,
+      32.2846069f, 3.86602545f, 0.0f, 34.0166588f, 3.86602545f, 0.0f,
+      9.0621767f, 4.2320509f, 0.0f, 10.7942276f, 4.2320509f, 0.0f,
+      11.7942276f, 4.2320509f, 0.0f, 13.5262785f, 4.2320509f, 0.0f,
+      17.2583294f, 4.2320509f, 0.0f, 18.9903793f, 4.2320509f, 0.0f,
+      19.9903793f, 4.2320509f, 0.0f, 21.7224312f, 4.2320509f, 0.0f,
+      25.4544811f, 4.2320509f, 0.0f, 27.1865311f, 4.2320509f, 0.0f,
+      28.1865311f, 4.2320509f, 0.0f, 29.9185829f, 4.2320509f, 0.0f,
+      33.650631f, 4.2320509f, 0.0f, 35.3826828f, 4.2320509f, 0.0f,
+      36.3826828f, 4.2320509f, 0.0f, 38.1147308f, 4.2320509f, 0.0f,
+      8.19615173f, 4.7320509f, 0.0f, 9.92820263f, 4.7320509f, 0.0f,
+      10.9282026f, 4.7320509f, 0.0f, 12.6602535f, 4.7320509f, 0.0f,
+      16.3923035f, 4.7320509f, 0.0f, 18.1243534f, 4.7320509f, 0.0f,
+      19.1243553f, 4.7320509f, 0.0f, 20.8564053f, 4.7320509f, 0.0f,
+      24.5884552f, 4.7320509f, 0.0f, 26.3205051f, 4.7320509f, 0.0f,
+      27.320507f, 4.7320509f, 0.0f, 29.052557f, 4.7320509f, 0.0f,
+      32.7846069f, 4.7320509f, 0.0f, 34.5166588f, 4.7320509f, 0.0f,
+      35.5166588f, 4.7320509f, 0.0f, 37.2487106f, 4.7320509f, 0.0f,
+      8.19615173f, 5.7320509f, 0.0f, 9.92820263f, 5.7320509f, 0.0f,
+      10.9282026f, 5.7320509f, 0.0f, 12.6602535f, 5.7320509f, 0.0f,
+      16.3923035f, 5.7320509f, 0.0f, 18.1243534f, 5.7320509f, 0.0f,
+      19.1243553f, 5.7320509f, 0.0f, 20.8564053f, 5.7320509f, 0.0f,
+      24.5884552f, 5.7320509f, 0.0f, 26.3205051f, 5.7320509f, 0.0f,
+      27.320507f, 5.7320509f, 0.0f, 29.052557f, 5.7320509f, 0.0f,
+      32.7846069f, 5.7320509f, 0.0f, 34.5166588f, 5.7320509f, 0.0f,
+      35.5166588f, 5.7320509f, 0.0f, 37.2487106f, 5.7320509f, 0.0f,
+      9.0621767f, 6.2320509f, 0.0f, 10.7942276f, 6.2320509f, 0.0f,
+      11.7942276f, 6.2320509f, 0.0f, 13.5262785f, 6.2320509f, 0.0f,
+      17.2583294f, 6.2320509f, 0.0f, 18.9903793f, 6.2320509f, 0.0f,
+      19.9903793f, 6.2320509f, 0.0f, 21.7224312f, 6.2320509f, 0.0f,
+      25.4544811f, 6.2320509f, 0.0f, 27.1865311f, 6.2320509f, 0.0f,
+      28.1865311f, 6.2320509f, 0.0f, 29.9185829f, 6.2320509f, 0.0f,
+      33.650631f, 6.2320509f, 0.0f, 35.3826828f, 6.2320509f, 0.0f,
+      36.3826828f, 6.2320509f, 0.0f, 38.1147308f, 6.2320509f, 0.0f,
+      13.1602526f, 6.59807634f, 0.0f, 14.8923035f, 6.59807634f, 0.0f,
+      15.8923035f, 6.59807634f, 0.0f, 17.6243553f, 6.59807634f, 0.0f,
+      21.3564053f, 6.59807634f, 0.0f, 23.0884552f, 6.59807634f, 0.0f,
+      24.0884552f, 6.59807634f, 0.0f, 25.820507f, 6.59807634f, 0.0f,
+      29.552557f, 6.59807634f, 0.0f, 31.2846069f, 6.59807634f, 0.0f,
+      32.2846069f, 6.59807634f, 0.0f, 34.0166588f, 6.59807634f, 0.0f,
+      37.7487068f, 6.59807634f, 0.0f, 39.4807587f, 6.59807634f, 0.0f,
+      40.4807587f, 6.59807634f, 0.0f, 42.2128067f, 6.59807634f, 0.0f,
+      12.2942276f, 7.09807634f, 0.0f, 14.0262785f, 7.09807634f, 0.0f,
+      15.0262785f, 7.09807634f, 0.0f, 16.7583294f, 7.09807634f, 0.0f,
+      20.4903793f, 7.09807634f, 0.0f, 22.2224293f, 7.09807634f, 0.0f,
+      23.2224312f, 7.09807634f, 0.0f, 24.9544811f, 7.09807634f, 0.0f,
+      28.6865311f, 7.09807634f, 0.0f, 30.418581f, 7.09807634f, 0.0f,
+      31.4185829f, 7.09807634f, 0.0f, 33.1506348f, 7.09807634f, 0.0f,
+      36.8826828f, 7.09807634f, 0.0f, 38.6147346f, 7.09807634f, 0.0f,
+      39.6147346f, 7.09807634f, 0.0f, 41.3467865f, 7.09807634f, 0.0f,
+      12.2942276f, 8.09807587f, 0.0f, 14.0262785f, 8.09807587f, 0.0f,
+      15.0262785f, 8.09807587f, 0.0f, 16.7583294f, 8.09807587f, 0.0f,
+      20.4903793f, 8.09807587f, 0.0f, 22.2224293f, 8.09807587f, 0.0f,
+      23.2224312f, 8.09807587f, 0.0f, 24.9544811f, 8.09807587f, 0.0f,
+      28.6865311f, 8.09807587f, 0.0f, 30.418581f, 8.09807587f, 0.0f,
+      31.4185829f, 8.09807587f, 0.0f, 33.1506348f, 8.09807587f, 0.0f,
+      36.8826828f, 8.09807587f, 0.0f, 38.6147346f, 8.09807587f, 0.0f,
+      39.6147346f, 8.09807587f, 0.0f, 41.3467865f, 8.09807587f, 0.0f,
+      13.1602526f, 8.59807587f, 0.0f, 14.8923035f, 8.59807587f, 0.0f,
+      15.8923035f, 8.59807587f, 0.0f, 17.6243553f, 8.59807587f, 0.0f,
+      21.3564053f, 8.59807587f, 0.0f, 23.0884552f, 8.59807587f, 0.0f,
+      24.0884552f, 8.59807587f, 0.0f, 25.820507f, 8.59807587f, 0.0f,
+      29.552557f, 8.59807587f, 0.0f, 31.2846069f, 8.59807587f, 0.0f,
+      32.2846069f, 8.59807587f, 0.0f, 34.0166588f, 8.59807587f, 0.0f,
+      37.7487068f, 8.59807587f, 0.0f, 39.4807587f, 8.59807587f, 0.0f,
+      40.4807587f, 8.59807587f, 0.0f, 42.2128067f, 8.59807587f, 0.0f
+   };
+   constexpr int m_tilings_semi8_16x16_faceStart[] =
+   {
+      0, 6, 12, 18, 24, 30, 42, 46, 58, 62, 74, 78,
+      82, 86, 90, 94, 98, 104, 110, 116, 122, 128, 140, 144,
+      156, 160, 172, 176, 180, 184, 188, 192, 196
+   };
+   constexpr int m_tilings_semi8_16x16_faceIndex[] =
+   {
+      68, 85, 101, 116, 100, 84, 70, 87, 103, 118, 102, 86,
+      72, 89, 105, 120, 104, 88, 74, 91, 107, 122, 106, 90,
+      76, 93, 109, 124, 108, 92, 83, 52, 37, 38, 54, 84,
+      100, 130, 146, 145, 128, 99, 85, 86, 102, 101, 87, 56,
+      41, 42, 58, 88, 104, 134, 150, 149, 132, 103, 89, 90,
+      106, 105, 91, 60, 45, 46, 62, 92, 108, 138, 154, 153,
+      136, 107, 99, 128, 144, 114, 116, 147, 130, 100, 103, 132,
+      148, 118, 120, 151, 134, 104, 107, 136, 152, 122, 124, 155,
+      138, 108, 132, 149, 165, 180, 164, 148, 134, 151, 167, 182,
+      166, 150, 136, 153, 169, 184, 168, 152, 138, 155, 171, 186,
+      170, 154, 140, 157, 173, 188, 172, 156, 147, 116, 101, 102,
+      118, 148, 164, 194, 210, 209, 192, 163, 149, 150, 166, 165,
+      151, 120, 105, 106, 122, 152, 168, 198, 214, 213, 196, 167,
+      153, 154, 170, 169, 155, 124, 109, 110, 126, 156, 172, 202,
+      218, 217, 200, 171, 163, 192, 208, 178, 180, 211, 194, 164,
+      167, 196, 212, 182, 184, 215, 198, 168, 171, 200, 216, 186,
+      188, 219, 202, 172
+   };
+}
+
+constexpr Fixture all[] =
+{
+   { "cube_soup.obj",
+     sizeof(data::m_cube_soup_obj_vertex)/sizeof(float)/3,
+     sizeof(data::m_cube_soup_obj_faceStart)/sizeof(int)-1,
+     data::m_cube_soup_obj_vertex, data::m_cube_soup_obj_faceStart, data::m_cube_soup_obj_faceIndex },
+   { "grid_holes.obj",
+     sizeof(data::m_grid_holes_obj_vertex)/sizeof(float)/3,
+     sizeof(data::m_grid_holes_obj_faceStart)/sizeof(int)-1,
+     data::m_grid_holes_obj_vertex, data::m_grid_holes_obj_faceStart, data::m_grid_holes_obj_faceIndex },
+   { "narrow_triangles.obj",
+     sizeof(data::m_narrow_triangles_obj_vertex)/sizeof(float)/3,
+     sizeof(data::m_narrow_triangles_obj_faceStart)/sizeof(int)-1,
+     data::m_narrow_triangles_obj_vertex, data::m_narrow_triangles_obj_faceStart, data::m_narrow_triangles_obj_faceIndex },
+   { "non_convex_quad.obj",
+     sizeof(data::m_non_convex_quad_obj_vertex)/sizeof(float)/3,
+     sizeof(data::m_non_convex_quad_obj_faceStart)/sizeof(int)-1,
+     data::m_non_convex_quad_obj_vertex, data::m_non_convex_quad_obj_faceStart, data::m_non_convex_quad_obj_faceIndex },
+   { "plate_crash.obj",
+     sizeof(data::m_plate_crash_obj_vertex)/sizeof(float)/3,
+     sizeof(data::m_plate_crash_obj_faceStart)/sizeof(int)-1,
+     data::m_plate_crash_obj_vertex, data::m_plate_crash_obj_faceStart, data::m_plate_crash_obj_faceIndex },
+   { "poly/L-plane.obj",
+     sizeof(data::m_poly_L_plane_obj_vertex)/sizeof(float)/3,
+     sizeof(data::m_poly_L_plane_obj_faceStart)/sizeof(int)-1,
+     data::m_poly_L_plane_obj_vertex, data::m_poly_L_plane_obj_faceStart, data::m_poly_L_plane_obj_faceIndex },
+   { "poly/mixedFaringPart.obj",
+     sizeof(data::m_poly_mixedFaringPart_obj_vertex)/sizeof(float)/3,
+     sizeof(data::m_poly_mixedFaringPart_obj_faceStart)/sizeof(int)-1,
+     data::m_poly_mixedFaringPart_obj_vertex, data::m_poly_mixedFaringPart_obj_faceStart, data::m_poly_mixedFaringPart_obj_faceIndex },
+   { "poly/tetris.obj",
+     sizeof(data::m_poly_tetris_obj_vertex)/sizeof(float)/3,
+     sizeof(data::m_poly_tetris_obj_faceStart)/sizeof(int)-1,
+     data::m_poly_tetris_obj_vertex, data::m_poly_tetris_obj_faceStart, data::m_poly_tetris_obj_faceIndex },
+   { "poly/tetris_2.obj",
+     sizeof(data::m_poly_tetris_2_obj_vertex)/sizeof(float)/3,
+     sizeof(data::m_poly_tetris_2_obj_faceStart)/sizeof(int)-1,
+     data::m_poly_tetris_2_obj_vertex, data::m_poly_tetris_2_obj_faceStart, data::m_poly_tetris_2_obj_faceIndex },
+   { "simple/cube.obj",
+     sizeof(data::m_simple_cube_obj_vertex)/sizeof(float)/3,
+     sizeof(data::m_simple_cube_obj_faceStart)/sizeof(int)-1,
+     data::m_simple_cube_obj_vertex, data::m_simple_cube_obj_faceStart, data::m_simple_cube_obj_faceIndex },
+   { "simple/edge1-tri.obj",
+     sizeof(data::m_simple_edge1_tri_obj_vertex)/sizeof(float)/3,
+     sizeof(data::m_simple_edge1_tri_obj_faceStart)/sizeof(int)-1,
+     data::m_simple_edge1_tri_obj_vertex, data::m_simple_edge1_tri_obj_faceStart, data::m_simple_edge1_tri_obj_faceIndex },
+   { "simple/edge2-tri.obj",
+     sizeof(data::m_simple_edge2_tri_obj_vertex)/sizeof(float)/3,
+     sizeof(data::m_simple_edge2_tri_obj_faceStart)/sizeof(int)-1,
+     data::m_simple_edge2_tri_obj_vertex, data::m_simple_edge2_tri_obj_faceStart, data::m_simple_edge2_tri_obj_faceIndex },
+   { "simple/octahedron.obj",
+     sizeof(data::m_simple_octahedron_obj_vertex)/sizeof(float)/3,
+     sizeof(data::m_simple_octahedron_obj_faceStart)/sizeof(int)-1,
+     data::m_simple_octahedron_obj_vertex, data::m_simple_octahedron_obj_faceStart, data::m_simple_octahedron_obj_faceIndex },
+   { "simple/plane-tri.obj",
+     sizeof(data::m_simple_plane_tri_obj_vertex)/sizeof(float)/3,
+     sizeof(data::m_simple_plane_tri_obj_faceStart)/sizeof(int)-1,
+     data::m_simple_plane_tri_obj_vertex, data::m_simple_plane_tri_obj_faceStart, data::m_simple_plane_tri_obj_faceIndex },
+   { "simple/quad_meshes/cube.obj",
+     sizeof(data::m_simple_quad_meshes_cube_obj_vertex)/sizeof(float)/3,
+     sizeof(data::m_simple_quad_meshes_cube_obj_faceStart)/sizeof(int)-1,
+     data::m_simple_quad_meshes_cube_obj_vertex, data::m_simple_quad_meshes_cube_obj_faceStart, data::m_simple_quad_meshes_cube_obj_faceIndex },
+   { "simple/rcube-half-tri.obj",
+     sizeof(data::m_simple_rcube_half_tri_obj_vertex)/sizeof(float)/3,
+     sizeof(data::m_simple_rcube_half_tri_obj_faceStart)/sizeof(int)-1,
+     data::m_simple_rcube_half_tri_obj_vertex, data::m_simple_rcube_half_tri_obj_faceStart, data::m_simple_rcube_half_tri_obj_faceIndex },
+   { "square.obj",
+     sizeof(data::m_square_obj_vertex)/sizeof(float)/3,
+     sizeof(data::m_square_obj_faceStart)/sizeof(int)-1,
+     data::m_square_obj_vertex, data::m_square_obj_faceStart, data::m_square_obj_faceIndex },
+   { "table_top.obj",
+     sizeof(data::m_table_top_obj_vertex)/sizeof(float)/3,
+     sizeof(data::m_table_top_obj_faceStart)/sizeof(int)-1,
+     data::m_table_top_obj_vertex, data::m_table_top_obj_faceStart, data::m_table_top_obj_faceIndex },
+   { "tilings/square_16x16",
+     sizeof(data::m_tilings_square_16x16_vertex)/sizeof(float)/3,
+     sizeof(data::m_tilings_square_16x16_faceStart)/sizeof(int)-1,
+     data::m_tilings_square_16x16_vertex, data::m_tilings_square_16x16_faceStart, data::m_tilings_square_16x16_faceIndex },
+   { "tilings/triangle_16x16",
+     sizeof(data::m_tilings_triangle_16x16_vertex)/sizeof(float)/3,
+     sizeof(data::m_tilings_triangle_16x16_faceStart)/sizeof(int)-1,
+     data::m_tilings_triangle_16x16_vertex, data::m_tilings_triangle_16x16_faceStart, data::m_tilings_triangle_16x16_faceIndex },
+   { "tilings/hexagon_16x16",
+     sizeof(data::m_tilings_hexagon_16x16_vertex)/sizeof(float)/3,
+     sizeof(data::m_tilings_hexagon_16x16_faceStart)/sizeof(int)-1,
+     data::m_tilings_hexagon_16x16_vertex, data::m_tilings_hexagon_16x16_faceStart, data::m_tilings_hexagon_16x16_faceIndex },
+   { "tilings/semi1_16x16",
+     sizeof(data::m_tilings_semi1_16x16_vertex)/sizeof(float)/3,
+     sizeof(data::m_tilings_semi1_16x16_faceStart)/sizeof(int)-1,
+     data::m_tilings_semi1_16x16_vertex, data::m_tilings_semi1_16x16_faceStart, data::m_tilings_semi1_16x16_faceIndex },
+   { "tilings/semi2_16x16",
+     sizeof(data::m_tilings_semi2_16x16_vertex)/sizeof(float)/3,
+     sizeof(data::m_tilings_semi2_16x16_faceStart)/sizeof(int)-1,
+     data::m_tilings_semi2_16x16_vertex, data::m_tilings_semi2_16x16_faceStart, data::m_tilings_semi2_16x16_faceIndex },
+   { "tilings/semi3_16x16",
+     sizeof(data::m_tilings_semi3_16x16_vertex)/sizeof(float)/3,
+     sizeof(data::m_tilings_semi3_16x16_faceStart)/sizeof(int)-1,
+     data::m_tilings_semi3_16x16_vertex, data::m_tilings_semi3_16x16_faceStart, data::m_tilings_semi3_16x16_faceIndex },
+   { "tilings/semi4_16x16",
+     sizeof(data::m_tilings_semi4_16x16_vertex)/sizeof(float)/3,
+     sizeof(data::m_tilings_semi4_16x16_faceStart)/sizeof(int)-1,
+     data::m_tilings_semi4_16x16_vertex, data::m_tilings_semi4_16x16_faceStart, data::m_tilings_semi4_16x16_faceIndex },
+   { "tilings/semi5_16x16",
+     sizeof(data::m_tilings_semi5_16x16_vertex)/sizeof(float)/3,
+     sizeof(data::m_tilings_semi5_16x16_faceStart)/sizeof(int)-1,
+     data::m_tilings_semi5_16x16_vertex, data::m_tilings_semi5_16x16_faceStart, data::m_tilings_semi5_16x16_faceIndex },
+   { "tilings/semi6_16x16",
+     sizeof(data::m_tilings_semi6_16x16_vertex)/sizeof(float)/3,
+     sizeof(data::m_tilings_semi6_16x16_faceStart)/sizeof(int)-1,
+     data::m_tilings_semi6_16x16_vertex, data::m_tilings_semi6_16x16_faceStart, data::m_tilings_semi6_16x16_faceIndex },
+   { "tilings/semi7_16x16",
+     sizeof(data::m_tilings_semi7_16x16_vertex)/sizeof(float)/3,
+     sizeof(data::m_tilings_semi7_16x16_faceStart)/sizeof(int)-1,
+     data::m_tilings_semi7_16x16_vertex, data::m_tilings_semi7_16x16_faceStart, data::m_tilings_semi7_16x16_faceIndex },
+   { "tilings/semi8_16x16",
+     sizeof(data::m_tilings_semi8_16x16_vertex)/sizeof(float)/3,
+     sizeof(data::m_tilings_semi8_16x16_faceStart)/sizeof(int)-1,
+     data::m_tilings_semi8_16x16_vertex, data::m_tilings_semi8_16x16_faceStart, data::m_tilings_semi8_16x16_faceIndex }
+};
+
+constexpr int count = sizeof(all)/sizeof(all[0]);
+
+constexpr bool sameName( const char* a, const char* b )
+{
+   return *a == *b && ( *a == '\0' || sameName( a+1, b+1 ));
+}
+
+// the fixture with the given name, or nullptr if there is none
+constexpr const Fixture* find( const char* name, int i = 0 )
+{
+   return i == count                    ? nullptr :
+          sameName( all[i].name, name ) ? &all[i]  :
+                                          find( name, i+1 );
+}
+
+}
+
+#endif
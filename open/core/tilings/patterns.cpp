@@ -0,0 +1,841 @@
+////////////////////////////////////////////////////////////////////////////////
+// patterns.cpp - Keenan Crane (kcrane@uiuc.edu)
+//
+// DESCRIPTION: the regular and semi-regular tilings themselves; see tiling.h.
+//              Each generator lays out a rows x cols lattice of vertices and
+//              then walks it, emitting the faces of the pattern.
+//
+// LICENSE:
+//    As the sole author of this code I hereby release it into the public
+//    domain.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tiling.h"
+
+#include <iostream>
+#include <string>
+#include <math.h>
+#include <string.h>
+
+using namespace std;
+
+const char* tileClassNames[] =
+{
+   "triangle", "square", "hexagon", "octagon", "dodecagon"
+};
+
+// =============================================================================
+// =============================================================================
+bool generatePattern( string    patternName,
+                      int       rows,
+                      int       cols,
+                      Mesh&     mesh )
+{
+   if( (long long) rows * cols > MAX_TILING_SIZE )
+   {
+      cerr << "Error: tiling is too large ( " << rows << " x " << cols << " )" << endl;
+      return false;
+   }
+
+   // the triangle lattice is the densest pattern, with two faces and six
+   // corners per vertex; reserving untouched memory costs nothing, while
+   // regrowing large arrays does
+   size_t size = (size_t) rows * cols;
+
+   mesh.vertex.reserve( 3*size );
+   mesh.faceStart.reserve( 2*size+1 );
+   mesh.faceIndex.reserve( 6*size );
+   if( mesh.channels & CHANNEL_UV     ) mesh.uv.reserve( 2*size );
+   if( mesh.channels & CHANNEL_NORMAL ) mesh.normal.reserve( 3*size );
+
+   if( patternName == "square"   ) {   square( rows, cols, mesh ); return true; }
+   if( patternName == "triangle" ) { triangle( rows, cols, mesh ); return true; }
+   if( patternName == "hexagon"  ) {  hexagon( rows, cols, mesh ); return true; }
+   if( patternName == "semi1"    ) {    semi1( rows, cols, mesh ); return true; }
+   if( patternName == "semi2"    ) {    semi2( rows, cols, mesh ); return true; }
+   if( patternName == "semi3"    ) {    semi3( rows, cols, mesh ); return true; }
+   if( patternName == "semi4"    ) {    semi4( rows, cols, mesh ); return true; }
+   if( patternName == "semi5"    ) {    semi5( rows, cols, mesh ); return true; }
+   if( patternName == "semi6"    ) {    semi6( rows, cols, mesh ); return true; }
+   if( patternName == "semi7"    ) {    semi7( rows, cols, mesh ); return true; }
+   if( patternName == "semi8"    ) {    semi8( rows, cols, mesh ); return true; }
+
+   cerr << "Error: unknown pattern." << endl;
+   return false;
+}
+
+// =============================================================================
+// =============================================================================
+void addVertex( Mesh& mesh,
+                float px,
+                float py )
+{
+   mesh.vertex.push_back( px );
+   mesh.vertex.push_back( py );
+   mesh.vertex.push_back( 0.0f );
+
+   if( mesh.channels & CHANNEL_UV )
+   {
+      mesh.uv.push_back( px );
+      mesh.uv.push_back( py );
+   }
+
+   if( mesh.channels & CHANNEL_NORMAL )
+   {
+      mesh.normal.push_back( 0.0f );
+      mesh.normal.push_back( 0.0f );
+      mesh.normal.push_back( 1.0f );
+   }
+}
+
+// =============================================================================
+// =============================================================================
+void addFace( Mesh&                 mesh,
+              TileClass             tileClass,
+              initializer_list<int> indices )
+{
+   mesh.faceIndex.insert( mesh.faceIndex.end(), indices.begin(), indices.end() );
+   mesh.faceStart.push_back( (int) mesh.faceIndex.size() );
+
+   if( mesh.channels & CHANNEL_CLASS )
+   {
+      mesh.faceClass.push_back( (unsigned char) tileClass );
+   }
+}
+
+// =============================================================================
+// =============================================================================
+static size_t padded( size_t bytes )
+{
+   return (bytes + 3) & ~(size_t) 3;
+}
+
+size_t binarySize( const Mesh& mesh )
+{
+   return sizeof(BinaryHeader) +
+          sizeof(float) * ( mesh.vertex.size() + mesh.uv.size() + mesh.normal.size() ) +
+          sizeof(int)   * ( mesh.faceStart.size() + mesh.faceIndex.size() ) +
+          padded( mesh.faceClass.size() );
+}
+
+// =============================================================================
+// =============================================================================
+// packBinary() writes binarySize(mesh) bytes to out, which must be aligned
+// for floats and ints; see BinaryHeader for the layout.
+void packBinary( const Mesh& mesh,
+                 char*       out )
+{
+   BinaryHeader header;
+   memset( &header, 0, sizeof(header) );
+
+   header.magic     = BINARY_MAGIC;
+   header.version   = BINARY_VERSION;
+   header.channels  = mesh.channels;
+   header.nVertices = mesh.vertex.size() / 3;
+   header.nFaces    = mesh.faceStart.size() - 1;
+   header.nIndices  = mesh.faceIndex.size();
+
+   memcpy( out, &header, sizeof(header) );
+   out += sizeof(header);
+
+   const void* block[] = { mesh.vertex.data(), mesh.uv.data(), mesh.normal.data(),
+                           mesh.faceStart.data(), mesh.faceIndex.data(),
+                           mesh.faceClass.data() };
+   size_t      bytes[] = { sizeof(float) * mesh.vertex.size(),
+                           sizeof(float) * mesh.uv.size(),
+                           sizeof(float) * mesh.normal.size(),
+                           sizeof(int)   * mesh.faceStart.size(),
+                           sizeof(int)   * mesh.faceIndex.size(),
+                           mesh.faceClass.size() };
+
+   for( int b=0; b<6; b++ )
+   {
+      if( bytes[b] > 0 )
+      {
+         memcpy( out, block[b], bytes[b] );
+      }
+      out += bytes[b];
+   }
+
+   memset( out, 0, padded( mesh.faceClass.size() ) - mesh.faceClass.size() );
+}
+
+// =============================================================================
+// =============================================================================
+void square( int       rows,
+             int       cols,
+             Mesh&     mesh )
+{
+   // generate vertices ----------------------------------------------
+   float px, py;
+
+   for( int y=0; y<rows; y++ )
+   {
+      for( int x=0; x<cols; x++ )
+      {
+         px = x;
+         py = y;
+
+         addVertex( mesh, px, py );
+      }
+   }
+
+   // generate faces -------------------------------------------------
+   for( int y=0; y<rows-1; y++ )
+   {
+      for( int x=0; x<cols-1; x++ )
+      {
+         addFace( mesh, TILE_SQUARE, { (x+0)+(y+0)*cols,
+                                       (x+1)+(y+0)*cols,
+                                       (x+1)+(y+1)*cols,
+                                       (x+0)+(y+1)*cols } );
+      }
+   }
+}
+
+// =============================================================================
+// =============================================================================
+void triangle( int       rows,
+               int       cols,
+               Mesh&     mesh )
+{
+   // generate vertices ----------------------------------------------
+   float px, py;
+
+   for( int y=0; y<rows; y++ )
+   {
+      for( int x=0; x<cols; x++ )
+      {
+         px = x + 0.5f*y;
+         py = y * sqrtf(3.0f)/2.0f;
+
+         addVertex( mesh, px, py );
+      }
+   }
+
+   // generate faces -------------------------------------------------
+   for( int y=0; y<rows-1; y++ )
+   {
+      for( int x=0; x<cols-1; x++ )
+      {
+         addFace( mesh, TILE_TRIANGLE, { (x+0)+(y+0)*cols,
+                                         (x+1)+(y+0)*cols,
+                                         (x+0)+(y+1)*cols } );
+
+         addFace( mesh, TILE_TRIANGLE, { (x+1)+(y+0)*cols,
+                                         (x+1)+(y+1)*cols,
+                                         (x+0)+(y+1)*cols } );
+      }
+   }
+}
+
+// =============================================================================
+// =============================================================================
+void hexagon( int       rows,
+              int       cols,
+              Mesh&     mesh )
+{
+   // generate vertices ----------------------------------------------
+   float px, py;
+
+   for( int y=0; y<rows; y++ )
+   {
+      for( int x=0; x<cols; x++ )
+      {
+         px = floorf((x+(y%2))/2.0f)*3.0f + ((x+y)%2) - (y%2)*1.5f;
+         py = y * sqrtf(3.0f)/2.0f;
+
+         addVertex( mesh, px, py );
+      }
+   }
+
+   // generate faces -------------------------------------------------
+   for( int y=0; y<rows-2; y++ )
+   {
+      for( int x=0; x<cols-1; x++ )
+      {
+         if(( y%2 == 0 && x%2 == 0 ) ||
+            ( y%2 == 1 && x%2 == 1 ))
+         {
+            addFace( mesh, TILE_HEXAGON, { (x+0)+(y+0)*cols,
+                                           (x+1)+(y+0)*cols,
+                                           (x+1)+(y+1)*cols,
+                                           (x+1)+(y+2)*cols,
+                                           (x+0)+(y+2)*cols,
+                                           (x+0)+(y+1)*cols } );
+         }
+      }
+   }
+}
+
+// =============================================================================
+// =============================================================================
+void semi1( int       rows,
+            int       cols,
+            Mesh&     mesh )
+{
+   // generate vertices ----------------------------------------------
+   float px, py;
+
+   for( int y=0; y<rows; y++ )
+   {
+      for( int x=0; x<cols; x++ )
+      {
+         px = x + 0.5f*y;
+         py = y * sqrtf(3.0f)/2.0f;
+
+         addVertex( mesh, px, py );
+      }
+   }
+
+   // generate faces -------------------------------------------------
+   for( int y=1; y<rows-1; y++ )
+   {
+      for( int x=1; x<cols-1; x++ )
+      {
+         int i = (x+3*y)%7;
+
+         if( i == 0 ||
+             i == 2 ||
+             i >= 5 )
+         {
+            addFace( mesh, TILE_TRIANGLE, { (x+0)+(y+0)*cols,
+                                            (x+1)+(y+0)*cols,
+                                            (x+0)+(y+1)*cols } );
+         }
+
+         if( i == 2 ||
+             i >= 4 )
+         {
+            addFace( mesh, TILE_TRIANGLE, { (x+1)+(y+0)*cols,
+                                            (x+1)+(y+1)*cols,
+                                            (x+0)+(y+1)*cols } );
+         }
+
+         if( i == 4 )
+         {
+            addFace( mesh, TILE_HEXAGON, { (x+1)+(y+0)*cols,
+                                           (x+0)+(y+1)*cols,
+                                           (x-1)+(y+1)*cols,
+                                           (x-1)+(y+0)*cols,
+                                           (x+0)+(y-1)*cols,
+                                           (x+1)+(y-1)*cols } );
+         }
+      }
+   }
+}
+
+// =============================================================================
+// =============================================================================
+void semi2( int       rows,
+            int       cols,
+            Mesh&     mesh )
+{
+   // generate vertices ----------------------------------------------
+   float px, py;
+
+   for( int y=0; y<rows; y++ )
+   {
+      for( int x=0; x<cols; x++ )
+      {
+         px = floorf(x/2.0f)*(2.0f+sqrtf(2.0f)) + (x%2) +
+              floorf(y/2.0f)*(1.0f+sqrtf(2.0f)/2.0f);
+         py = floorf(y/2.0f)*(1.0f+sqrtf(2.0f)/2.0f) + (y%2);
+
+         addVertex( mesh, px, py );
+      }
+   }
+
+   // generate faces -------------------------------------------------
+   for( int y=1; y<rows-2; y++ )
+   {
+      for( int x=1; x<cols-2; x++ )
+      {
+         if( x%2 == 1 && y%2 == 0 )
+         {
+            addFace( mesh, TILE_OCTAGON, { (x+0)+(y+0)*cols,
+                                           (x+1)+(y-1)*cols,
+                                           (x+2)+(y-1)*cols,
+                                           (x+1)+(y+0)*cols,
+                                           (x+1)+(y+1)*cols,
+                                           (x+0)+(y+2)*cols,
+                                           (x-1)+(y+2)*cols,
+                                           (x+0)+(y+1)*cols } );
+         }
+      }
+   }
+   
+   for( int y=0; y<rows-1; y++ )
+   {
+      for( int x=0; x<cols-1; x++ )
+      {
+         if( x%2 == 0 && y%2 == 0 )
+         {
+            addFace( mesh, TILE_SQUARE, { (x+0)+(y+0)*cols,
+                                          (x+1)+(y+0)*cols,
+                                          (x+1)+(y+1)*cols,
+                                          (x+0)+(y+1)*cols } );
+         }
+      }
+   }
+}
+
+// =============================================================================
+// =============================================================================
+void semi3( int       rows,
+            int       cols,
+            Mesh&     mesh )
+{
+   // generate vertices ----------------------------------------------
+   float px, py;
+
+   for( int y=0; y<rows; y++ )
+   {
+      for( int x=0; x<cols; x++ )
+      {
+         px = x + floorf(y/2.0f)*0.5f;
+         py = floorf(y/2.0f)*(1.0f+sqrtf(3.0f)/2.0f) + (y%2);
+
+         addVertex( mesh, px, py );
+      }
+   }
+
+   // generate faces -------------------------------------------------
+   for( int y=0; y<rows-1; y++ )
+   {
+      for( int x=0; x<cols-1; x++ )
+      {
+         if( y%2 == 0 )
+         {
+            addFace( mesh, TILE_SQUARE, { (x+0)+(y+0)*cols,
+                                          (x+1)+(y+0)*cols,
+                                          (x+1)+(y+1)*cols,
+                                          (x+0)+(y+1)*cols } );
+         }
+         else
+         {
+            addFace( mesh, TILE_TRIANGLE, { (x+0)+(y+0)*cols,
+                                            (x+1)+(y+0)*cols,
+                                            (x+0)+(y+1)*cols } );
+            addFace( mesh, TILE_TRIANGLE, { (x+1)+(y+0)*cols,
+                                            (x+1)+(y+1)*cols,
+                                            (x+0)+(y+1)*cols } );
+         }
+      }
+   }
+}
+
+// =============================================================================
+// =============================================================================
+void semi4( int       rows,
+            int       cols,
+            Mesh&     mesh )
+{
+   // generate vertices ----------------------------------------------
+   float px, py;
+
+   for( int y=0; y<rows; y++ )
+   {
+      for( int x=0; x<cols; x++ )
+      {
+         px = x+0.5f*y;
+         py = y*sqrtf(3.0f)/2.0f;
+
+         addVertex( mesh, px, py );
+      }
+   }
+
+
+   // generate faces -------------------------------------------------
+   for( int y=0; y<rows-2; y++ )
+   {
+      for( int x=1; x<cols-1; x++ )
+      {
+         if( x%2 == 0 && y%2 == 0 )
+         {
+            addFace( mesh, TILE_TRIANGLE, { (x+0)+(y+0)*cols,
+                                            (x+1)+(y+0)*cols,
+                                            (x+0)+(y+1)*cols } );
+         }
+
+         if( x%2 == 0 && y%2 == 1 )
+         {
+            addFace( mesh, TILE_TRIANGLE, { (x+0)+(y+0)*cols,
+                                            (x+0)+(y+1)*cols,
+                                            (x-1)+(y+1)*cols } );
+         }
+
+         if( x%2 == 1 && y%2 == 0 )
+         {
+            addFace( mesh, TILE_HEXAGON, { (x+0)+(y+0)*cols,
+                                           (x+1)+(y+0)*cols,
+                                           (x+1)+(y+1)*cols,
+                                           (x+0)+(y+2)*cols,
+                                           (x-1)+(y+2)*cols,
+                                           (x-1)+(y+1)*cols } );
+         }
+      }
+   }
+}
+
+// =============================================================================
+// =============================================================================
+void semi5( int       rows,
+            int       cols,
+            Mesh&     mesh )
+{
+   // generate vertices ----------------------------------------------
+   float px, py;
+
+   for( int y=0; y<rows; y++ )
+   {
+      for( int x=0; x<cols; x++ )
+      {
+         px = floorf(x/2.0f)*(1.0f+sqrtf(3.0f)/2.0f) + (x%2) -
+              floorf(y/2.0f)*0.5f;
+         py = floorf(y/2.0f)*(1.0f+sqrtf(3.0f)/2.0f) + (y%2) +
+              floorf(x/2.0f)*0.5f;
+
+         addVertex( mesh, px, py );
+      }
+   }
+
+   // generate faces -------------------------------------------------
+   for( int y=0; y<rows-1; y++ )
+   {
+      for( int x=1; x<cols-1; x++ )
+      {
+         if( x%2 == 0 && y%2 == 0 )
+         {
+            addFace( mesh, TILE_SQUARE, { (x+0)+(y+0)*cols,
+                                          (x+1)+(y+0)*cols,
+                                          (x+1)+(y+1)*cols,
+                                          (x+0)+(y+1)*cols } );
+
+            addFace( mesh, TILE_TRIANGLE, { (x+0)+(y+0)*cols,
+                                            (x+0)+(y+1)*cols,
+                                            (x-1)+(y+1)*cols } );
+         }
+
+         if( x%2 == 1 && y%2 == 0 )
+         {
+            addFace( mesh, TILE_TRIANGLE, { (x+0)+(y+0)*cols,
+                                            (x+1)+(y+0)*cols,
+                                            (x+0)+(y+1)*cols } );
+         }
+
+         if( x%2 == 0 && y%2 == 1 )
+         {
+            addFace( mesh, TILE_TRIANGLE, { (x+0)+(y+0)*cols,
+                                            (x+1)+(y+0)*cols,
+                                            (x+1)+(y+1)*cols } );
+
+            addFace( mesh, TILE_TRIANGLE, { (x+0)+(y+0)*cols,
+                                            (x+1)+(y+1)*cols,
+                                            (x+0)+(y+1)*cols } );
+         }
+
+         if( x%2 == 1 && y%2 == 1 )
+         {
+            addFace( mesh, TILE_SQUARE, { (x+0)+(y+0)*cols,
+                                          (x+1)+(y+0)*cols,
+                                          (x+1)+(y+1)*cols,
+                                          (x+0)+(y+1)*cols } );
+         }
+      }
+   }
+}
+
+// =============================================================================
+// =============================================================================
+void semi6( int       rows,
+            int       cols,
+            Mesh&     mesh )
+{
+   // generate vertices ----------------------------------------------
+   float px, py;
+
+   for( int y=0; y<rows; y++ )
+   {
+      for( int x=0; x<cols; x++ )
+      {
+         px = floorf(x/2.0f)*(2.0f+sqrtf(3.0f)) + (x%2) +
+              floorf(y/4.0f)*(1.0f+sqrtf(3.0f)/2.0f);
+         py = floorf(y/4.0f)*(1.5f+sqrtf(3.0f));
+
+         switch( y%4 )
+         {
+            case 0:
+               px += 0.0f;
+               py += 0.0f;
+               break;
+            case 1:
+               px += 0.5f;
+               py += sqrtf(3.0f)/2.0f;
+               break;
+            case 2:
+               px += 0.5f;
+               py += 1.0f + sqrtf(3.0f)/2.0f;
+               break;
+            case 3:
+               px += 0.0f;
+               py += 1.0f + sqrtf(3.0f);
+               break;
+            default:
+               break;
+         }
+
+         addVertex( mesh, px, py );
+      }
+   }
+
+   // generate faces -------------------------------------------------
+   for( int y=1; y<rows-4; y++ )
+   {
+      for( int x=0; x<cols-3; x++ )
+      {
+         if( x%2 == 0 && y%4 == 0 )
+         {
+            addFace( mesh, TILE_DODECAGON, { (x+1)+(y+0)*cols,
+                                             (x+2)+(y-1)*cols,
+                                             (x+3)+(y-1)*cols,
+                                             (x+2)+(y+0)*cols,
+                                             (x+2)+(y+1)*cols,
+                                             (x+2)+(y+2)*cols,
+                                             (x+2)+(y+3)*cols,
+                                             (x+1)+(y+4)*cols,
+                                             (x+0)+(y+4)*cols,
+                                             (x+1)+(y+3)*cols,
+                                             (x+0)+(y+2)*cols,
+                                             (x+0)+(y+1)*cols } );
+
+            addFace( mesh, TILE_TRIANGLE, { (x+0)+(y+0)*cols,
+                                            (x+1)+(y+0)*cols,
+                                            (x+0)+(y+1)*cols } );
+
+         }
+
+         if( x%2 == 0 && y%4 == 2 )
+         {
+            addFace( mesh, TILE_TRIANGLE, { (x+0)+(y+0)*cols,
+                                            (x+1)+(y+1)*cols,
+                                            (x+0)+(y+1)*cols } );
+
+         }
+      }
+   }
+}
+
+// =============================================================================
+// =============================================================================
+void semi7( int       rows,
+            int       cols,
+            Mesh&     mesh )
+{
+   // generate vertices ----------------------------------------------
+   float px, py;
+
+   for( int y=0; y<rows; y++ )
+   {
+      for( int x=0; x<cols; x++ )
+      {
+         px = floorf(x/2.0f)*(1.0f+sqrtf(3.0f)) + (x%2)*sqrtf(3.0f) +
+              floorf(y/4.0f)*(0.5f+sqrtf(3.0f)/2.0f);
+         py = floorf(y/4.0f)*(1.5f+sqrtf(3.0f)/2.0f);
+
+         switch( y%4 )
+         {
+            case 0:
+               px += sqrtf(3.0f)/2.0f;
+               py += -0.5f;
+               break;
+            case 1:
+               px += 0.0f;
+               py += 0.0f;
+               break;
+            case 2:
+               px += 0.0f;
+               py += 1.0f;
+               break;
+            case 3:
+               px += sqrtf(3.0f)/2.0f;
+               py += 1.5f;
+               break;
+            default:
+               break;
+         }
+
+         addVertex( mesh, px, py );
+      }
+   }
+
+   // generate faces -------------------------------------------------
+   for( int y=2; y<rows-3; y++ )
+   {
+      for( int x=2; x<cols-2; x++ )
+      {
+         if( x%2 == 0 && y%4 == 0 )
+         {
+            addFace( mesh, TILE_HEXAGON, { (x+0)+(y+0)*cols,
+                                           (x+1)+(y+1)*cols,
+                                           (x+1)+(y+2)*cols,
+                                           (x+0)+(y+3)*cols,
+                                           (x+0)+(y+2)*cols,
+                                           (x+0)+(y+1)*cols } );
+
+            addFace( mesh, TILE_SQUARE, { (x+0)+(y+0)*cols,
+                                          (x+2)+(y-2)*cols,
+                                          (x+2)+(y-1)*cols,
+                                          (x+1)+(y+1)*cols } );
+
+            addFace( mesh, TILE_TRIANGLE, { (x+1)+(y+1)*cols,
+                                            (x+2)+(y-1)*cols,
+                                            (x+2)+(y+1)*cols } );
+         }
+
+         if( x%2 == 1 && y%4 == 1 )
+         {
+            addFace( mesh, TILE_SQUARE, { (x+0)+(y+0)*cols,
+                                          (x+1)+(y+0)*cols,
+                                          (x+1)+(y+1)*cols,
+                                          (x+0)+(y+1)*cols } );
+
+         }
+         
+         if( x%2 == 1 && y%4 == 2 )
+         {
+            addFace( mesh, TILE_SQUARE, { (x+0)+(y+0)*cols,
+                                          (x-1)+(y+2)*cols,
+                                          (x-1)+(y+3)*cols,
+                                          (x-1)+(y+1)*cols } );
+         }
+
+         if( x%2 == 0 && y%4 == 2 )
+         {
+            addFace( mesh, TILE_TRIANGLE, { (x-1)+(y+0)*cols,
+                                            (x+0)+(y+0)*cols,
+                                            (x-2)+(y+2)*cols } );
+
+         }
+      }
+   }
+}
+
+// =============================================================================
+// =============================================================================
+void semi8( int       rows,
+            int       cols,
+            Mesh&     mesh )
+{
+   // generate vertices ----------------------------------------------
+   float px, py;
+
+   for( int y=0; y<rows; y++ )
+   {
+      for( int x=0; x<cols; x++ )
+      {
+         px = floorf(x/4.0f)*(3.0f+3.0f*sqrtf(3.0f)) +
+              floorf(y/4.0f)*(1.5f+1.5f*sqrtf(3.0f));
+         py = floorf(y/4.0f)*(1.5f+sqrtf(3.0f)/2.0f);
+
+         switch( y%4 )
+         {
+            case 0:
+               px += sqrtf(3.0f)/2.0f;
+               py += -0.5f;
+               break;
+            case 1:
+               px += 0.0f ;
+               py += 0.0f ;
+               break;
+            case 2:
+               px += 0.0f ;
+               py += 1.0f;
+               break;
+            case 3:
+               px += sqrtf(3.0f)/2.0f;
+               py += 1.5f;
+               break;
+            default:
+               break;
+         }
+
+         switch( x%4 )
+         {
+            case 0:
+               px += 0.0f;
+               break;
+            case 1:
+               px += sqrtf(3.0f);
+               break;
+            case 2:
+               px += 1.0f + sqrtf(3.0f);
+               break;
+            case 3:
+               px += 1.0f + 2.0f*sqrtf(3.0f);
+               break;
+         }
+
+         addVertex( mesh, px, py );
+      }
+   }
+
+   // generate faces -------------------------------------------------
+   for( int y=3; y<rows-4; y++ )
+   {
+      for( int x=3; x<cols-3; x++ )
+      {
+         if( x%2 == 0 && y%4 == 0 )
+         {
+            addFace( mesh, TILE_HEXAGON, { (x+0)+(y+0)*cols,
+                                           (x+1)+(y+1)*cols,
+                                           (x+1)+(y+2)*cols,
+                                           (x+0)+(y+3)*cols,
+                                           (x+0)+(y+2)*cols,
+                                           (x+0)+(y+1)*cols } );
+         }
+
+         if( x%4 == 1 && y%4 == 1 )
+         {
+            addFace( mesh, TILE_SQUARE, { (x+0)+(y+0)*cols,
+                                          (x+1)+(y+0)*cols,
+                                          (x+1)+(y+1)*cols,
+                                          (x+0)+(y+1)*cols } );
+         }
+
+         if( x%4 == 3 && y%4 == 2 )
+         {
+            addFace( mesh, TILE_SQUARE, { (x+0)+(y+0)*cols,
+                                          (x-3)+(y+2)*cols,
+                                          (x-3)+(y+3)*cols,
+                                          (x-1)+(y+1)*cols } );
+         }
+
+         if( x%4 == 0 && y%4 == 2 )
+         {
+            addFace( mesh, TILE_SQUARE, { (x+0)+(y+1)*cols,
+                                          (x-1)+(y+3)*cols,
+                                          (x-2)+(y+2)*cols,
+                                          (x+0)+(y+0)*cols } );
+         }
+
+         if( x%4 == 3 && y%4 == 1 )
+         {
+            addFace( mesh, TILE_DODECAGON, { (x+0)+(y+0)*cols,
+                                             (x+1)+(y-2)*cols,
+                                             (x+2)+(y-3)*cols,
+                                             (x+3)+(y-3)*cols,
+                                             (x+3)+(y-2)*cols,
+                                             (x+1)+(y+0)*cols,
+                                             (x+1)+(y+1)*cols,
+                                             (x-1)+(y+3)*cols,
+                                             (x-1)+(y+4)*cols,
+                                             (x-2)+(y+4)*cols,
+                                             (x-3)+(y+3)*cols,
+                                             (x+0)+(y+1)*cols } );
+         }
+      }
+   }
+}
+
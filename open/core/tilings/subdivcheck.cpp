@@ -0,0 +1,354 @@
+////////////////////////////////////////////////////////////////////////////////
+// subdivcheck.cpp
+//
+// DESCRIPTION: checks subdividePattern() (see subdivide.cpp) against a plain
+//              reference implementation of Loop and Catmull-Clark subdivision
+//              with the same boundary rules.  Every pattern is generated at a
+//              few small sizes, and at one large enough that most of it is
+//              stamped from a subdivided template, subdivided by the reference code one level at
+//              a time, and compared with the output of subdividePattern() for
+//              the same number of levels.  Two meshes match when every used
+//              vertex of one lies within a small distance of a used vertex of
+//              the other and they have the same faces, up to the order of
+//              vertices and faces and the starting corner of each face.
+//              Prints one line per case and exits with status 1 if any case
+//              fails.
+// USAGE:
+//    subdivcheck [levels]
+//
+//              levels - deepest subdivision level to check (default 3)
+//
+// BUILD:
+//    g++ -O2 -o subdivcheck subdivcheck.cpp patterns.cpp subdivide.cpp
+//
+// LICENSE:
+//    Released into the public domain.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tiling.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <algorithm>
+#include <math.h>
+#include <stdlib.h>
+
+using namespace std;
+
+static const char* patternNames[] =
+{
+   "square", "triangle", "hexagon",
+   "semi1", "semi2", "semi3", "semi4", "semi5", "semi6", "semi7", "semi8"
+};
+
+static const double tolerance = 1e-4;
+
+void referenceSubdivide( Mesh& mesh );
+bool sameMesh( const Mesh& a, const Mesh& b );
+
+// =============================================================================
+// =============================================================================
+int main( int argc, char **argv )
+{
+   int maxLevels = argc > 1 ? atoi( argv[1] ) : 3;
+   // rows, columns and the deepest level to check at that size; the largest
+   // size is big enough for subdividePattern() to stamp it from a template
+   int sizes[][3] = { { 12, 12, maxLevels }, { 13, 17, maxLevels }, { 131, 127, min( maxLevels, 2 ) } };
+   int failures   = 0;
+
+   for( size_t p=0; p<sizeof(patternNames)/sizeof(patternNames[0]); p++ )
+   {
+      for( size_t s=0; s<sizeof(sizes)/sizeof(sizes[0]); s++ )
+      {
+         Mesh reference;
+         generatePattern( patternNames[p], sizes[s][0], sizes[s][1], reference );
+
+         for( int levels=1; levels<=sizes[s][2]; levels++ )
+         {
+            referenceSubdivide( reference );
+
+            Mesh mesh;
+            subdividePattern( patternNames[p], sizes[s][0], sizes[s][1], levels, mesh );
+
+            bool ok = sameMesh( mesh, reference );
+            failures += ok ? 0 : 1;
+
+            cout << patternNames[p] << " " << sizes[s][0] << "x" << sizes[s][1]
+                 << " levels " << levels << ": " << ( ok ? "ok" : "FAILED" ) << endl;
+         }
+      }
+   }
+
+   // the Loop path of subdivide() is not reached through subdividePattern()
+   Mesh mesh, reference;
+   generatePattern( "triangle", 12, 12, mesh );
+   generatePattern( "triangle", 12, 12, reference );
+   subdivide( mesh, 2 );
+   referenceSubdivide( reference );
+   referenceSubdivide( reference );
+
+   bool ok = sameMesh( mesh, reference );
+   failures += ok ? 0 : 1;
+   cout << "subdivide() triangle 12x12 levels 2: " << ( ok ? "ok" : "FAILED" ) << endl;
+
+   return failures > 0 ? 1 : 0;
+}
+
+// =============================================================================
+// =============================================================================
+// One level of subdivision, written for clarity rather than speed: edges live
+// in a map and every vertex keeps a set of its neighbours.
+void referenceSubdivide( Mesh& mesh )
+{
+   typedef pair<int,int> Edge;
+
+   int nVertices = (int) mesh.vertex.size() / 3;
+   int nFaces    = (int) mesh.faceStart.size() - 1;
+
+   vector< vector<int> > faces( nFaces );
+   bool triangles = true;
+   for( int i=0; i<nFaces; i++ )
+   {
+      faces[i].assign( mesh.faceIndex.begin() + mesh.faceStart[i],
+                       mesh.faceIndex.begin() + mesh.faceStart[i+1] );
+      triangles = triangles && faces[i].size() == 3;
+   }
+
+   map< Edge, vector<int> > edgeFaces;
+   vector< set<int> >       neighbours( nVertices );
+   vector< vector<int> >    vertexFaces( nVertices );
+
+   for( int i=0; i<nFaces; i++ )
+   {
+      int n = (int) faces[i].size();
+      for( int j=0; j<n; j++ )
+      {
+         int a = faces[i][j], b = faces[i][(j+1)%n];
+         edgeFaces[ Edge( min(a,b), max(a,b) ) ].push_back( i );
+         neighbours[a].insert( b );
+         neighbours[b].insert( a );
+         vertexFaces[a].push_back( i );
+      }
+   }
+
+   vector<bool> boundary( nVertices, false );
+   for( map< Edge, vector<int> >::iterator e=edgeFaces.begin(); e!=edgeFaces.end(); e++ )
+   {
+      if( e->second.size() != 2 )
+      {
+         boundary[e->first.first] = boundary[e->first.second] = true;
+      }
+   }
+
+   vector<double> p( mesh.vertex.begin(), mesh.vertex.end() );
+   vector<double> q;
+
+   map<Edge,int> edgeIndex;
+   vector<int>   faceIndex( nFaces );
+
+   // new vertices: old, then edges, then (Catmull-Clark only) faces
+   vector<double> facePoint( 3*nFaces, 0.0 );
+   for( int i=0; i<nFaces; i++ )
+   {
+      for( size_t j=0; j<faces[i].size(); j++ )
+         for( int c=0; c<3; c++ ) facePoint[3*i+c] += p[3*faces[i][j]+c] / faces[i].size();
+   }
+
+   q.resize( 3*nVertices );
+   for( int v=0; v<nVertices; v++ )
+   {
+      int n = (int) neighbours[v].size();
+
+      for( int c=0; c<3; c++ )
+      {
+         double old = p[3*v+c];
+
+         if( boundary[v] || n == 0 )
+         {
+            q[3*v+c] = old;
+         }
+         else if( triangles )
+         {
+            double beta = n == 3 ? 3.0/16.0 : 3.0/(8.0*n);
+            double sum  = 0.0;
+            for( set<int>::iterator w=neighbours[v].begin(); w!=neighbours[v].end(); w++ )
+               sum += p[3*(*w)+c];
+            q[3*v+c] = (1.0 - n*beta)*old + beta*sum;
+         }
+         else
+         {
+            double f = 0.0, r = 0.0;
+            for( size_t k=0; k<vertexFaces[v].size(); k++ )
+               f += facePoint[3*vertexFaces[v][k]+c] / vertexFaces[v].size();
+            for( set<int>::iterator w=neighbours[v].begin(); w!=neighbours[v].end(); w++ )
+               r += 0.5*( old + p[3*(*w)+c] ) / n;
+            q[3*v+c] = ( f + 2.0*r + (n-3.0)*old ) / n;
+         }
+      }
+   }
+
+   for( map< Edge, vector<int> >::iterator e=edgeFaces.begin(); e!=edgeFaces.end(); e++ )
+   {
+      int a = e->first.first, b = e->first.second;
+      edgeIndex[e->first] = (int) q.size() / 3;
+
+      for( int c=0; c<3; c++ )
+      {
+         double x = 0.5*( p[3*a+c] + p[3*b+c] );
+
+         if( e->second.size() == 2 && triangles )
+         {
+            double opposite = 0.0;
+            for( int k=0; k<2; k++ )
+            {
+               const vector<int>& f = faces[ e->second[k] ];
+               for( int j=0; j<3; j++ )
+                  if( f[j] != a && f[j] != b ) opposite += p[3*f[j]+c];
+            }
+            x = 0.375*( p[3*a+c] + p[3*b+c] ) + 0.125*opposite;
+         }
+         else if( e->second.size() == 2 )
+         {
+            x = 0.25*( p[3*a+c] + p[3*b+c] +
+                       facePoint[3*e->second[0]+c] + facePoint[3*e->second[1]+c] );
+         }
+
+         q.push_back( x );
+      }
+   }
+
+   if( !triangles )
+   {
+      for( int i=0; i<nFaces; i++ )
+      {
+         faceIndex[i] = (int) q.size() / 3;
+         for( int c=0; c<3; c++ ) q.push_back( facePoint[3*i+c] );
+      }
+   }
+
+   // new faces
+   Mesh fine;
+   fine.vertex.assign( q.begin(), q.end() );
+
+   for( int i=0; i<nFaces; i++ )
+   {
+      const vector<int>& f = faces[i];
+      int n = (int) f.size();
+
+      vector<int> mid( n );
+      for( int j=0; j<n; j++ )
+      {
+         int a = f[j], b = f[(j+1)%n];
+         mid[j] = edgeIndex[ Edge( min(a,b), max(a,b) ) ];
+      }
+
+      if( triangles )
+      {
+         addFace( fine, TILE_TRIANGLE, { f[0], mid[0], mid[2] } );
+         addFace( fine, TILE_TRIANGLE, { f[1], mid[1], mid[0] } );
+         addFace( fine, TILE_TRIANGLE, { f[2], mid[2], mid[1] } );
+         addFace( fine, TILE_TRIANGLE, { mid[0], mid[1], mid[2] } );
+      }
+      else
+      {
+         for( int j=0; j<n; j++ )
+         {
+            addFace( fine, TILE_SQUARE, { f[j], mid[j], faceIndex[i], mid[(j+n-1)%n] } );
+         }
+      }
+   }
+
+   mesh = fine;
+}
+
+// =============================================================================
+// =============================================================================
+// For every used vertex of a, the used vertex of b at the same place, or -1.
+static vector<int> matchVertices( const Mesh& a,
+                                  const Mesh& b )
+{
+   vector<bool> usedA( a.vertex.size()/3, false ), usedB( b.vertex.size()/3, false );
+   for( size_t k=0; k<a.faceIndex.size(); k++ ) usedA[ a.faceIndex[k] ] = true;
+   for( size_t k=0; k<b.faceIndex.size(); k++ ) usedB[ b.faceIndex[k] ] = true;
+
+   // bucket b's vertices on a grid of cells as large as the tolerance
+   map< pair<long,long>, vector<int> > grid;
+   for( size_t v=0; v<usedB.size(); v++ )
+   {
+      if( !usedB[v] ) continue;
+      grid[ make_pair( lround( b.vertex[3*v+0] / tolerance ),
+                       lround( b.vertex[3*v+1] / tolerance )) ].push_back( (int) v );
+   }
+
+   vector<int> match( usedA.size(), -1 );
+   for( size_t v=0; v<usedA.size(); v++ )
+   {
+      if( !usedA[v] ) continue;
+
+      long x = lround( a.vertex[3*v+0] / tolerance );
+      long y = lround( a.vertex[3*v+1] / tolerance );
+
+      for( long i=x-1; i<=x+1; i++ )
+         for( long j=y-1; j<=y+1; j++ )
+         {
+            map< pair<long,long>, vector<int> >::iterator cell = grid.find( make_pair( i, j ));
+            if( cell == grid.end() ) continue;
+
+            for( size_t k=0; k<cell->second.size(); k++ )
+            {
+               int w = cell->second[k];
+               if( fabs( a.vertex[3*v+0] - b.vertex[3*w+0] ) < tolerance &&
+                   fabs( a.vertex[3*v+1] - b.vertex[3*w+1] ) < tolerance &&
+                   fabs( a.vertex[3*v+2] - b.vertex[3*w+2] ) < tolerance )
+               {
+                  match[v] = w;
+               }
+            }
+         }
+   }
+
+   return match;
+}
+
+bool sameMesh( const Mesh& a,
+               const Mesh& b )
+{
+   if( a.faceStart.size() != b.faceStart.size() )
+   {
+      return false;
+   }
+
+   vector<int> match = matchVertices( a, b );
+
+   // faces of a in terms of b's vertices, and faces of b, each rotated to
+   // start at its smallest index
+   vector< vector<int> > facesA, facesB;
+
+   for( size_t i=0; i+1<a.faceStart.size(); i++ )
+   {
+      vector<int> f;
+      for( int k=a.faceStart[i]; k<a.faceStart[i+1]; k++ )
+      {
+         if( match[ a.faceIndex[k] ] < 0 ) return false;
+         f.push_back( match[ a.faceIndex[k] ] );
+      }
+      rotate( f.begin(), min_element( f.begin(), f.end() ), f.end() );
+      facesA.push_back( f );
+   }
+
+   for( size_t i=0; i+1<b.faceStart.size(); i++ )
+   {
+      vector<int> f( b.faceIndex.begin() + b.faceStart[i], b.faceIndex.begin() + b.faceStart[i+1] );
+      rotate( f.begin(), min_element( f.begin(), f.end() ), f.end() );
+      facesB.push_back( f );
+   }
+
+   sort( facesA.begin(), facesA.end() );
+   sort( facesB.begin(), facesB.end() );
+
+   return facesA == facesB;
+}
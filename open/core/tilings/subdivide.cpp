@@ -0,0 +1,954 @@
+////////////////////////////////////////////////////////////////////////////////
+// subdivide.cpp
+//
+// DESCRIPTION: subdivided versions of the tilings; see tiling.h.
+//
+//              The subdivision rules are Loop's for meshes made only of
+//              triangles and Catmull-Clark's otherwise.  The boundary is kept
+//              as it is: boundary vertices stay put and boundary edges are
+//              split at their midpoints.  Every face of the result keeps the
+//              tile class of the face of the original tiling it came from.
+//
+//              On the regular "square" and "triangle" lattices these rules
+//              give back the same lattice at half the spacing, so
+//              subdividePattern() generates those directly at the finer
+//              resolution.  The other patterns are periodic, and what a face
+//              turns into depends only on the faces around it, so away from
+//              the boundary every face subdivides like its translates.
+//              subdividePattern() therefore subdivides a small template of
+//              the pattern, a few periods across, and stamps the subdivided
+//              faces of the template out over the whole tiling; see
+//              stampPattern().  Near the boundary the template is laid so
+//              that its own boundary lines up with the tiling's.
+//
+//              subdivide() refines any mesh one level at a time, working
+//              directly on the face arrays: edges are found by bucketing the
+//              corners of each face on their smaller endpoint, and the new
+//              connectivity is written out face by face, with no half-edge
+//              structure in between.
+//
+// LICENSE:
+//    Released into the public domain.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tiling.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <limits.h>
+#include <stdint.h>
+
+using namespace std;
+
+// Edges - the edges of a Mesh.  cornerEdge[k] is the edge running from
+// corner k of a face (an index into faceIndex) to the next corner of the
+// same face.  Each edge stores its endpoints, the number of faces using it
+// and the first two corners running along it.
+struct Edges
+{
+   vector<int> cornerFace;
+   vector<int> cornerEdge;
+   vector<int> edgeVertex;   // two per edge
+   vector<int> edgeCorner;   // two per edge, -1 if unused
+   vector<int> edgeFaces;
+};
+
+static void findEdges( const Mesh& mesh, Edges& edges );
+static bool subdivideLevel( Mesh& mesh );
+static bool stampPattern( const string& patternName, int rows, int cols, int levels, Mesh& mesh );
+
+// =============================================================================
+// =============================================================================
+bool subdividePattern( string    patternName,
+                       int       rows,
+                       int       cols,
+                       int       levels,
+                       Mesh&     mesh )
+{
+   if( levels < 0 || levels > 16 )
+   {
+      cerr << "Error: invalid number of subdivision levels ( " << levels << " )" << endl;
+      return false;
+   }
+   if( rows <= 0 || cols <= 0 )
+   {
+      cerr << "Error: invalid size ( " << rows << " x " << cols << " )" << endl;
+      return false;
+   }
+
+   // every level quadruples the number of vertices, so a subdivided tiling
+   // is about as large as an unsubdivided one with 2^levels times the rows
+   // and columns; divide rather than multiply, since the product can overflow
+   if( levels > 0 && ( (long long) rows << levels ) > MAX_TILING_SIZE / ( (long long) cols << levels ))
+   {
+      cerr << "Error: tiling is too large ( " << rows << " x " << cols
+           << " subdivided " << levels << " times )" << endl;
+      return false;
+   }
+
+   if( patternName == "square" || patternName == "triangle" )
+   {
+      long long fineRows = (((long long) rows - 1) << levels) + 1;
+      long long fineCols = (((long long) cols - 1) << levels) + 1;
+
+      if( !generatePattern( patternName, (int) fineRows, (int) fineCols, mesh ))
+      {
+         return false;
+      }
+
+      float scale = 1.0f / (float) (1 << levels);
+
+      for( size_t i=0; i<mesh.vertex.size(); i++ ) mesh.vertex[i] *= scale;
+      for( size_t i=0; i<mesh.uv.size();     i++ ) mesh.uv[i]     *= scale;
+
+      return true;
+   }
+
+   if( !generatePattern( patternName, rows, cols, mesh ))
+   {
+      return false;
+   }
+
+   if( levels > 0 && stampPattern( patternName, rows, cols, levels, mesh ))
+   {
+      return true;
+   }
+
+   return subdivide( mesh, levels );
+}
+
+// Every pattern has rows x cols vertices before subdivision.  Each level
+// roughly quadruples them, and over any number of levels no pattern ends up
+// with more than 1.25 x 4^levels times as many.  The triangle lattice has the
+// most faces and corners per vertex: two and six.
+size_t maxBinarySize( int rows,
+                      int cols,
+                      int levels,
+                      int channels )
+{
+   double vertices = (double) rows * cols * ( levels > 0 ? 1.25 : 1.0 );
+   for( int l=0; l<levels; l++ ) vertices *= 4.0;
+
+   double perVertex = sizeof(float) * 3 + sizeof(int) * ( 2 + 6 );
+   if( channels & CHANNEL_UV     ) perVertex += sizeof(float) * 2;
+   if( channels & CHANNEL_NORMAL ) perVertex += sizeof(float) * 3;
+   if( channels & CHANNEL_CLASS  ) perVertex += 2;
+
+   double size = sizeof(BinaryHeader) + sizeof(int) + 3 + vertices * perVertex;
+   return size < (double) SIZE_MAX / 2 ? (size_t) size : SIZE_MAX / 2;
+}
+
+// =============================================================================
+// =============================================================================
+bool subdivide( Mesh& mesh,
+                int   levels )
+{
+   for( int l=0; l<levels; l++ )
+   {
+      if( !subdivideLevel( mesh ))
+      {
+         return false;
+      }
+   }
+
+   return true;
+}
+
+// =============================================================================
+// =============================================================================
+static void findEdges( const Mesh& mesh,
+                       Edges&      edges )
+{
+   int nVertices = (int) mesh.vertex.size() / 3;
+   int nFaces    = (int) mesh.faceStart.size() - 1;
+   int nCorners  = (int) mesh.faceIndex.size();
+
+   // the corner that follows corner k around its face
+   vector<int> next( nCorners );
+
+   edges.cornerFace.resize( nCorners );
+   for( int i=0; i<nFaces; i++ )
+   {
+      for( int k=mesh.faceStart[i]; k<mesh.faceStart[i+1]; k++ )
+      {
+         edges.cornerFace[k] = i;
+         next[k] = k+1 < mesh.faceStart[i+1] ? k+1 : mesh.faceStart[i];
+      }
+   }
+
+   // bucket the corners on the smaller endpoint of their edge
+   vector<int> bucketStart( nVertices+1, 0 );
+   for( int k=0; k<nCorners; k++ )
+   {
+      bucketStart[ min( mesh.faceIndex[k], mesh.faceIndex[next[k]] ) + 1 ]++;
+   }
+   for( int v=0; v<nVertices; v++ )
+   {
+      bucketStart[v+1] += bucketStart[v];
+   }
+
+   vector<int> bucket( nCorners );
+   vector<int> fill( bucketStart.begin(), bucketStart.end()-1 );
+   for( int k=0; k<nCorners; k++ )
+   {
+      bucket[ fill[ min( mesh.faceIndex[k], mesh.faceIndex[next[k]] ) ]++ ] = k;
+   }
+
+   // sort each bucket on the larger endpoint and number the runs
+   edges.cornerEdge.resize( nCorners );
+   edges.edgeVertex.clear();
+   edges.edgeCorner.clear();
+   edges.edgeFaces.clear();
+
+   vector< pair<int,int> > run;
+
+   for( int v=0; v<nVertices; v++ )
+   {
+      run.clear();
+      for( int b=bucketStart[v]; b<bucketStart[v+1]; b++ )
+      {
+         int k = bucket[b];
+         run.push_back( make_pair( max( mesh.faceIndex[k], mesh.faceIndex[next[k]] ), k ));
+      }
+      sort( run.begin(), run.end() );
+
+      for( size_t r=0; r<run.size(); r++ )
+      {
+         if( r == 0 || run[r].first != run[r-1].first )
+         {
+            edges.edgeVertex.push_back( v );
+            edges.edgeVertex.push_back( run[r].first );
+            edges.edgeCorner.push_back( run[r].second );
+            edges.edgeCorner.push_back( -1 );
+            edges.edgeFaces.push_back( 0 );
+         }
+
+         int e = (int) edges.edgeFaces.size() - 1;
+
+         if( edges.edgeFaces[e] == 1 )
+         {
+            edges.edgeCorner[2*e+1] = run[r].second;
+         }
+         edges.edgeFaces[e]++;
+         edges.cornerEdge[ run[r].second ] = e;
+      }
+   }
+}
+
+// =============================================================================
+// =============================================================================
+// Loop's rules, applied to one channel of dim floats per vertex.  New
+// vertices are the old ones followed by one per edge.
+static void loopChannel( const Mesh&          mesh,
+                         const Edges&         edges,
+                         const vector<char>&  boundary,
+                         const vector<int>&   valence,
+                         const vector<float>& in,
+                         int                  dim,
+                         vector<float>&       out )
+{
+   int nVertices = (int) boundary.size();
+   int nEdges    = (int) edges.edgeFaces.size();
+
+   out.assign( (size_t) dim * ( nVertices + nEdges ), 0.0f );
+
+   // edge points, and neighbour sums for the vertex points
+   vector<float> neighbours( (size_t) dim * nVertices, 0.0f );
+
+   for( int e=0; e<nEdges; e++ )
+   {
+      int a = edges.edgeVertex[2*e+0];
+      int b = edges.edgeVertex[2*e+1];
+
+      for( int c=0; c<dim; c++ )
+      {
+         neighbours[dim*a+c] += in[dim*b+c];
+         neighbours[dim*b+c] += in[dim*a+c];
+      }
+
+      float* p = &out[ (size_t) dim * ( nVertices + e ) ];
+
+      if( edges.edgeFaces[e] == 2 )
+      {
+         // the vertices opposite the edge in its two triangles
+         int k0 = edges.edgeCorner[2*e+0];
+         int k1 = edges.edgeCorner[2*e+1];
+         int f0 = mesh.faceStart[ edges.cornerFace[k0] ];
+         int f1 = mesh.faceStart[ edges.cornerFace[k1] ];
+         int o0 = mesh.faceIndex[ f0 + (k0-f0+2)%3 ];
+         int o1 = mesh.faceIndex[ f1 + (k1-f1+2)%3 ];
+
+         for( int c=0; c<dim; c++ )
+         {
+            p[c] = 0.375f * ( in[dim*a+c] + in[dim*b+c] ) +
+                   0.125f * ( in[dim*o0+c] + in[dim*o1+c] );
+         }
+      }
+      else
+      {
+         for( int c=0; c<dim; c++ )
+         {
+            p[c] = 0.5f * ( in[dim*a+c] + in[dim*b+c] );
+         }
+      }
+   }
+
+   // vertex points
+   for( int v=0; v<nVertices; v++ )
+   {
+      float* p = &out[ (size_t) dim * v ];
+      int    n = valence[v];
+
+      if( boundary[v] || n == 0 )
+      {
+         for( int c=0; c<dim; c++ ) p[c] = in[dim*v+c];
+         continue;
+      }
+
+      float beta = n == 3 ? 3.0f/16.0f : 3.0f/(8.0f*n);
+
+      for( int c=0; c<dim; c++ )
+      {
+         p[c] = (1.0f - n*beta) * in[dim*v+c] + beta * neighbours[dim*v+c];
+      }
+   }
+}
+
+// =============================================================================
+// =============================================================================
+// Catmull-Clark's rules, applied to one channel of dim floats per vertex.
+// New vertices are the old ones, then one per edge, then one per face.
+static void catmullClarkChannel( const Mesh&          mesh,
+                                 const Edges&         edges,
+                                 const vector<char>&  boundary,
+                                 const vector<int>&   valence,
+                                 const vector<float>& in,
+                                 int                  dim,
+                                 vector<float>&       out )
+{
+   int nVertices = (int) boundary.size();
+   int nEdges    = (int) edges.edgeFaces.size();
+   int nFaces    = (int) mesh.faceStart.size() - 1;
+
+   out.assign( (size_t) dim * ( nVertices + nEdges + nFaces ), 0.0f );
+
+   float* facePoint = &out[ (size_t) dim * ( nVertices + nEdges ) ];
+   float* edgePoint = &out[ (size_t) dim * nVertices ];
+
+   // face points are centroids; also sum them around each vertex
+   vector<float> faceSum( (size_t) dim * nVertices, 0.0f );
+   vector<int>   faceCount( nVertices, 0 );
+
+   for( int i=0; i<nFaces; i++ )
+   {
+      float* p = &facePoint[ (size_t) dim * i ];
+      int    n = mesh.faceStart[i+1] - mesh.faceStart[i];
+
+      for( int k=mesh.faceStart[i]; k<mesh.faceStart[i+1]; k++ )
+      {
+         for( int c=0; c<dim; c++ ) p[c] += in[ dim*mesh.faceIndex[k]+c ];
+      }
+      for( int c=0; c<dim; c++ ) p[c] /= n;
+
+      for( int k=mesh.faceStart[i]; k<mesh.faceStart[i+1]; k++ )
+      {
+         int v = mesh.faceIndex[k];
+         for( int c=0; c<dim; c++ ) faceSum[dim*v+c] += p[c];
+         faceCount[v]++;
+      }
+   }
+
+   // edge points; also sum the edge midpoints around each vertex
+   vector<float> midSum( (size_t) dim * nVertices, 0.0f );
+
+   for( int e=0; e<nEdges; e++ )
+   {
+      int    a = edges.edgeVertex[2*e+0];
+      int    b = edges.edgeVertex[2*e+1];
+      float* p = &edgePoint[ (size_t) dim * e ];
+
+      for( int c=0; c<dim; c++ )
+      {
+         float mid = 0.5f * ( in[dim*a+c] + in[dim*b+c] );
+         midSum[dim*a+c] += mid;
+         midSum[dim*b+c] += mid;
+         p[c] = mid;
+      }
+
+      if( edges.edgeFaces[e] == 2 )
+      {
+         const float* f0 = &facePoint[ (size_t) dim * edges.cornerFace[ edges.edgeCorner[2*e+0] ]];
+         const float* f1 = &facePoint[ (size_t) dim * edges.cornerFace[ edges.edgeCorner[2*e+1] ]];
+
+         for( int c=0; c<dim; c++ )
+         {
+            p[c] = 0.25f * ( in[dim*a+c] + in[dim*b+c] + f0[c] + f1[c] );
+         }
+      }
+   }
+
+   // vertex points
+   for( int v=0; v<nVertices; v++ )
+   {
+      float* p = &out[ (size_t) dim * v ];
+      int    n = valence[v];
+
+      if( boundary[v] || n == 0 )
+      {
+         for( int c=0; c<dim; c++ ) p[c] = in[dim*v+c];
+         continue;
+      }
+
+      for( int c=0; c<dim; c++ )
+      {
+         float q = faceSum[dim*v+c] / faceCount[v];
+         float r = midSum [dim*v+c] / n;
+         p[c] = ( q + 2.0f*r + (n-3.0f)*in[dim*v+c] ) / n;
+      }
+   }
+}
+
+// =============================================================================
+// =============================================================================
+static bool subdivideLevel( Mesh& mesh )
+{
+   int nVertices = (int) mesh.vertex.size() / 3;
+   int nFaces    = (int) mesh.faceStart.size() - 1;
+   int nCorners  = (int) mesh.faceIndex.size();
+
+   if( (long long) nVertices + nCorners + nFaces > INT_MAX/3 ||
+       4LL * nCorners > INT_MAX )
+   {
+      cerr << "Error: subdivided tiling is too large." << endl;
+      return false;
+   }
+
+   bool triangles = true;
+   for( int i=0; i<nFaces && triangles; i++ )
+   {
+      triangles = mesh.faceStart[i+1] - mesh.faceStart[i] == 3;
+   }
+
+   Edges edges;
+   findEdges( mesh, edges );
+
+   int nEdges = (int) edges.edgeFaces.size();
+
+   // vertices on the boundary (or on a non-manifold edge) stay where they are
+   vector<char> boundary( nVertices, 0 );
+   vector<int>  valence( nVertices, 0 );
+
+   for( int e=0; e<nEdges; e++ )
+   {
+      for( int j=0; j<2; j++ )
+      {
+         int v = edges.edgeVertex[2*e+j];
+         valence[v]++;
+         if( edges.edgeFaces[e] != 2 ) boundary[v] = 1;
+      }
+   }
+
+   // new positions and vertex channels
+   void (*rule)( const Mesh&, const Edges&, const vector<char>&, const vector<int>&,
+                 const vector<float>&, int, vector<float>& ) =
+      triangles ? loopChannel : catmullClarkChannel;
+
+   vector<float> vertex, uv, normal;
+   rule( mesh, edges, boundary, valence, mesh.vertex, 3, vertex );
+   if( mesh.channels & CHANNEL_UV     ) rule( mesh, edges, boundary, valence, mesh.uv,     2, uv     );
+   if( mesh.channels & CHANNEL_NORMAL ) rule( mesh, edges, boundary, valence, mesh.normal, 3, normal );
+
+   // new faces
+   Mesh fine( mesh.channels );
+   fine.vertex.swap( vertex );
+   fine.uv.swap( uv );
+   fine.normal.swap( normal );
+   fine.faceStart.reserve( triangles ? 4*nFaces+1 : nCorners+1 );
+   fine.faceIndex.reserve( 4*nCorners );
+
+   for( int i=0; i<nFaces; i++ )
+   {
+      int       first     = mesh.faceStart[i];
+      int       n         = mesh.faceStart[i+1] - first;
+      TileClass tileClass = mesh.channels & CHANNEL_CLASS ? (TileClass) mesh.faceClass[i] : TILE_TRIANGLE;
+
+      if( triangles )
+      {
+         int v0 = mesh.faceIndex[first+0];
+         int v1 = mesh.faceIndex[first+1];
+         int v2 = mesh.faceIndex[first+2];
+         int e0 = nVertices + edges.cornerEdge[first+0];
+         int e1 = nVertices + edges.cornerEdge[first+1];
+         int e2 = nVertices + edges.cornerEdge[first+2];
+
+         addFace( fine, tileClass, { v0, e0, e2 } );
+         addFace( fine, tileClass, { v1, e1, e0 } );
+         addFace( fine, tileClass, { v2, e2, e1 } );
+         addFace( fine, tileClass, { e0, e1, e2 } );
+      }
+      else
+      {
+         int f = nVertices + nEdges + i;
+
+         for( int j=0; j<n; j++ )
+         {
+            addFace( fine, tileClass, { mesh.faceIndex[first+j],
+                                        nVertices + edges.cornerEdge[first+j],
+                                        f,
+                                        nVertices + edges.cornerEdge[first+(j+n-1)%n] } );
+         }
+      }
+   }
+
+   swap( mesh, fine );
+
+   return true;
+}
+
+// =============================================================================
+// =============================================================================
+// Shifting one of these patterns by a multiple of its period, in columns and
+// rows of the vertex lattice generatePattern() lays out, translates it onto
+// itself.
+static const struct
+{
+   const char* name;
+   int         columns;
+   int         rows;
+}
+periods[] =
+{
+   { "hexagon", 2, 2 },
+   { "semi1",   7, 7 },
+   { "semi2",   2, 2 },
+   { "semi3",   1, 2 },
+   { "semi4",   2, 2 },
+   { "semi5",   2, 2 },
+   { "semi6",   2, 4 },
+   { "semi7",   2, 4 },
+   { "semi8",   4, 4 }
+};
+
+// How far, in lattice columns or rows, a face can be from the faces and the
+// boundary that decide what it subdivides into.  Two rings of faces decide
+// it, and no face of these patterns spans more than four columns or rows.
+static const int REACH = 12;
+
+// Tags of the vertices of a subdivided mesh: each one is a vertex of the
+// coarse mesh, lies on a coarse edge (at param segments from the edge's first
+// vertex, out of 2^levels), or lies inside a coarse face.
+enum { ON_VERTEX, ON_EDGE, INSIDE };
+
+// Stamp - the subdivided faces of one face of the template, in terms that
+// carry over to its translates.  Each local vertex is corner k of the coarse
+// face, the t-th point splitting the edge from corner k to the next corner,
+// or the r-th point inside the face.
+struct Stamp
+{
+   Stamp( void ) : nInside( -1 ) {}
+
+   vector<int> kind;        // ON_VERTEX, ON_EDGE or INSIDE
+   vector<int> corner;      // k
+   vector<int> index;       // t or r
+   vector<int> source;      // vertex of the subdivided template
+   vector<int> faceStart;   // over the local vertices
+   vector<int> faceIndex;
+   int         nInside;     // -1 until the stamp has been made
+};
+
+// =============================================================================
+// =============================================================================
+// tagSubdivide() subdivides mesh like subdivide(), also tagging every vertex
+// with where it lies on the original mesh, and every face with the original
+// face it came from.
+static bool tagSubdivide( Mesh&        mesh,
+                          int          levels,
+                          const Edges& coarse,
+                          vector<int>& kind,
+                          vector<int>& element,
+                          vector<int>& param,
+                          vector<int>& parent )
+{
+   int segments = 1 << levels;
+   int nFaces   = (int) mesh.faceStart.size() - 1;
+
+   kind.assign( mesh.vertex.size() / 3, ON_VERTEX );
+   element.resize( kind.size() );
+   param.assign( kind.size(), 0 );
+   parent.resize( nFaces );
+
+   for( size_t v=0; v<kind.size(); v++ ) element[v] = (int) v;
+   for( int i=0; i<nFaces; i++ ) parent[i] = i;
+
+   // where on its coarse edge E a vertex tagged ON_VERTEX or ON_EDGE lies,
+   // or -1 if it isn't on E
+   auto along = [&]( int v, int E )
+   {
+      if( kind[v] == ON_EDGE ) return element[v] == E ? param[v] : -1;
+      if( kind[v] == INSIDE  ) return -1;
+      return element[v] == coarse.edgeVertex[2*E+0] ? 0 :
+             element[v] == coarse.edgeVertex[2*E+1] ? segments : -1;
+   };
+
+   for( int l=0; l<levels; l++ )
+   {
+      Edges edges;
+      findEdges( mesh, edges );
+
+      int nVertices = (int) kind.size();
+      int nEdges    = (int) edges.edgeFaces.size();
+      int nCorners  = (int) mesh.faceIndex.size();
+      nFaces        = (int) mesh.faceStart.size() - 1;
+
+      bool triangles = nCorners == 3*nFaces;
+
+      // one new vertex per edge, and one per face for Catmull-Clark
+      int nNew = nVertices + nEdges + ( triangles ? 0 : nFaces );
+      kind.resize( nNew );
+      element.resize( nNew );
+      param.resize( nNew, 0 );
+
+      for( int e=0; e<nEdges; e++ )
+      {
+         int a = edges.edgeVertex[2*e+0];
+         int b = edges.edgeVertex[2*e+1];
+         int v = nVertices + e;
+
+         // the coarse edge this edge might lie on
+         int E = l == 0 ? e : kind[a] == ON_EDGE ? element[a] : kind[b] == ON_EDGE ? element[b] : -1;
+         int pa = E >= 0 ? along( a, E ) : -1;
+         int pb = E >= 0 ? along( b, E ) : -1;
+
+         if( pa >= 0 && pb >= 0 )
+         {
+            kind[v]    = ON_EDGE;
+            element[v] = E;
+            param[v]   = ( pa + pb ) / 2;
+         }
+         else
+         {
+            kind[v]    = INSIDE;
+            element[v] = parent[ edges.cornerFace[ edges.edgeCorner[2*e] ]];
+         }
+      }
+
+      for( int i=0; i<nNew-nVertices-nEdges; i++ )
+      {
+         kind   [nVertices+nEdges+i] = INSIDE;
+         element[nVertices+nEdges+i] = parent[i];
+      }
+
+      // subdivideLevel() replaces each face by 4 triangles or n quads, in order
+      vector<int> children;
+      children.reserve( triangles ? 4*nFaces : nCorners );
+      for( int i=0; i<nFaces; i++ )
+      {
+         int n = triangles ? 4 : mesh.faceStart[i+1] - mesh.faceStart[i];
+         children.insert( children.end(), n, parent[i] );
+      }
+      parent.swap( children );
+
+      if( !subdivideLevel( mesh ))
+      {
+         return false;
+      }
+   }
+
+   return true;
+}
+
+// =============================================================================
+// =============================================================================
+// makeStamp() collects the subdivided faces of face i of the template.
+static void makeStamp( const Mesh&        coarse,
+                       const Edges&       coarseEdges,
+                       const Mesh&        fine,
+                       int                i,
+                       int                first,
+                       int                last,
+                       const vector<int>& kind,
+                       const vector<int>& element,
+                       const vector<int>& param,
+                       int                segments,
+                       vector<int>&       local,
+                       Stamp&             stamp )
+{
+   int start = coarse.faceStart[i];
+   int n     = coarse.faceStart[i+1] - start;
+
+   stamp.nInside = 0;
+   stamp.faceStart.push_back( 0 );
+
+   for( int f=first; f<last; f++ )
+   {
+      for( int j=fine.faceStart[f]; j<fine.faceStart[f+1]; j++ )
+      {
+         int v = fine.faceIndex[j];
+
+         if( local[v] < 0 )
+         {
+            int k = 0, t = 0;
+
+            if( kind[v] == ON_VERTEX )
+            {
+               while( k < n && coarse.faceIndex[start+k] != element[v] ) k++;
+            }
+            else if( kind[v] == ON_EDGE )
+            {
+               while( k < n && coarseEdges.cornerEdge[start+k] != element[v] ) k++;
+               t = coarse.faceIndex[start+k] == coarseEdges.edgeVertex[2*element[v]] ?
+                   param[v] : segments - param[v];
+            }
+            else
+            {
+               t = stamp.nInside++;
+            }
+
+            local[v] = (int) stamp.kind.size();
+            stamp.kind.push_back( kind[v] );
+            stamp.corner.push_back( k );
+            stamp.index.push_back( t );
+            stamp.source.push_back( v );
+         }
+
+         stamp.faceIndex.push_back( local[v] );
+      }
+      stamp.faceStart.push_back( (int) stamp.faceIndex.size() );
+   }
+
+   for( size_t j=0; j<stamp.source.size(); j++ )
+   {
+      local[ stamp.source[j] ] = -1;
+   }
+}
+
+// =============================================================================
+// =============================================================================
+// stampPattern() replaces mesh, the tiling generated at rows x cols, by its
+// subdivision, stamped out from a subdivided template.  The template is the
+// same pattern at a size congruent to the tiling's modulo the period, so
+// that the faces near its boundary match the faces near the tiling's.  Each
+// face of the tiling is matched to the face of the template an exact number
+// of periods away whose surroundings, up to REACH, are the same.  Returns
+// false, leaving mesh as it was, if the pattern has no known period, the
+// tiling is too small for stamping to pay off, or anything doesn't line up.
+static bool stampPattern( const string& patternName,
+                          int           rows,
+                          int           cols,
+                          int           levels,
+                          Mesh&         mesh )
+{
+   int p = 0, nPeriods = sizeof(periods)/sizeof(periods[0]);
+   while( p < nPeriods && patternName != periods[p].name ) p++;
+   if( p == nPeriods )
+   {
+      return false;
+   }
+
+   // template size, congruent to the tiling's and large enough to hold a
+   // face with REACH on either side of it away from both boundaries
+   int periodCols = periods[p].columns, periodRows = periods[p].rows;
+   int minimum    = 4*REACH;
+   int tCols      = cols - ( cols - minimum - periodCols ) / periodCols * periodCols;
+   int tRows      = rows - ( rows - minimum - periodRows ) / periodRows * periodRows;
+
+   if( cols < 2*( minimum + 2*periodCols ) || rows < 2*( minimum + 2*periodRows ))
+   {
+      return false;
+   }
+
+   // subdivide the template, keeping track of where everything came from
+   Mesh tiling( mesh.channels );
+   if( !generatePattern( patternName, tRows, tCols, tiling ))
+   {
+      return false;
+   }
+
+   Edges tilingEdges;
+   findEdges( tiling, tilingEdges );
+
+   Mesh        fine = tiling;
+   vector<int> kind, element, param, parent;
+   if( !tagSubdivide( fine, levels, tilingEdges, kind, element, param, parent ))
+   {
+      return false;
+   }
+
+   int tFaces = (int) tiling.faceStart.size() - 1;
+   vector<int> blockStart( tFaces+1, 0 );
+   for( size_t f=0; f<parent.size(); f++ ) blockStart[ parent[f]+1 ]++;
+   for( int i=0; i<tFaces; i++ ) blockStart[i+1] += blockStart[i];
+
+   // template faces by their first two corners
+   unordered_map<long long,int> faceOf;
+   for( int i=0; i<tFaces; i++ )
+   {
+      int start = tiling.faceStart[i];
+      faceOf[ (long long) tiling.faceIndex[start] * tRows * tCols + tiling.faceIndex[start+1] ] = i;
+   }
+
+   // match every face of the tiling with a face of the template ----------
+   Edges edges;
+   findEdges( mesh, edges );
+
+   int nVertices = (int) mesh.vertex.size() / 3;
+   int nEdges    = (int) edges.edgeFaces.size();
+   int nFaces    = (int) mesh.faceStart.size() - 1;
+   int segments  = 1 << levels;
+
+   vector<int>       twin( nFaces );
+   vector<long long> insideStart( nFaces+1, 0 );
+   vector<Stamp>     stamps( tFaces );
+   vector<int>       local( kind.size(), -1 );
+   long long         nFineFaces = 0, nFineCorners = 0;
+
+   // the shift, a whole number of periods, that takes lattice column (or
+   // row) x of a tiling of size n to a column of the template with the same
+   // surroundings
+   auto shift = [&]( int x, int n, int tn, int period )
+   {
+      if( x < 2*REACH     ) return 0;
+      if( x >= n-2*REACH  ) return n-tn;
+      return ( x - 2*REACH ) / period * period;
+   };
+
+   for( int i=0; i<nFaces; i++ )
+   {
+      int start = mesh.faceStart[i];
+      int n     = mesh.faceStart[i+1] - start;
+      int x     = mesh.faceIndex[start] % cols;
+      int y     = mesh.faceIndex[start] / cols;
+      int dx    = shift( x, cols, tCols, periodCols );
+      int dy    = shift( y, rows, tRows, periodRows );
+
+      // the corners of the face, moved into the template
+      auto moved = [&]( int k )
+      {
+         int v = mesh.faceIndex[ start + k%n ];
+         int u = v % cols - dx, w = v / cols - dy;
+         return u >= 0 && u < tCols && w >= 0 && w < tRows ? u + w*tCols : -1;
+      };
+
+      int a = moved( 0 ), b = moved( 1 );
+      unordered_map<long long,int>::const_iterator match =
+         a < 0 || b < 0 ? faceOf.end() : faceOf.find( (long long) a * tRows * tCols + b );
+      if( match == faceOf.end() )
+      {
+         return false;
+      }
+
+      int t      = match->second;
+      int tStart = tiling.faceStart[t];
+      if( tiling.faceStart[t+1] - tStart != n )
+      {
+         return false;
+      }
+      for( int k=0; k<n; k++ )
+      {
+         if( moved( k ) != tiling.faceIndex[tStart+k] )
+         {
+            return false;
+         }
+      }
+
+      twin[i] = t;
+
+      Stamp& stamp = stamps[t];
+      if( stamp.nInside < 0 )
+      {
+         makeStamp( tiling, tilingEdges, fine, t, blockStart[t], blockStart[t+1],
+                    kind, element, param, segments, local, stamp );
+      }
+
+      insideStart[i+1] = insideStart[i] + stamp.nInside;
+      nFineFaces      += (int) stamp.faceStart.size() - 1;
+      nFineCorners    += (int) stamp.faceIndex.size();
+   }
+
+   long long nFineVertices = (long long) nVertices + (long long) nEdges * ( segments-1 ) + insideStart[nFaces];
+   if( nFineVertices + nFineCorners + nFineFaces > INT_MAX/3 || nFineCorners > INT_MAX )
+   {
+      return false;
+   }
+
+   // stamp the subdivided faces out ----------------------------------------
+   Mesh result( mesh.channels );
+   int  insideOffset = nVertices + nEdges * ( segments-1 );
+
+   // unused vertices of the tiling stay where they are
+   result.vertex = mesh.vertex;
+   result.uv     = mesh.uv;
+   result.normal = mesh.normal;
+   result.vertex.resize( 3*nFineVertices );
+   result.uv.resize( mesh.uv.empty() ? 0 : 2*nFineVertices );
+   result.normal.resize( mesh.normal.empty() ? 0 : 3*nFineVertices );
+   result.faceStart.reserve( nFineFaces+1 );
+   result.faceIndex.reserve( nFineCorners );
+   if( mesh.channels & CHANNEL_CLASS ) result.faceClass.reserve( nFineFaces );
+
+   // copy channel values from the template, moved along with the face
+   auto copy = [&]( const vector<float>& in, const vector<float>& coarse, const vector<float>& tCoarse,
+                    vector<float>& out, int dim, int v, int source, int corner, int tCorner )
+   {
+      for( int c=0; c<dim; c++ )
+      {
+         out[ (size_t) dim*v+c ] = in[ (size_t) dim*source+c ] +
+                                   ( coarse[ (size_t) dim*corner+c ] - tCoarse[ (size_t) dim*tCorner+c ] );
+      }
+   };
+
+   for( int i=0; i<nFaces; i++ )
+   {
+      int          start   = mesh.faceStart[i];
+      const Stamp& stamp   = stamps[ twin[i] ];
+      int          corner  = mesh.faceIndex[start];
+      int          tCorner = tiling.faceIndex[ tiling.faceStart[ twin[i] ]];
+
+      local.resize( stamp.kind.size() );
+
+      for( size_t j=0; j<stamp.kind.size(); j++ )
+      {
+         int k = start + stamp.corner[j];
+         int v;
+
+         if( stamp.kind[j] == ON_VERTEX )
+         {
+            v = mesh.faceIndex[k];
+         }
+         else if( stamp.kind[j] == ON_EDGE )
+         {
+            int e = edges.cornerEdge[k];
+            int t = mesh.faceIndex[k] == edges.edgeVertex[2*e] ? stamp.index[j] : segments - stamp.index[j];
+            v = nVertices + e * ( segments-1 ) + t-1;
+         }
+         else
+         {
+            v = insideOffset + (int) insideStart[i] + stamp.index[j];
+         }
+
+         local[j] = v;
+
+         copy( fine.vertex, mesh.vertex, tiling.vertex, result.vertex, 3, v, stamp.source[j], corner, tCorner );
+         if( !mesh.uv.empty()     ) copy( fine.uv,     mesh.uv,     tiling.uv,     result.uv,     2, v, stamp.source[j], corner, tCorner );
+         if( !mesh.normal.empty() ) copy( fine.normal, mesh.normal, tiling.normal, result.normal, 3, v, stamp.source[j], corner, tCorner );
+      }
+
+      for( size_t f=0; f+1<stamp.faceStart.size(); f++ )
+      {
+         for( int j=stamp.faceStart[f]; j<stamp.faceStart[f+1]; j++ )
+         {
+            result.faceIndex.push_back( local[ stamp.faceIndex[j] ] );
+         }
+         result.faceStart.push_back( (int) result.faceIndex.size() );
+         if( mesh.channels & CHANNEL_CLASS ) result.faceClass.push_back( mesh.faceClass[i] );
+      }
+   }
+
+   swap( mesh, result );
+
+   return true;
+}
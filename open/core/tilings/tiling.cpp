@@ -5,7 +5,7 @@
 //              Wavefront OBJ files.  Note that the OBJ files generated by this
 //              program are fairly sloppy and may include unused vertices.
 // USAGE:
-//    tiling pattern rows columns out
+//    tiling [options] pattern rows columns out
 //
 //              pattern - name of the tiling.  Valid names for regular tilings
 //                        include "square", "triangle", and "hexagon".  Valid
@@ -20,41 +20,130 @@
 //
 //              out - output filename (i.e., where the OBJ will be stored)
 //
+//              options - any of
+//
+//                 --uvs - also write texture coordinates ("vt"), which are
+//                         the planar positions in units of the edge length
+//
+//                 --normals - also write normals ("vn")
+//
+//                 --classes - group the faces by the kind of tile they are
+//                             ("g triangle", "g square", "g hexagon",
+//                             "g octagon" or "g dodecagon")
+//
+//                 --subdiv K - subdivide the tiling K times (Loop for the
+//                              triangle lattice, Catmull-Clark otherwise,
+//                              with the boundary held fixed)
+//
+//                 --binary - write the raw binary layout described by
+//                            BinaryHeader in tiling.h instead of an OBJ; the
+//                            options above add buffers to it
+//
+//                 --shards RxC - instead of one OBJ, split the tiling into
+//                                an R x C grid of spatial tiles.  Tile (r,c)
+//                                is written to "out_r_c.obj" (any ".obj"
+//                                suffix of out is dropped) and a small index
+//                                describing every tile is written to
+//                                "out.shards".  See writeShards() for the
+//                                layout of both.
+//
+// BUILD:
+//    g++ -O2 -pthread -o tiling tiling.cpp patterns.cpp subdivide.cpp
+//
 // LICENSE:
 //    As the sole author of this code I hereby release it into the public
 //    domain.
 //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include "tiling.h"
+
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <vector>
+#include <unordered_map>
+#include <thread>
+#include <atomic>
+#include <algorithm>
 #include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
 
 using namespace std;
 
 void printHelp( void );
 
-void generatePattern( string patternName, int rows, int cols, ofstream& out );
-
-void   square( int rows, int cols, ofstream& out );
-void triangle( int rows, int cols, ofstream& out );
-void  hexagon( int rows, int cols, ofstream& out );
-void    semi1( int rows, int cols, ofstream& out );
-void    semi2( int rows, int cols, ofstream& out );
-void    semi3( int rows, int cols, ofstream& out );
-void    semi4( int rows, int cols, ofstream& out );
-void    semi5( int rows, int cols, ofstream& out );
-void    semi6( int rows, int cols, ofstream& out );
-void    semi7( int rows, int cols, ofstream& out );
-void    semi8( int rows, int cols, ofstream& out );
+void writeVertex( ostream& out, const Mesh& mesh, int v );
+void   writeFace( ostream& out, const Mesh& mesh, int i, const int* local, int& group );
+void    writeOBJ( const Mesh& mesh, ostream& out );
+bool writeBinary( const Mesh& mesh, const char* fileName );
+bool writeShards( const Mesh& mesh, int shardRows, int shardCols,
+                  string outName );
 
 // =============================================================================
 // =============================================================================
 int main( int argc, char **argv )
 {
+   // strip off any options that precede the pattern name
+   int  shardRows = 0, shardCols = 0;
+   int  channels  = 0;
+   int  levels    = 0;
+   bool binary    = false;
+   int  arg = 1;
+
+   for( ; arg < argc && string(argv[arg]).compare( 0, 2, "--" ) == 0; arg++ )
+   {
+      string option = argv[arg];
+
+      if( option == "--uvs"     ) { channels |= CHANNEL_UV;     continue; }
+      if( option == "--normals" ) { channels |= CHANNEL_NORMAL; continue; }
+      if( option == "--classes" ) { channels |= CHANNEL_CLASS;  continue; }
+      if( option == "--binary"  ) { binary = true;              continue; }
+
+      if( option == "--subdiv" )
+      {
+         if( arg+1 >= argc || sscanf( argv[arg+1], "%d", &levels ) != 1 || levels < 0 )
+         {
+            cerr << "Error: --subdiv expects a number of levels" << endl;
+            exit( 1 );
+         }
+
+         arg++;
+         continue;
+      }
+
+      if( option == "--shards" )
+      {
+         if( arg+1 >= argc ||
+             sscanf( argv[arg+1], "%dx%d", &shardRows, &shardCols ) != 2 ||
+             shardRows <= 0 || shardCols <= 0 )
+         {
+            cerr << "Error: --shards expects a grid size such as 4x4" << endl;
+            exit( 1 );
+         }
+         if( (long long) shardRows * shardCols > INT_MAX )
+         {
+            cerr << "Error: too many shards ( " << shardRows << " x " << shardCols << " )" << endl;
+            exit( 1 );
+         }
+
+         arg++;
+         continue;
+      }
+
+      cerr << "Error: unknown option " << option << endl;
+      exit( 1 );
+   }
+
+   if( binary && shardRows > 0 )
+   {
+      cerr << "Error: --binary and --shards can't be combined" << endl;
+      exit( 1 );
+   }
+
    // check that we have the right number of arguments
-   if( argc != 5 )
+   if( argc-arg != 4 )
    {
       // print help if requested
       if( argc >= 2 && string(argv[1]) == "-help" )
@@ -63,7 +152,7 @@ int main( int argc, char **argv )
       }
       else // otherwise print usage
       {
-         cerr << "usage: " << argv[0] << "pattern rows columns out" << endl;
+         cerr << "usage: " << argv[0] << " [options] pattern rows columns out" << endl;
          cerr << "       (type -help for more options)" << endl;
       }
 
@@ -71,24 +160,58 @@ int main( int argc, char **argv )
    }
 
    // get the size of the pattern
-   int rows = atoi( argv[2] );
-   int cols = atoi( argv[3] );
+   int rows = atoi( argv[arg+1] );
+   int cols = atoi( argv[arg+2] );
    if( rows <= 0 || cols <= 0 )
    {
       cerr << "Error: invalid size ( " << rows << " x " << cols << " )" << endl;
       exit( 1 );
    }
 
-   // open a file for output
-   ofstream out( argv[4] );
+   // parse the pattern name and generate the corresponding tiling
+   Mesh mesh( channels );
+   if( !subdividePattern( argv[arg], rows, cols, levels, mesh ))
+   {
+      exit( 1 );
+   }
+
+   // write it out as spatial shards, a single OBJ, or binary
+   if( binary )
+   {
+      if( !writeBinary( mesh, argv[arg+3] ))
+      {
+         exit( 1 );
+      }
+
+      return 0;
+   }
+
+   if( shardRows > 0 )
+   {
+      // an empty shard is fine, but a grid finer than the tiling is a mistake
+      if( (long long) shardRows * shardCols > (long long) mesh.vertex.size() / 3 )
+      {
+         cerr << "Error: " << shardRows << " x " << shardCols << " shards are more than the "
+              << mesh.vertex.size() / 3 << " vertices of the tiling" << endl;
+         exit( 1 );
+      }
+
+      if( !writeShards( mesh, shardRows, shardCols, argv[arg+3] ))
+      {
+         exit( 1 );
+      }
+
+      return 0;
+   }
+
+   ofstream out( argv[arg+3] );
    if( !out.is_open())
    {
-      cerr << "Error: couldn't open file " << argv[4] << " for output." << endl;
+      cerr << "Error: couldn't open file " << argv[arg+3] << " for output." << endl;
       exit( 1 );
    }
 
-   // parse the pattern name and generate the corresponding tiling
-   generatePattern( argv[1], rows, cols, out );
+   writeOBJ( mesh, out );
 
    out.close();
 
@@ -105,7 +228,7 @@ void printHelp( void )
    cerr << "              Wavefront OBJ files.  Note that the OBJ files generated by this   "       << endl;
    cerr << "              program are fairly sloppy and may include unused vertices.        "       << endl;
    cerr << " USAGE:                                                                         "       << endl;
-   cerr << "    tiling pattern rows columns out                                             "       << endl;
+   cerr << "    tiling [options] pattern rows columns out                                   "       << endl;
    cerr << "                                                                                "       << endl;
    cerr << "              pattern - name of the tiling.  Valid names for regular tilings    "       << endl;
    cerr << "                        include \"square\", \"triangle\", and \"hexagon\".  Valid     " << endl;
@@ -120,6 +243,23 @@ void printHelp( void )
    cerr << "                                                                                "       << endl;
    cerr << "              out - output filename (i.e., where the OBJ will be stored)        "       << endl;
    cerr << "                                                                                "       << endl;
+   cerr << "              options - any of                                                  "       << endl;
+   cerr << "                                                                                "       << endl;
+   cerr << "                 --uvs - also write texture coordinates (\"vt\")                  "     << endl;
+   cerr << "                                                                                "       << endl;
+   cerr << "                 --normals - also write normals (\"vn\")                          "     << endl;
+   cerr << "                                                                                "       << endl;
+   cerr << "                 --classes - group the faces by the kind of tile they are       "       << endl;
+   cerr << "                                                                                "       << endl;
+   cerr << "                 --subdiv K - subdivide the tiling K times                      "       << endl;
+   cerr << "                                                                                "       << endl;
+   cerr << "                 --binary - write a raw binary mesh instead of an OBJ           "       << endl;
+   cerr << "                                                                                "       << endl;
+   cerr << "                 --shards RxC - instead of one OBJ, split the tiling into an    "       << endl;
+   cerr << "                                R x C grid of spatial tiles written to          "       << endl;
+   cerr << "                                \"out_r_c.obj\", plus an index \"out.shards\"     "     << endl;
+   cerr << "                                listing the bounds and counts of every tile.    "       << endl;
+   cerr << "                                                                                "       << endl;
    cerr << " LICENSE:                                                                       "       << endl;
    cerr << "    As the sole author of this program I hereby release it into the public      "       << endl;
    cerr << "    domain.                                                                     "       << endl;
@@ -128,701 +268,346 @@ void printHelp( void )
 
 // =============================================================================
 // =============================================================================
-void generatePattern( string    patternName,
-                      int       rows,
-                      int       cols,
-                      ofstream& out )
-{
-   if( patternName == "square"   ) {   square( rows, cols, out ); return; }
-   if( patternName == "triangle" ) { triangle( rows, cols, out ); return; }
-   if( patternName == "hexagon"  ) {  hexagon( rows, cols, out ); return; }
-   if( patternName == "semi1"    ) {    semi1( rows, cols, out ); return; }
-   if( patternName == "semi2"    ) {    semi2( rows, cols, out ); return; }
-   if( patternName == "semi3"    ) {    semi3( rows, cols, out ); return; }
-   if( patternName == "semi4"    ) {    semi4( rows, cols, out ); return; }
-   if( patternName == "semi5"    ) {    semi5( rows, cols, out ); return; }
-   if( patternName == "semi6"    ) {    semi6( rows, cols, out ); return; }
-   if( patternName == "semi7"    ) {    semi7( rows, cols, out ); return; }
-   if( patternName == "semi8"    ) {    semi8( rows, cols, out ); return; }
-
-   cerr << "Error: unknown pattern." << endl;
-}
-
-// =============================================================================
-// =============================================================================
-void square( int       rows,
-             int       cols,
-             ofstream& out )
+void writeVertex( ostream&    out,
+                  const Mesh& mesh,
+                  int         v )
 {
-   // write vertices -------------------------------------------------
-   float px, py;
+   // all tilings lie in the z=0 plane
+   out << "v " << mesh.vertex[3*v+0] << " " << mesh.vertex[3*v+1] << " 0.0\n";
 
-   for( int y=0; y<rows; y++ )
+   if( mesh.channels & CHANNEL_UV )
    {
-      for( int x=0; x<cols; x++ )
-      {
-         px = x;
-         py = y;
-
-         out << "v " << px << " " << py << " 0.0" << endl;
-      }
+      out << "vt " << mesh.uv[2*v+0] << " " << mesh.uv[2*v+1] << "\n";
    }
 
-   // write faces ----------------------------------------------------
-   for( int y=0; y<rows-1; y++ )
+   if( mesh.channels & CHANNEL_NORMAL )
    {
-      for( int x=0; x<cols-1; x++ )
-      {
-         out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                     << ((x+1)+(y+0)*cols)+1 << " "
-                     << ((x+1)+(y+1)*cols)+1 << " "
-                     << ((x+0)+(y+1)*cols)+1 << endl;
-      }
+      out << "vn " << mesh.normal[3*v+0] << " "
+                   << mesh.normal[3*v+1] << " "
+                   << mesh.normal[3*v+2] << "\n";
    }
 }
 
 // =============================================================================
 // =============================================================================
-void triangle( int       rows,
-               int       cols,
-               ofstream& out )
+// writeFace() writes face i; if local[] is given, local[k] replaces the
+// index of its k-th vertex.  With CHANNEL_CLASS a group statement is written whenever the
+// tile class differs from the previous face's, which is tracked in group.
+void writeFace( ostream&    out,
+                const Mesh& mesh,
+                int         i,
+                const int*  local,
+                int&        group )
 {
-   // write vertices -------------------------------------------------
-   float px, py;
-
-   for( int y=0; y<rows; y++ )
+   if( mesh.channels & CHANNEL_CLASS && mesh.faceClass[i] != group )
    {
-      for( int x=0; x<cols; x++ )
-      {
-         px = x + 0.5f*y;
-         py = y * sqrtf(3.0f)/2.0f;
-
-         out << "v " << px << " " << py << " 0.0" << endl;
-      }
+      group = mesh.faceClass[i];
+      out << "g " << tileClassNames[group] << "\n";
    }
 
-   // write faces ----------------------------------------------------
-   for( int y=0; y<rows-1; y++ )
+   bool uv     = mesh.channels & CHANNEL_UV;
+   bool normal = mesh.channels & CHANNEL_NORMAL;
+
+   out << "f";
+   for( int j=mesh.faceStart[i]; j<mesh.faceStart[i+1]; j++ )
    {
-      for( int x=0; x<cols-1; x++ )
-      {
-         out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                     << ((x+1)+(y+0)*cols)+1 << " "
-                     << ((x+0)+(y+1)*cols)+1 << endl;
+      int v = ( local ? local[ j-mesh.faceStart[i] ] : mesh.faceIndex[j] ) + 1;
 
-         out << "f " << ((x+1)+(y+0)*cols)+1 << " "
-                     << ((x+1)+(y+1)*cols)+1 << " "
-                     << ((x+0)+(y+1)*cols)+1 << endl;
-      }
+      out << " " << v;
+      if( uv || normal ) out << "/";
+      if( uv           ) out << v;
+      if( normal       ) out << "/" << v;
    }
+   out << "\n";
 }
 
 // =============================================================================
 // =============================================================================
-void hexagon( int       rows,
-              int       cols,
-              ofstream& out )
+void writeOBJ( const Mesh& mesh,
+               ostream&    out )
 {
-   // write vertices -------------------------------------------------
-   float px, py;
+   int nVertices = (int) mesh.vertex.size() / 3;
+   int nFaces    = (int) mesh.faceStart.size() - 1;
+   int group     = -1;
 
-   for( int y=0; y<rows; y++ )
+   for( int i=0; i<nVertices; i++ )
    {
-      for( int x=0; x<cols; x++ )
-      {
-         px = floorf((x+(y%2))/2.0f)*3.0f + ((x+y)%2) - (y%2)*1.5f;
-         py = y * sqrtf(3.0f)/2.0f;
-
-         out << "v " << px << " " << py << " 0.0" << endl;
-      }
+      writeVertex( out, mesh, i );
    }
 
-   // write faces ----------------------------------------------------
-   for( int y=0; y<rows-2; y++ )
+   for( int i=0; i<nFaces; i++ )
    {
-      for( int x=0; x<cols-1; x++ )
-      {
-         if(( y%2 == 0 && x%2 == 0 ) ||
-            ( y%2 == 1 && x%2 == 1 ))
-         {
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+1)*cols)+1 << " "
-                        << ((x+1)+(y+2)*cols)+1 << " "
-                        << ((x+0)+(y+2)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << endl;
-         }
-      }
+      writeFace( out, mesh, i, NULL, group );
    }
 }
 
 // =============================================================================
 // =============================================================================
-void semi1( int       rows,
-            int       cols,
-            ofstream& out )
+bool writeBinary( const Mesh& mesh,
+                  const char* fileName )
 {
-   // write vertices -------------------------------------------------
-   float px, py;
+   // int storage keeps the buffer aligned the way packBinary() needs
+   vector<int> buffer( (binarySize( mesh ) + sizeof(int)-1) / sizeof(int) );
+   packBinary( mesh, (char*) buffer.data() );
 
-   for( int y=0; y<rows; y++ )
+   ofstream out( fileName, ios::binary );
+   if( !out.is_open())
    {
-      for( int x=0; x<cols; x++ )
-      {
-         px = x + 0.5f*y;
-         py = y * sqrtf(3.0f)/2.0f;
-
-         out << "v " << px << " " << py << " 0.0" << endl;
-      }
+      cerr << "Error: couldn't open file " << fileName << " for output." << endl;
+      return false;
    }
 
-   // write faces ----------------------------------------------------
-   for( int y=1; y<rows-1; y++ )
-   {
-      for( int x=1; x<cols-1; x++ )
-      {
-         int i = (x+3*y)%7;
-
-         if( i == 0 ||
-             i == 2 ||
-             i >= 5 )
-         {
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+0)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << endl;
-         }
-
-         if( i == 2 ||
-             i >= 4 )
-         {
-            out << "f " << ((x+1)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+1)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << endl;
-         }
+   out.write( (const char*) buffer.data(), binarySize( mesh ));
 
-         if( i == 4 )
-         {
-            out << "f " << ((x+1)+(y+0)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << " "
-                        << ((x-1)+(y+1)*cols)+1 << " "
-                        << ((x-1)+(y+0)*cols)+1 << " "
-                        << ((x+0)+(y-1)*cols)+1 << " "
-                        << ((x+1)+(y-1)*cols)+1 << endl;
-         }
-      }
-   }
+   return out.good();
 }
 
 // =============================================================================
 // =============================================================================
-void semi2( int       rows,
-            int       cols,
-            ofstream& out )
+// writeShards() cuts the bounding box of the tiling into a shardRows x
+// shardCols grid of equal cells.  Every vertex is owned by the cell containing
+// it and every face by the cell containing its centroid.  A shard file lists
+// the vertices its shard owns first, then "ghost" copies of the vertices owned
+// by a neighbouring shard that its faces also touch, and finally its faces,
+// numbered locally.  Each ghost is followed by a comment
+//
+//    # ghost <local index> <owner shard row> <owner shard col> <global index>
+//
+// so a consumer can stitch neighbouring shards back together.  Global indices
+// number the owned vertices shard by shard in row-major shard order: the
+// vertices owned by a shard are global indices vertexOffset+1 onwards, in
+// the same order they appear in its file.  Faces are likewise numbered from
+// faceOffset.  The index file holds one line per shard:
+//
+//    shard <row> <col> <file> <xmin> <ymin> <xmax> <ymax>
+//          <vertices> <ghosts> <faces> <vertexOffset> <faceOffset>
+//
+// Shards are independent once the partition is known, so they are written by
+// a pool of threads.  Ownership and the local index of every owned vertex are
+// computed once up front; each shard only keeps a map of its own ghosts.
+bool writeShards( const Mesh& mesh,
+                  int         shardRows,
+                  int         shardCols,
+                  string      outName )
 {
-   // write vertices -------------------------------------------------
-   float px, py;
+   int nVertices = (int) mesh.vertex.size() / 3;
+   int nFaces    = (int) mesh.faceStart.size() - 1;
+   int nShards   = shardRows * shardCols;
 
-   for( int y=0; y<rows; y++ )
+   if( outName.size() > 4 && outName.compare( outName.size()-4, 4, ".obj" ) == 0 )
    {
-      for( int x=0; x<cols; x++ )
-      {
-         px = floorf(x/2.0f)*(2.0f+sqrtf(2.0f)) + (x%2) +
-              floorf(y/2.0f)*(1.0f+sqrtf(2.0f)/2.0f);
-         py = floorf(y/2.0f)*(1.0f+sqrtf(2.0f)/2.0f) + (y%2);
-
-         out << "v " << px << " " << py << " 0.0" << endl;
-      }
+      outName.erase( outName.size()-4 );
    }
 
-   // write faces ----------------------------------------------------
-   for( int y=1; y<rows-2; y++ )
-   {
-      for( int x=1; x<cols-2; x++ )
-      {
-         if( x%2 == 1 && y%2 == 0 )
-         {
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y-1)*cols)+1 << " "
-                        << ((x+2)+(y-1)*cols)+1 << " "
-                        << ((x+1)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+1)*cols)+1 << " "
-                        << ((x+0)+(y+2)*cols)+1 << " "
-                        << ((x-1)+(y+2)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << endl;
-         }
-      }
-   }
-   
-   for( int y=0; y<rows-1; y++ )
+   // bounding box of the whole tiling ---------------------------------
+   float xmin =  INFINITY, ymin =  INFINITY;
+   float xmax = -INFINITY, ymax = -INFINITY;
+
+   for( int i=0; i<nVertices; i++ )
    {
-      for( int x=0; x<cols-1; x++ )
-      {
-         if( x%2 == 0 && y%2 == 0 )
-         {
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+1)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << endl;
-         }
-      }
+      xmin = min( xmin, mesh.vertex[3*i+0] );
+      xmax = max( xmax, mesh.vertex[3*i+0] );
+      ymin = min( ymin, mesh.vertex[3*i+1] );
+      ymax = max( ymax, mesh.vertex[3*i+1] );
    }
-}
 
-// =============================================================================
-// =============================================================================
-void semi3( int       rows,
-            int       cols,
-            ofstream& out )
-{
-   // write vertices -------------------------------------------------
-   float px, py;
+   float cellWidth  = nVertices > 0 ? (xmax-xmin) / shardCols : 0.0f;
+   float cellHeight = nVertices > 0 ? (ymax-ymin) / shardRows : 0.0f;
 
-   for( int y=0; y<rows; y++ )
+   auto cellOf = [&]( float px, float py )
    {
-      for( int x=0; x<cols; x++ )
-      {
-         px = x + floorf(y/2.0f)*0.5f;
-         py = floorf(y/2.0f)*(1.0f+sqrtf(3.0f)/2.0f) + (y%2);
-
-         out << "v " << px << " " << py << " 0.0" << endl;
-      }
-   }
-
-   // write faces ----------------------------------------------------
-   for( int y=0; y<rows-1; y++ )
+      int c = cellWidth  > 0.0f ? (int)((px-xmin) / cellWidth ) : 0;
+      int r = cellHeight > 0.0f ? (int)((py-ymin) / cellHeight) : 0;
+      c = max( 0, min( shardCols-1, c ));
+      r = max( 0, min( shardRows-1, r ));
+      return r*shardCols + c;
+   };
+
+   // assign vertices and faces to shards, bucketing them by shard -----
+   vector<int> vertexShard( nVertices ), vertexRank( nVertices );
+   vector<int> vertexCount( nShards, 0 ), faceCount( nShards, 0 );
+
+   for( int i=0; i<nVertices; i++ )
    {
-      for( int x=0; x<cols-1; x++ )
-      {
-         if( y%2 == 0 )
-         {
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+1)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << endl;
-         }
-         else
-         {
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+0)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << endl;
-            out << "f " << ((x+1)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+1)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << endl;
-         }
-      }
+      int s = cellOf( mesh.vertex[3*i+0], mesh.vertex[3*i+1] );
+      vertexShard[i] = s;
+      vertexRank[i]  = vertexCount[s]++;
    }
-}
 
-// =============================================================================
-// =============================================================================
-void semi4( int       rows,
-            int       cols,
-            ofstream& out )
-{
-   // write vertices -------------------------------------------------
-   float px, py;
+   vector<int> faceShard( nFaces );
 
-   for( int y=0; y<rows; y++ )
+   for( int i=0; i<nFaces; i++ )
    {
-      for( int x=0; x<cols; x++ )
-      {
-         px = x+0.5f*y;
-         py = y*sqrtf(3.0f)/2.0f;
+      float cx = 0.0f, cy = 0.0f;
+      int n = mesh.faceStart[i+1] - mesh.faceStart[i];
 
-         out << "v " << px << " " << py << " 0.0" << endl;
+      for( int j=mesh.faceStart[i]; j<mesh.faceStart[i+1]; j++ )
+      {
+         cx += mesh.vertex[3*mesh.faceIndex[j]+0];
+         cy += mesh.vertex[3*mesh.faceIndex[j]+1];
       }
+
+      int s = cellOf( cx/n, cy/n );
+      faceShard[i] = s;
+      faceCount[s]++;
    }
 
+   vector<int> vertexOffset( nShards+1, 0 ), faceOffset( nShards+1, 0 );
 
-   // write faces ----------------------------------------------------
-   for( int y=0; y<rows-2; y++ )
+   for( int s=0; s<nShards; s++ )
    {
-      for( int x=1; x<cols-1; x++ )
-      {
-         if( x%2 == 0 && y%2 == 0 )
-         {
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+0)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << endl;
-         }
-
-         if( x%2 == 0 && y%2 == 1 )
-         {
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << " "
-                        << ((x-1)+(y+1)*cols)+1 << endl;
-         }
-
-         if( x%2 == 1 && y%2 == 0 )
-         {
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+1)*cols)+1 << " "
-                        << ((x+0)+(y+2)*cols)+1 << " "
-                        << ((x-1)+(y+2)*cols)+1 << " "
-                        << ((x-1)+(y+1)*cols)+1 << endl;
-         }
-      }
+      vertexOffset[s+1] = vertexOffset[s] + vertexCount[s];
+        faceOffset[s+1] =   faceOffset[s] +   faceCount[s];
    }
-}
 
-// =============================================================================
-// =============================================================================
-void semi5( int       rows,
-            int       cols,
-            ofstream& out )
-{
-   // write vertices -------------------------------------------------
-   float px, py;
+   vector<int> shardVertices( nVertices ), shardFaces( nFaces );
 
-   for( int y=0; y<rows; y++ )
+   for( int i=0; i<nVertices; i++ )
    {
-      for( int x=0; x<cols; x++ )
-      {
-         px = floorf(x/2.0f)*(1.0f+sqrtf(3.0f)/2.0f) + (x%2) -
-              floorf(y/2.0f)*0.5f;
-         py = floorf(y/2.0f)*(1.0f+sqrtf(3.0f)/2.0f) + (y%2) +
-              floorf(x/2.0f)*0.5f;
-
-         out << "v " << px << " " << py << " 0.0" << endl;
-      }
+      shardVertices[ vertexOffset[vertexShard[i]] + vertexRank[i] ] = i;
    }
 
-   // write faces ----------------------------------------------------
-   for( int y=0; y<rows-1; y++ )
-   {
-      for( int x=1; x<cols-1; x++ )
-      {
-         if( x%2 == 0 && y%2 == 0 )
-         {
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+1)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << endl;
-
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << " "
-                        << ((x-1)+(y+1)*cols)+1 << endl;
-         }
-
-         if( x%2 == 1 && y%2 == 0 )
-         {
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+0)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << endl;
-         }
-
-         if( x%2 == 0 && y%2 == 1 )
-         {
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+1)*cols)+1 << endl;
-
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+1)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << endl;
-         }
+   vector<int> fill( faceOffset.begin(), faceOffset.end()-1 );
 
-         if( x%2 == 1 && y%2 == 1 )
-         {
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+1)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << endl;
-         }
-      }
+   for( int i=0; i<nFaces; i++ )
+   {
+      shardFaces[ fill[faceShard[i]]++ ] = i;
    }
-}
 
-// =============================================================================
-// =============================================================================
-void semi6( int       rows,
-            int       cols,
-            ofstream& out )
-{
-   // write vertices -------------------------------------------------
-   float px, py;
+   // write the shards -------------------------------------------------
+   vector<int>    ghostCount( nShards, 0 );
+   atomic<int>    nextShard( 0 );
+   atomic<bool>   failed( false );
 
-   for( int y=0; y<rows; y++ )
+   auto worker = [&]( void )
    {
-      for( int x=0; x<cols; x++ )
+      unordered_map<int,int> ghostIndex;   // global index -> local index
+      vector<int>            ghosts, local;
+
+      for( int s = nextShard++; s < nShards; s = nextShard++ )
       {
-         px = floorf(x/2.0f)*(2.0f+sqrtf(3.0f)) + (x%2) +
-              floorf(y/4.0f)*(1.0f+sqrtf(3.0f)/2.0f);
-         py = floorf(y/4.0f)*(1.5f+sqrtf(3.0f));
+         int r = s / shardCols;
+         int c = s % shardCols;
 
-         switch( y%4 )
+         string fileName = outName + "_" + to_string(r) + "_" + to_string(c) + ".obj";
+         ofstream out( fileName.c_str() );
+         if( !out.is_open())
          {
-            case 0:
-               px += 0.0f;
-               py += 0.0f;
-               break;
-            case 1:
-               px += 0.5f;
-               py += sqrtf(3.0f)/2.0f;
-               break;
-            case 2:
-               px += 0.5f;
-               py += 1.0f + sqrtf(3.0f)/2.0f;
-               break;
-            case 3:
-               px += 0.0f;
-               py += 1.0f + sqrtf(3.0f);
-               break;
-            default:
-               break;
+            cerr << "Error: couldn't open file " << fileName << " for output." << endl;
+            failed = true;
+            continue;
          }
 
-         out << "v " << px << " " << py << " 0.0" << endl;
-      }
-   }
-
-   // write faces ----------------------------------------------------
-   for( int y=1; y<rows-4; y++ )
-   {
-      for( int x=0; x<cols-3; x++ )
-      {
-         if( x%2 == 0 && y%4 == 0 )
-         {
-            out << "f " << ((x+1)+(y+0)*cols)+1 << " "
-                        << ((x+2)+(y-1)*cols)+1 << " "
-                        << ((x+3)+(y-1)*cols)+1 << " "
-                        << ((x+2)+(y+0)*cols)+1 << " "
-                        << ((x+2)+(y+1)*cols)+1 << " "
-                        << ((x+2)+(y+2)*cols)+1 << " "
-                        << ((x+2)+(y+3)*cols)+1 << " "
-                        << ((x+1)+(y+4)*cols)+1 << " "
-                        << ((x+0)+(y+4)*cols)+1 << " "
-                        << ((x+1)+(y+3)*cols)+1 << " "
-                        << ((x+0)+(y+2)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << endl;
-
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+0)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << endl;
-
-         }
+         int nOwned = vertexCount[s];
 
-         if( x%2 == 0 && y%4 == 2 )
+         ghosts.clear();
+         ghostIndex.clear();
+         for( int f=faceOffset[s]; f<faceOffset[s+1]; f++ )
          {
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+1)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << endl;
-
+            int i = shardFaces[f];
+
+            for( int j=mesh.faceStart[i]; j<mesh.faceStart[i+1]; j++ )
+            {
+               int v = mesh.faceIndex[j];
+
+               if( vertexShard[v] != s &&
+                   ghostIndex.insert( make_pair( v, nOwned + (int) ghosts.size() )).second )
+               {
+                  ghosts.push_back( v );
+               }
+            }
          }
-      }
-   }
-}
-
-// =============================================================================
-// =============================================================================
-void semi7( int       rows,
-            int       cols,
-            ofstream& out )
-{
-   // write vertices -------------------------------------------------
-   float px, py;
+         ghostCount[s] = (int) ghosts.size();
 
-   for( int y=0; y<rows; y++ )
-   {
-      for( int x=0; x<cols; x++ )
-      {
-         px = floorf(x/2.0f)*(1.0f+sqrtf(3.0f)) + (x%2)*sqrtf(3.0f) +
-              floorf(y/4.0f)*(0.5f+sqrtf(3.0f)/2.0f);
-         py = floorf(y/4.0f)*(1.5f+sqrtf(3.0f)/2.0f);
+         out << "# shard " << r << " " << c << " of " << shardRows << "x" << shardCols << "\n";
+         out << "# vertices " << nOwned << " ghosts " << ghosts.size()
+             << " faces " << faceCount[s] << "\n";
 
-         switch( y%4 )
+         for( int k=0; k<nOwned; k++ )
          {
-            case 0:
-               px += sqrtf(3.0f)/2.0f;
-               py += -0.5f;
-               break;
-            case 1:
-               px += 0.0f;
-               py += 0.0f;
-               break;
-            case 2:
-               px += 0.0f;
-               py += 1.0f;
-               break;
-            case 3:
-               px += sqrtf(3.0f)/2.0f;
-               py += 1.5f;
-               break;
-            default:
-               break;
+            writeVertex( out, mesh, shardVertices[ vertexOffset[s] + k ] );
          }
 
-         out << "v " << px << " " << py << " 0.0" << endl;
-      }
-   }
-
-   // write faces ----------------------------------------------------
-   for( int y=2; y<rows-3; y++ )
-   {
-      for( int x=2; x<cols-2; x++ )
-      {
-         if( x%2 == 0 && y%4 == 0 )
+         for( size_t k=0; k<ghosts.size(); k++ )
          {
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+1)*cols)+1 << " "
-                        << ((x+1)+(y+2)*cols)+1 << " "
-                        << ((x+0)+(y+3)*cols)+1 << " "
-                        << ((x+0)+(y+2)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << endl;
-
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x+2)+(y-2)*cols)+1 << " "
-                        << ((x+2)+(y-1)*cols)+1 << " "
-                        << ((x+1)+(y+1)*cols)+1 << endl;
-
-            out << "f " << ((x+1)+(y+1)*cols)+1 << " "
-                        << ((x+2)+(y-1)*cols)+1 << " "
-                        << ((x+2)+(y+1)*cols)+1 << endl;
+            int v = ghosts[k];
+            int o = vertexShard[v];
+            writeVertex( out, mesh, v );
+            out << "# ghost " << nOwned+k+1 << " "
+                << o / shardCols << " " << o % shardCols << " "
+                << vertexOffset[o] + vertexRank[v] + 1 << "\n";
          }
 
-         if( x%2 == 1 && y%4 == 1 )
+         int group = -1;
+         for( int f=faceOffset[s]; f<faceOffset[s+1]; f++ )
          {
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+1)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << endl;
+            int i = shardFaces[f];
 
-         }
-         
-         if( x%2 == 1 && y%4 == 2 )
-         {
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x-1)+(y+2)*cols)+1 << " "
-                        << ((x-1)+(y+3)*cols)+1 << " "
-                        << ((x-1)+(y+1)*cols)+1 << endl;
+            local.clear();
+            for( int j=mesh.faceStart[i]; j<mesh.faceStart[i+1]; j++ )
+            {
+               int v = mesh.faceIndex[j];
+               local.push_back( vertexShard[v] == s ? vertexRank[v] : ghostIndex[v] );
+            }
+
+            writeFace( out, mesh, i, local.data(), group );
          }
 
-         if( x%2 == 0 && y%4 == 2 )
+         if( !out.good() )
          {
-            out << "f " << ((x-1)+(y+0)*cols)+1 << " "
-                        << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x-2)+(y+2)*cols)+1 << endl;
-
+            cerr << "Error: failed while writing " << fileName << endl;
+            failed = true;
          }
       }
-   }
-}
+   };
 
-// =============================================================================
-// =============================================================================
-void semi8( int       rows,
-            int       cols,
-            ofstream& out )
-{
-   // write vertices -------------------------------------------------
-   float px, py;
+   int nThreads = max( 1, min( nShards, (int) thread::hardware_concurrency() ));
+   vector<thread> pool;
 
-   for( int y=0; y<rows; y++ )
+   for( int t=1; t<nThreads; t++ )
    {
-      for( int x=0; x<cols; x++ )
-      {
-         px = floorf(x/4.0f)*(3.0f+3.0f*sqrtf(3.0f)) +
-              floorf(y/4.0f)*(1.5f+1.5f*sqrtf(3.0f));
-         py = floorf(y/4.0f)*(1.5f+sqrtf(3.0f)/2.0f);
-
-         switch( y%4 )
-         {
-            case 0:
-               px += sqrtf(3.0f)/2.0f;
-               py += -0.5f;
-               break;
-            case 1:
-               px += 0.0f ;
-               py += 0.0f ;
-               break;
-            case 2:
-               px += 0.0f ;
-               py += 1.0f;
-               break;
-            case 3:
-               px += sqrtf(3.0f)/2.0f;
-               py += 1.5f;
-               break;
-            default:
-               break;
-         }
-
-         switch( x%4 )
-         {
-            case 0:
-               px += 0.0f;
-               break;
-            case 1:
-               px += sqrtf(3.0f);
-               break;
-            case 2:
-               px += 1.0f + sqrtf(3.0f);
-               break;
-            case 3:
-               px += 1.0f + 2.0f*sqrtf(3.0f);
-               break;
-         }
-
-         out << "v " << px << " " << py << " 0.0" << endl;
-      }
+      pool.push_back( thread( worker ));
+   }
+   worker();
+   for( size_t t=0; t<pool.size(); t++ )
+   {
+      pool[t].join();
    }
 
-   // write faces ----------------------------------------------------
-   for( int y=3; y<rows-4; y++ )
+   if( failed )
    {
-      for( int x=3; x<cols-3; x++ )
-      {
-         if( x%2 == 0 && y%4 == 0 )
-         {
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+1)*cols)+1 << " "
-                        << ((x+1)+(y+2)*cols)+1 << " "
-                        << ((x+0)+(y+3)*cols)+1 << " "
-                        << ((x+0)+(y+2)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << endl;
-         }
+      return false;
+   }
 
-         if( x%4 == 1 && y%4 == 1 )
-         {
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+1)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << endl;
-         }
+   // write the index --------------------------------------------------
+   string indexName = outName + ".shards";
+   ofstream index( indexName.c_str() );
+   if( !index.is_open())
+   {
+      cerr << "Error: couldn't open file " << indexName << " for output." << endl;
+      return false;
+   }
 
-         if( x%4 == 3 && y%4 == 2 )
-         {
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x-3)+(y+2)*cols)+1 << " "
-                        << ((x-3)+(y+3)*cols)+1 << " "
-                        << ((x-1)+(y+1)*cols)+1 << endl;
-         }
+   string baseName = outName.substr( outName.find_last_of( "/" ) + 1 );
 
-         if( x%4 == 0 && y%4 == 2 )
-         {
-            out << "f " << ((x+0)+(y+1)*cols)+1 << " "
-                        << ((x-1)+(y+3)*cols)+1 << " "
-                        << ((x-2)+(y+2)*cols)+1 << " "
-                        << ((x+0)+(y+0)*cols)+1 << endl;
-         }
+   index << "# tiling shard index\n";
+   index << "grid " << shardRows << " " << shardCols << "\n";
+   index << "bounds " << xmin << " " << ymin << " " << xmax << " " << ymax << "\n";
+   index << "total " << nVertices << " " << nFaces << "\n";
+   index << "# shard row col file xmin ymin xmax ymax vertices ghosts faces vertexOffset faceOffset\n";
 
-         if( x%4 == 3 && y%4 == 1 )
-         {
-            out << "f " << ((x+0)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y-2)*cols)+1 << " "
-                        << ((x+2)+(y-3)*cols)+1 << " "
-                        << ((x+3)+(y-3)*cols)+1 << " "
-                        << ((x+3)+(y-2)*cols)+1 << " "
-                        << ((x+1)+(y+0)*cols)+1 << " "
-                        << ((x+1)+(y+1)*cols)+1 << " "
-                        << ((x-1)+(y+3)*cols)+1 << " "
-                        << ((x-1)+(y+4)*cols)+1 << " "
-                        << ((x-2)+(y+4)*cols)+1 << " "
-                        << ((x-3)+(y+3)*cols)+1 << " "
-                        << ((x+0)+(y+1)*cols)+1 << endl;
-         }
-      }
+   for( int s=0; s<nShards; s++ )
+   {
+      int r = s / shardCols;
+      int c = s % shardCols;
+
+      index << "shard " << r << " " << c << " "
+            << baseName << "_" << r << "_" << c << ".obj "
+            << xmin + c*cellWidth     << " " << ymin + r*cellHeight     << " "
+            << xmin + (c+1)*cellWidth << " " << ymin + (r+1)*cellHeight << " "
+            << vertexCount[s] << " " << ghostCount[s] << " " << faceCount[s] << " "
+            << vertexOffset[s] << " " << faceOffset[s] << "\n";
    }
-}
 
+   return index.good();
+}
@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////////////////////////
+// tiling.h
+//
+// DESCRIPTION: the pattern generators behind the tiling program (see
+//              tiling.cpp), for code that wants a tiling in memory rather
+//              than as an OBJ file.  generatePattern() takes the same pattern
+//              names and sizes as the command line and fills a Mesh.
+//
+//              Derived from tiling.cpp by Keenan Crane (kcrane@uiuc.edu).
+//
+// LICENSE:
+//    Released into the public domain.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TILING_H
+#define TILING_H
+
+#include <string>
+#include <vector>
+#include <stddef.h>
+#include <limits.h>
+#include <initializer_list>
+
+// optional channels a Mesh can carry besides positions, see Mesh::channels
+enum
+{
+   CHANNEL_UV     = 1,   // u v per vertex
+   CHANNEL_NORMAL = 2,   // x y z per vertex
+   CHANNEL_CLASS  = 4    // one TileClass per face
+};
+
+// the kind of tile a face is, as decided by the generator that emitted it
+enum TileClass
+{
+   TILE_TRIANGLE,
+   TILE_SQUARE,
+   TILE_HEXAGON,
+   TILE_OCTAGON,
+   TILE_DODECAGON
+};
+
+extern const char* tileClassNames[];
+
+// Mesh - the tiling as generated, before it is written anywhere.  Vertex
+// positions are stored as x y z triples; face i uses the zero-based vertex
+// indices faceIndex[ faceStart[i] ] through faceIndex[ faceStart[i+1]-1 ].
+// The generators fill uv, normal and faceClass alongside the positions and
+// faces, but only for the channels requested when the Mesh was created.
+// Texture coordinates are the planar positions themselves, in units of the
+// tile edge length, so repeating textures line up with the lattice.
+struct Mesh
+{
+   Mesh( int channels = 0 ) : channels( channels ), faceStart( 1, 0 ) {}
+
+   int channels;
+
+   std::vector<float>         vertex;
+   std::vector<float>         uv;
+   std::vector<float>         normal;
+   std::vector<int>           faceStart;
+   std::vector<int>           faceIndex;
+   std::vector<unsigned char> faceClass;
+};
+
+// Binary layout of a Mesh, as written by packBinary(): this header, then
+// vertex, uv (if CHANNEL_UV), normal (if CHANNEL_NORMAL), faceStart and
+// faceIndex, each exactly as stored in the Mesh, then faceClass (if
+// CHANNEL_CLASS) padded to a multiple of four bytes.  Everything is in the
+// byte order of the machine that wrote it.
+struct BinaryHeader
+{
+   unsigned int magic;      // BINARY_MAGIC
+   unsigned int version;    // BINARY_VERSION
+   unsigned int channels;
+   unsigned int nVertices;
+   unsigned int nFaces;
+   unsigned int nIndices;
+   unsigned int reserved[2];
+};
+
+const unsigned int BINARY_MAGIC   = 0x454c4954;   // "TILE"
+const unsigned int BINARY_VERSION = 1;
+
+// Largest rows x cols a tiling may have.  Face indices are ints, and the
+// triangle lattice, the densest pattern, has six corners per vertex.
+const long long MAX_TILING_SIZE = INT_MAX / 6;
+
+bool generatePattern( std::string patternName, int rows, int cols, Mesh& mesh );
+
+// Like generatePattern(), but subdivided levels times (see subdivide.cpp).
+bool subdividePattern( std::string patternName, int rows, int cols, int levels, Mesh& mesh );
+
+// An upper bound on binarySize() of what subdividePattern() generates, cheap
+// enough to check a size against before generating anything.
+size_t maxBinarySize( int rows, int cols, int levels, int channels );
+bool subdivide( Mesh& mesh, int levels );
+
+void addVertex( Mesh& mesh, float px, float py );
+void   addFace( Mesh& mesh, TileClass tileClass, std::initializer_list<int> indices );
+
+size_t binarySize( const Mesh& mesh );
+void   packBinary( const Mesh& mesh, char* out );
+
+void   square( int rows, int cols, Mesh& mesh );
+void triangle( int rows, int cols, Mesh& mesh );
+void  hexagon( int rows, int cols, Mesh& mesh );
+void    semi1( int rows, int cols, Mesh& mesh );
+void    semi2( int rows, int cols, Mesh& mesh );
+void    semi3( int rows, int cols, Mesh& mesh );
+void    semi4( int rows, int cols, Mesh& mesh );
+void    semi5( int rows, int cols, Mesh& mesh );
+void    semi6( int rows, int cols, Mesh& mesh );
+void    semi7( int rows, int cols, Mesh& mesh );
+void    semi8( int rows, int cols, Mesh& mesh );
+
+#endif
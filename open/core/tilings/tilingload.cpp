@@ -0,0 +1,395 @@
+////////////////////////////////////////////////////////////////////////////////
+// tilingload.cpp
+//
+// DESCRIPTION: load test for tilingserver.  First every request is sent once
+//              and the tiling that comes back is compared byte for byte with
+//              one generated locally.  Then a number of threads, each with
+//              its own connection, send requests as fast as they can, cycling
+//              through the ones given; every reply is mapped, its header is
+//              checked and the mapping is dropped again, as a client would.
+//              Prints the throughput and the median, 99th percentile and
+//              worst latency of a request.
+//
+//              With -local nothing is sent to a server; each request instead
+//              generates and packs the tiling in process, which is what the
+//              tiling program spends on it apart from starting up and writing
+//              the output.
+// USAGE:
+//    tilingload [options] socket request...
+//
+//              socket - path of the socket tilingserver listens on (unused
+//                       with -local)
+//
+//              request - a request line, quoted, such as "semi6 200 200" or
+//                        "--classes --subdiv 1 hexagon 64 64"
+//
+//              options - any of
+//
+//                 -threads n - number of client threads (default 4)
+//
+//                 -requests n - total number of timed requests (default
+//                               10000)
+//
+//                 -reconnect - open a new connection for every request, as
+//                              separate client processes would
+//
+//                 -local - generate the tilings in process instead
+//
+// BUILD:
+//    g++ -O2 -pthread -o tilingload tilingload.cpp tilingsocket.cpp
+//        patterns.cpp subdivide.cpp
+//
+// LICENSE:
+//    Released into the public domain.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tiling.h"
+#include "tilingserver.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+using namespace std;
+
+void printHelp( void );
+
+bool verify( const char* socketName, const vector<Request>& requests,
+             const vector<string>& lines );
+bool fetch( int& server, string& pending, const char* socketName,
+            const string& line, bool reconnect );
+bool generate( const Request& request );
+
+// =============================================================================
+// =============================================================================
+int main( int argc, char **argv )
+{
+   int  nThreads  = 4;
+   long nRequests = 10000;
+   bool reconnect = false;
+   bool local     = false;
+   int  arg       = 1;
+
+   while( arg < argc && argv[arg][0] == '-' )
+   {
+      string option = argv[arg];
+
+      if( option == "-help" )
+      {
+         printHelp();
+         exit( 1 );
+      }
+      else if( option == "-threads" && arg+1 < argc )
+      {
+         nThreads = atoi( argv[arg+1] );
+         arg += 2;
+      }
+      else if( option == "-requests" && arg+1 < argc )
+      {
+         nRequests = atol( argv[arg+1] );
+         arg += 2;
+      }
+      else if( option == "-reconnect" )
+      {
+         reconnect = true;
+         arg++;
+      }
+      else if( option == "-local" )
+      {
+         local = true;
+         arg++;
+      }
+      else
+      {
+         cerr << "Error: unknown or incomplete option " << option << endl;
+         exit( 1 );
+      }
+   }
+
+   if( argc-arg < 2 || nThreads <= 0 || nRequests <= 0 )
+   {
+      cerr << "usage: " << argv[0] << " [options] socket request..." << endl;
+      cerr << "       (type -help for more options)" << endl;
+      exit( 1 );
+   }
+
+   const char*     socketName = argv[arg];
+   vector<string>  lines( argv+arg+1, argv+argc );
+   vector<Request> requests( lines.size() );
+
+   for( size_t r=0; r<lines.size(); r++ )
+   {
+      string error;
+      if( !parseRequest( lines[r], requests[r], error ))
+      {
+         cerr << "Error: \"" << lines[r] << "\": " << error << endl;
+         exit( 1 );
+      }
+   }
+
+   if( !local && !verify( socketName, requests, lines ))
+   {
+      exit( 1 );
+   }
+
+   // timed requests ---------------------------------------------------
+   typedef chrono::steady_clock Clock;
+
+   vector< vector<double> > latency( nThreads );
+   atomic<long>             next( 0 );
+   atomic<bool>             failed( false );
+
+   auto worker = [&]( int t )
+   {
+      int    server = -1;
+      string pending;
+
+      for( long i = next++; i < nRequests && !failed; i = next++ )
+      {
+         size_t r = i % requests.size();
+
+         Clock::time_point start = Clock::now();
+
+         bool ok = local ? generate( requests[r] )
+                         : fetch( server, pending, socketName, lines[r], reconnect );
+
+         latency[t].push_back( chrono::duration<double>( Clock::now() - start ).count() );
+
+         if( !ok ) failed = true;
+      }
+
+      if( server >= 0 ) close( server );
+   };
+
+   Clock::time_point start = Clock::now();
+
+   vector<thread> threads;
+   for( int t=0; t<nThreads; t++ )
+   {
+      threads.push_back( thread( worker, t ));
+   }
+   for( int t=0; t<nThreads; t++ )
+   {
+      threads[t].join();
+   }
+
+   double seconds = chrono::duration<double>( Clock::now() - start ).count();
+
+   if( failed )
+   {
+      exit( 1 );
+   }
+
+   vector<double> all;
+   for( int t=0; t<nThreads; t++ )
+   {
+      all.insert( all.end(), latency[t].begin(), latency[t].end() );
+   }
+   sort( all.begin(), all.end() );
+
+   auto percentile = [&]( double p ) { return 1e3 * all[ (size_t)( p * (all.size()-1) ) ]; };
+
+   printf( "%ld requests from %d threads%s in %.3f s\n", (long) all.size(), nThreads,
+           local ? " (local)" : reconnect ? " (reconnecting)" : "", seconds );
+   printf( "requests/s %.0f\n", all.size() / seconds );
+   printf( "latency ms p50 %.3f p99 %.3f max %.3f\n",
+           percentile( 0.5 ), percentile( 0.99 ), percentile( 1.0 ));
+
+   return 0;
+}
+
+// =============================================================================
+// =============================================================================
+void printHelp( void )
+{
+   cerr << " tilingload                                                                     " << endl;
+   cerr << "                                                                                " << endl;
+   cerr << " DESCRIPTION: load test for tilingserver.  Checks each request once against a   " << endl;
+   cerr << "              locally generated tiling, then sends requests from several        " << endl;
+   cerr << "              threads as fast as possible and prints the requests per second    " << endl;
+   cerr << "              and the median, 99th percentile and worst latency.                " << endl;
+   cerr << " USAGE:                                                                         " << endl;
+   cerr << "    tilingload [options] socket request...                                      " << endl;
+   cerr << "                                                                                " << endl;
+   cerr << "              request - a request line, quoted, such as \"semi6 200 200\"         " << endl;
+   cerr << "                                                                                " << endl;
+   cerr << "              options - any of                                                  " << endl;
+   cerr << "                                                                                " << endl;
+   cerr << "                 -threads n - number of client threads (default 4)              " << endl;
+   cerr << "                                                                                " << endl;
+   cerr << "                 -requests n - total number of timed requests (default 10000)   " << endl;
+   cerr << "                                                                                " << endl;
+   cerr << "                 -reconnect - open a new connection for every request           " << endl;
+   cerr << "                                                                                " << endl;
+   cerr << "                 -local - generate the tilings in process instead               " << endl;
+   cerr << endl;
+}
+
+// =============================================================================
+// =============================================================================
+// Size of the binary layout a header describes, so a reply can be checked
+// without reading past its header.
+static size_t expectedSize( const BinaryHeader& header )
+{
+   size_t floats = 3 * (size_t) header.nVertices;
+   if( header.channels & CHANNEL_UV     ) floats += 2 * (size_t) header.nVertices;
+   if( header.channels & CHANNEL_NORMAL ) floats += 3 * (size_t) header.nVertices;
+
+   size_t classes = header.channels & CHANNEL_CLASS ? header.nFaces : 0;
+
+   return sizeof(BinaryHeader) + sizeof(float) * floats +
+          sizeof(int) * ( header.nFaces + 1 + (size_t) header.nIndices ) +
+          ( classes + 3 ) / 4 * 4;
+}
+
+// map() maps a reply read-only and checks its header, closing fd either way.
+static const char* map( int           fd,
+                        size_t        size,
+                        const string& line )
+{
+   void* data = size >= sizeof(BinaryHeader) ? mmap( NULL, size, PROT_READ, MAP_SHARED, fd, 0 )
+                                             : MAP_FAILED;
+   close( fd );
+
+   if( data == MAP_FAILED )
+   {
+      cerr << "Error: \"" << line << "\": couldn't map the reply." << endl;
+      return NULL;
+   }
+
+   const BinaryHeader* header = (const BinaryHeader*) data;
+
+   if( header->magic != BINARY_MAGIC || header->version != BINARY_VERSION ||
+       expectedSize( *header ) != size )
+   {
+      cerr << "Error: \"" << line << "\": the reply is not a valid binary mesh." << endl;
+      munmap( data, size );
+      return NULL;
+   }
+
+   return (const char*) data;
+}
+
+bool verify( const char*             socketName,
+             const vector<Request>&  requests,
+             const vector<string>&   lines )
+{
+   int server = connectServer( socketName );
+   if( server < 0 )
+   {
+      return false;
+   }
+
+   string pending;
+   bool   ok = true;
+
+   for( size_t r=0; r<requests.size() && ok; r++ )
+   {
+      size_t size;
+      string error;
+
+      int fd = requestMesh( server, pending, lines[r], size, error );
+      if( fd < 0 )
+      {
+         cerr << "Error: \"" << lines[r] << "\": " << error << endl;
+         ok = false;
+         break;
+      }
+
+      const char* data = map( fd, size, lines[r] );
+      if( data == NULL )
+      {
+         ok = false;
+         break;
+      }
+
+      Mesh mesh( requests[r].channels );
+      subdividePattern( requests[r].pattern, requests[r].rows, requests[r].cols,
+                        requests[r].levels, mesh );
+
+      vector<int> expected( (binarySize( mesh ) + sizeof(int)-1) / sizeof(int) );
+      packBinary( mesh, (char*) expected.data() );
+
+      if( binarySize( mesh ) != size || memcmp( data, expected.data(), size ) != 0 )
+      {
+         cerr << "Error: \"" << lines[r] << "\": the reply differs from the local tiling." << endl;
+         ok = false;
+      }
+
+      munmap( (void*) data, size );
+   }
+
+   close( server );
+
+   if( ok )
+   {
+      cout << "verified " << requests.size() << " requests against local tilings" << endl;
+   }
+
+   return ok;
+}
+
+// =============================================================================
+// =============================================================================
+bool fetch( int&          server,
+            string&       pending,
+            const char*   socketName,
+            const string& line,
+            bool          reconnect )
+{
+   if( server < 0 && ( server = connectServer( socketName )) < 0 )
+   {
+      return false;
+   }
+
+   size_t size;
+   string error;
+
+   int fd = requestMesh( server, pending, line, size, error );
+
+   if( reconnect )
+   {
+      close( server );
+      server = -1;
+      pending.clear();
+   }
+
+   if( fd < 0 )
+   {
+      cerr << "Error: \"" << line << "\": " << error << endl;
+      return false;
+   }
+
+   const char* data = map( fd, size, line );
+   if( data == NULL )
+   {
+      return false;
+   }
+
+   munmap( (void*) data, size );
+   return true;
+}
+
+bool generate( const Request& request )
+{
+   Mesh mesh( request.channels );
+   if( !subdividePattern( request.pattern, request.rows, request.cols, request.levels, mesh ))
+   {
+      return false;
+   }
+
+   vector<int> buffer( (binarySize( mesh ) + sizeof(int)-1) / sizeof(int) );
+   packBinary( mesh, (char*) buffer.data() );
+
+   return true;
+}
@@ -0,0 +1,359 @@
+////////////////////////////////////////////////////////////////////////////////
+// tilingmodule.cpp
+//
+// DESCRIPTION: Python bindings for the pattern generators in tiling.h, so
+//              scripts can get a tiling as NumPy arrays instead of running
+//              the tiling program and parsing its OBJ output.
+//
+//                 import tiling
+//                 vertices, faceStart, faceIndex = tiling.generate( "semi6", 200, 200 )
+//
+//              vertices is an (n,3) float32 array of x y z positions;
+//              faceIndex holds zero-based vertex indices and face i is
+//              faceIndex[ faceStart[i] : faceStart[i+1] ] (both int32).  The
+//              arrays are views of the buffers the generator filled, so
+//              nothing is copied, and the generator runs with the GIL
+//              released.  tiling.patterns lists the valid pattern names.
+//
+//              The keyword flags uvs, normals and classes append the
+//              corresponding channels (see Mesh in tiling.h), in that order:
+//              (n,2) float32 texture coordinates, (n,3) float32 normals and
+//              one uint8 TileClass per face, indexing tiling.tileClasses.
+//              subdiv=K returns the tiling subdivided K times, as with the
+//              --subdiv option of the tiling program.
+//
+// BUILD:
+//    g++ -O2 -shared -fPIC $(python3-config --includes) tilingmodule.cpp
+//        patterns.cpp subdivide.cpp -o tiling$(python3-config --extension-suffix)
+//
+// LICENSE:
+//    Released into the public domain.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include "tiling.h"
+
+#include <exception>
+#include <memory>
+#include <new>
+#include <string>
+
+using namespace std;
+
+static const char* patternNames[] =
+{
+   "square", "triangle", "hexagon",
+   "semi1", "semi2", "semi3", "semi4", "semi5", "semi6", "semi7", "semi8"
+};
+
+// =============================================================================
+// =============================================================================
+// tiling.Buffer - exposes one array of a generated Mesh through the buffer
+// protocol.  The three buffers of a mesh share ownership of it, so it lives
+// until the last NumPy array viewing it is gone.
+struct BufferObject
+{
+   PyObject_HEAD
+
+   shared_ptr<Mesh>* owner;
+   void*             data;
+   const char*       format;
+   Py_ssize_t        itemSize;
+   int               nDims;
+   Py_ssize_t        shape[2];
+   Py_ssize_t        strides[2];
+};
+
+static int getBuffer( PyObject*  self,
+                      Py_buffer* view,
+                      int        flags )
+{
+   BufferObject* buffer = (BufferObject*) self;
+
+   // empty arrays still need a valid address
+   static char empty;
+
+   view->obj        = self;
+   view->buf        = buffer->data ? buffer->data : &empty;
+   view->len        = buffer->itemSize * buffer->shape[0] * ( buffer->nDims > 1 ? buffer->shape[1] : 1 );
+   view->readonly   = 0;
+   view->itemsize   = buffer->itemSize;
+   view->format     = ( flags & PyBUF_FORMAT ) ? (char*) buffer->format : NULL;
+   view->ndim       = buffer->nDims;
+   view->shape      = ( flags & PyBUF_ND ) ? buffer->shape : NULL;
+   view->strides    = ( flags & PyBUF_STRIDES ) == PyBUF_STRIDES ? buffer->strides : NULL;
+   view->suboffsets = NULL;
+   view->internal   = NULL;
+
+   if( buffer->nDims > 1 && !( flags & PyBUF_ND ))
+   {
+      view->obj = NULL;
+      PyErr_SetString( PyExc_BufferError, "tiling.Buffer is multi-dimensional" );
+      return -1;
+   }
+
+   Py_INCREF( self );
+   return 0;
+}
+
+static void deallocBuffer( PyObject* self )
+{
+   delete ((BufferObject*) self)->owner;
+   Py_TYPE( self )->tp_free( self );
+}
+
+static PyBufferProcs bufferProcs = { getBuffer, NULL };
+
+static PyTypeObject BufferType =
+{
+   PyVarObject_HEAD_INIT( NULL, 0 )
+   "tiling.Buffer",
+};
+
+static PyObject* newBuffer( const shared_ptr<Mesh>& mesh,
+                            void*                   data,
+                            const char*             format,
+                            Py_ssize_t              itemSize,
+                            Py_ssize_t              rows,
+                            Py_ssize_t              cols )
+{
+   BufferObject* buffer = PyObject_New( BufferObject, &BufferType );
+   if( buffer == NULL )
+   {
+      return NULL;
+   }
+
+   buffer->owner      = new shared_ptr<Mesh>( mesh );
+   buffer->data       = data;
+   buffer->format     = format;
+   buffer->itemSize   = itemSize;
+   buffer->nDims      = cols > 0 ? 2 : 1;
+   buffer->shape[0]   = rows;
+   buffer->shape[1]   = cols;
+   buffer->strides[0] = itemSize * ( cols > 0 ? cols : 1 );
+   buffer->strides[1] = itemSize;
+
+   return (PyObject*) buffer;
+}
+
+// =============================================================================
+// =============================================================================
+static PyObject* asArray( PyObject* numpy,
+                          PyObject* buffer )
+{
+   if( buffer == NULL )
+   {
+      return NULL;
+   }
+
+   PyObject* array = PyObject_CallMethod( numpy, "asarray", "O", buffer );
+   Py_DECREF( buffer );
+   return array;
+}
+
+static PyObject* generate( PyObject* self,
+                           PyObject* args,
+                           PyObject* keywords )
+{
+   static const char* keywordNames[] = { "pattern", "rows", "cols",
+                                         "uvs", "normals", "classes", "subdiv", NULL };
+
+   const char* patternName;
+   int         rows, cols;
+   int         uvs = 0, normals = 0, classes = 0, levels = 0;
+
+   if( !PyArg_ParseTupleAndKeywords( args, keywords, "sii|$pppi:generate", (char**) keywordNames,
+                                     &patternName, &rows, &cols, &uvs, &normals, &classes, &levels ))
+   {
+      return NULL;
+   }
+
+   bool known = false;
+   for( size_t p=0; p<sizeof(patternNames)/sizeof(patternNames[0]); p++ )
+   {
+      known = known || string( patternName ) == patternNames[p];
+   }
+   if( !known )
+   {
+      return PyErr_Format( PyExc_ValueError, "unknown pattern '%s'", patternName );
+   }
+   if( rows <= 0 || cols <= 0 )
+   {
+      return PyErr_Format( PyExc_ValueError, "invalid size ( %d x %d )", rows, cols );
+   }
+   if( (long long) rows * cols > MAX_TILING_SIZE )
+   {
+      return PyErr_Format( PyExc_ValueError, "tiling is too large ( %d x %d )", rows, cols );
+   }
+   if( levels < 0 )
+   {
+      return PyErr_Format( PyExc_ValueError, "invalid number of subdivision levels ( %d )", levels );
+   }
+
+   PyObject* numpy = PyImport_ImportModule( "numpy" );
+   if( numpy == NULL )
+   {
+      return NULL;
+   }
+
+   int channels = ( uvs     ? CHANNEL_UV     : 0 ) |
+                  ( normals ? CHANNEL_NORMAL : 0 ) |
+                  ( classes ? CHANNEL_CLASS  : 0 );
+
+   shared_ptr<Mesh> mesh( new Mesh( channels ));
+
+   // exceptions mustn't escape while the GIL is released, so remember them
+   // and raise once it is held again
+   bool   ok          = false;
+   bool   outOfMemory = false;
+   string failure;
+
+   Py_BEGIN_ALLOW_THREADS
+   try
+   {
+      ok = subdividePattern( patternName, rows, cols, levels, *mesh );
+   }
+   catch( const bad_alloc& )
+   {
+      outOfMemory = true;
+   }
+   catch( const exception& e )
+   {
+      failure = e.what();
+   }
+   Py_END_ALLOW_THREADS
+
+   if( !ok )
+   {
+      Py_DECREF( numpy );
+
+      if( outOfMemory )
+      {
+         return PyErr_NoMemory();
+      }
+      if( !failure.empty() )
+      {
+         return PyErr_Format( PyExc_ValueError, "couldn't generate %s: %s", patternName, failure.c_str() );
+      }
+      return PyErr_Format( PyExc_ValueError, "couldn't subdivide %s %d times", patternName, levels );
+   }
+
+   Py_ssize_t nVertices = mesh->vertex.size() / 3;
+   Py_ssize_t nFaces    = mesh->faceStart.size() - 1;
+
+   PyObject* arrays[6];
+   int       nArrays = 0;
+
+   arrays[nArrays++] = asArray( numpy, newBuffer( mesh, mesh->vertex.data(), "f",
+                                                  sizeof(float), nVertices, 3 ));
+   arrays[nArrays++] = asArray( numpy, newBuffer( mesh, mesh->faceStart.data(), "i",
+                                                  sizeof(int), nFaces+1, 0 ));
+   arrays[nArrays++] = asArray( numpy, newBuffer( mesh, mesh->faceIndex.data(), "i",
+                                                  sizeof(int), mesh->faceIndex.size(), 0 ));
+   if( uvs )
+   {
+      arrays[nArrays++] = asArray( numpy, newBuffer( mesh, mesh->uv.data(), "f",
+                                                     sizeof(float), nVertices, 2 ));
+   }
+   if( normals )
+   {
+      arrays[nArrays++] = asArray( numpy, newBuffer( mesh, mesh->normal.data(), "f",
+                                                     sizeof(float), nVertices, 3 ));
+   }
+   if( classes )
+   {
+      arrays[nArrays++] = asArray( numpy, newBuffer( mesh, mesh->faceClass.data(), "B",
+                                                     1, nFaces, 0 ));
+   }
+   Py_DECREF( numpy );
+
+   PyObject* result = PyTuple_New( nArrays );
+   for( int a=0; a<nArrays; a++ )
+   {
+      if( arrays[a] == NULL )
+      {
+         Py_CLEAR( result );
+      }
+      if( result != NULL )
+      {
+         PyTuple_SET_ITEM( result, a, arrays[a] );
+      }
+      else
+      {
+         Py_XDECREF( arrays[a] );
+      }
+   }
+
+   return result;
+}
+
+// =============================================================================
+// =============================================================================
+static PyMethodDef methods[] =
+{
+   { "generate", (PyCFunction)(void(*)(void)) generate, METH_VARARGS | METH_KEYWORDS,
+     "generate(pattern, rows, cols, *, uvs=False, normals=False, classes=False, subdiv=0)\n"
+     "   -> (vertices, faceStart, faceIndex[, uvs][, normals][, classes])\n\n"
+     "Generate a tiling as NumPy arrays: (n,3) float32 vertex positions, and\n"
+     "int32 face offsets and zero-based vertex indices; face i is\n"
+     "faceIndex[faceStart[i]:faceStart[i+1]].  The optional channels are\n"
+     "appended when requested; classes index tiling.tileClasses.  subdiv\n"
+     "subdivides the tiling that many times." },
+   { NULL, NULL, 0, NULL }
+};
+
+static PyModuleDef module =
+{
+   PyModuleDef_HEAD_INIT,
+   "tiling",
+   "Regular and semi-regular tilings of the plane as NumPy arrays.",
+   -1,
+   methods
+};
+
+PyMODINIT_FUNC PyInit_tiling( void )
+{
+   BufferType.tp_basicsize = sizeof(BufferObject);
+   BufferType.tp_flags     = Py_TPFLAGS_DEFAULT;
+   BufferType.tp_doc       = "Storage of one array of a generated tiling.";
+   BufferType.tp_dealloc   = deallocBuffer;
+   BufferType.tp_as_buffer = &bufferProcs;
+
+   if( PyType_Ready( &BufferType ) < 0 )
+   {
+      return NULL;
+   }
+
+   PyObject* m = PyModule_Create( &module );
+   if( m == NULL )
+   {
+      return NULL;
+   }
+
+   size_t    nPatterns = sizeof(patternNames)/sizeof(patternNames[0]);
+   PyObject* patterns  = PyTuple_New( nPatterns );
+   for( size_t p=0; p<nPatterns; p++ )
+   {
+      PyTuple_SET_ITEM( patterns, p, PyUnicode_FromString( patternNames[p] ));
+   }
+
+   PyObject* tileClasses = PyTuple_New( TILE_DODECAGON+1 );
+   for( int c=0; c<=TILE_DODECAGON; c++ )
+   {
+      PyTuple_SET_ITEM( tileClasses, c, PyUnicode_FromString( tileClassNames[c] ));
+   }
+
+   Py_INCREF( &BufferType );
+   if( PyModule_AddObject( m, "patterns", patterns ) < 0 ||
+       PyModule_AddObject( m, "tileClasses", tileClasses ) < 0 ||
+       PyModule_AddObject( m, "Buffer", (PyObject*) &BufferType ) < 0 )
+   {
+      Py_DECREF( m );
+      return NULL;
+   }
+
+   return m;
+}
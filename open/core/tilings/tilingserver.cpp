@@ -0,0 +1,447 @@
+////////////////////////////////////////////////////////////////////////////////
+// tilingserver.cpp
+//
+// DESCRIPTION: keeps generated tilings resident, so that programs asking for
+//              the same few tilings over and over don't pay for generating
+//              them every time.  The server listens on a Unix domain socket
+//              and answers requests as described in tilingserver.h: each
+//              tiling is generated once into a sealed memfd in the binary
+//              layout of tiling.h, and every client asking for it is handed
+//              a descriptor for that memfd.  Clients map it read-only, so
+//              they all share the same pages and nothing is copied.
+//
+//              Generated tilings are kept in a least-recently-used cache of
+//              bounded size, and tilings that might not fit in it are refused.
+//              Evicting a tiling only closes the server's own descriptor;
+//              clients that still hold one keep their mapping.  Requests for
+//              a tiling that is still being generated wait for it rather than
+//              generating another copy.
+//              Each connection is served by its own thread.  The socket is
+//              removed when the server is stopped with SIGINT or SIGTERM.
+// USAGE:
+//    tilingserver [-cache megabytes] socket
+//
+//              -cache megabytes - total size of the cached tilings, which
+//                                 also bounds the largest tiling served
+//                                 (default 256)
+//
+//              socket - path of the Unix domain socket to listen on
+//
+// BUILD:
+//    g++ -O2 -pthread -o tilingserver tilingserver.cpp tilingsocket.cpp
+//        patterns.cpp subdivide.cpp
+//
+// LICENSE:
+//    Released into the public domain.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tiling.h"
+#include "tilingserver.h"
+
+#include <iostream>
+#include <string>
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <future>
+#include <functional>
+#include <thread>
+#include <new>
+#include <exception>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+using namespace std;
+
+// CachedMesh - a generated tiling in a memfd.  Shared between the cache and
+// the requests still sending it, and closed when the last of them lets go.
+struct CachedMesh
+{
+   CachedMesh( int fd, size_t size ) : fd( fd ), size( size ) {}
+   ~CachedMesh() { close( fd ); }
+
+   int    fd;
+   size_t size;
+};
+
+// Generated - the outcome of generating a tiling: the mesh, or an error.
+struct Generated
+{
+   shared_ptr<CachedMesh> mesh;
+   string                 error;
+};
+
+// MeshCache - tilings by requestKey(), most recently used first, and the
+// generations still under way, which concurrent requests for the same key
+// wait for.
+struct MeshCache
+{
+   typedef list< pair< string, shared_ptr<CachedMesh> > > Entries;
+
+   MeshCache( size_t capacity ) : capacity( capacity ), used( 0 ) {}
+
+   // find() returns the tiling cached under key, calling generate() to make
+   // it if no other request is already doing so.  generate() must not throw.
+   Generated find( const string& key, const function<Generated( void )>& generate );
+
+   mutex                                              lock;
+   Entries                                            entries;
+   unordered_map< string, Entries::iterator >         index;
+   unordered_map< string, shared_future<Generated> >  pending;
+   size_t                                             capacity;
+   size_t                                             used;
+
+private:
+   void insert( const string& key, shared_ptr<CachedMesh> mesh );
+};
+
+void printHelp( void );
+
+int  createMeshFile( const Mesh& mesh );
+void serveClient( int client, MeshCache* cache );
+
+static const char* socketName = NULL;
+
+// =============================================================================
+// =============================================================================
+static void stop( int )
+{
+   unlink( socketName );
+   _exit( 0 );
+}
+
+int main( int argc, char **argv )
+{
+   size_t megabytes = 256;
+   int    arg       = 1;
+
+   while( arg < argc && argv[arg][0] == '-' )
+   {
+      string option = argv[arg];
+
+      if( option == "-help" )
+      {
+         printHelp();
+         exit( 1 );
+      }
+      else if( option == "-cache" && arg+1 < argc )
+      {
+         megabytes = strtoull( argv[arg+1], NULL, 10 );
+         arg += 2;
+      }
+      else
+      {
+         cerr << "Error: unknown or incomplete option " << option << endl;
+         exit( 1 );
+      }
+   }
+
+   if( argc-arg != 1 )
+   {
+      cerr << "usage: " << argv[0] << " [-cache megabytes] socket" << endl;
+      cerr << "       (type -help for more options)" << endl;
+      exit( 1 );
+   }
+
+   socketName = argv[arg];
+
+   struct sockaddr_un address;
+   memset( &address, 0, sizeof(address) );
+   address.sun_family = AF_UNIX;
+
+   if( strlen( socketName ) >= sizeof(address.sun_path) )
+   {
+      cerr << "Error: socket name " << socketName << " is too long." << endl;
+      exit( 1 );
+   }
+   strcpy( address.sun_path, socketName );
+
+   int listener = socket( AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0 );
+   if( listener < 0 )
+   {
+      cerr << "Error: couldn't create a socket: " << strerror( errno ) << endl;
+      exit( 1 );
+   }
+
+   // a socket file nobody answers on is left over from a server that died
+   if( connect( listener, (struct sockaddr*) &address, sizeof(address) ) == 0 )
+   {
+      cerr << "Error: a server is already listening on " << socketName << endl;
+      exit( 1 );
+   }
+   close( listener );
+
+   // only ever remove a stale socket, never whatever else has that name
+   struct stat info;
+   if( lstat( socketName, &info ) == 0 )
+   {
+      if( !S_ISSOCK( info.st_mode ))
+      {
+         cerr << "Error: " << socketName << " exists and is not a socket." << endl;
+         exit( 1 );
+      }
+      unlink( socketName );
+   }
+
+   listener = socket( AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0 );
+   if( listener < 0 ||
+       bind( listener, (struct sockaddr*) &address, sizeof(address) ) < 0 ||
+       listen( listener, SOMAXCONN ) < 0 )
+   {
+      cerr << "Error: couldn't listen on " << socketName << ": " << strerror( errno ) << endl;
+      exit( 1 );
+   }
+
+   signal( SIGINT,  stop );
+   signal( SIGTERM, stop );
+
+   MeshCache cache( megabytes << 20 );
+
+   while( true )
+   {
+      int client = accept4( listener, NULL, NULL, SOCK_CLOEXEC );
+      if( client < 0 )
+      {
+         if( errno != EINTR && errno != ECONNABORTED )
+         {
+            cerr << "Error: accept failed: " << strerror( errno ) << endl;
+         }
+         continue;
+      }
+
+      thread( serveClient, client, &cache ).detach();
+   }
+
+   return 0;
+}
+
+// =============================================================================
+// =============================================================================
+void printHelp( void )
+{
+   cerr << " tilingserver                                                                   " << endl;
+   cerr << "                                                                                " << endl;
+   cerr << " DESCRIPTION: serves generated tilings over a Unix domain socket.  A client     " << endl;
+   cerr << "              sends a line such as \"--classes semi6 200 200\" and receives a     " << endl;
+   cerr << "              descriptor for a memfd holding the binary mesh, which it can      " << endl;
+   cerr << "              map read-only.  Tilings stay in a least-recently-used cache, so   " << endl;
+   cerr << "              repeated requests are answered without generating anything.       " << endl;
+   cerr << " USAGE:                                                                         " << endl;
+   cerr << "    tilingserver [-cache megabytes] socket                                      " << endl;
+   cerr << "                                                                                " << endl;
+   cerr << "              -cache megabytes - total size of the cached tilings, which        " << endl;
+   cerr << "                                 also bounds the largest tiling served          " << endl;
+   cerr << "                                 (default 256)                                  " << endl;
+   cerr << "                                                                                " << endl;
+   cerr << "              socket - path of the Unix domain socket to listen on              " << endl;
+   cerr << endl;
+}
+
+// =============================================================================
+// =============================================================================
+Generated MeshCache::find( const string&                     key,
+                           const function<Generated( void )>& generate )
+{
+   unique_lock<mutex> guard( lock );
+
+   unordered_map< string, Entries::iterator >::iterator i = index.find( key );
+   if( i != index.end() )
+   {
+      entries.splice( entries.begin(), entries, i->second );
+
+      Generated cached;
+      cached.mesh = i->second->second;
+      return cached;
+   }
+
+   unordered_map< string, shared_future<Generated> >::iterator p = pending.find( key );
+   if( p != pending.end() )
+   {
+      shared_future<Generated> generation = p->second;
+      guard.unlock();
+      return generation.get();
+   }
+
+   // generate without holding the cache, so other requests aren't held up
+   promise<Generated> generation;
+   pending[key] = generation.get_future().share();
+   guard.unlock();
+
+   Generated generated = generate();
+
+   guard.lock();
+   pending.erase( key );
+   if( generated.mesh )
+   {
+      insert( key, generated.mesh );
+   }
+   guard.unlock();
+
+   generation.set_value( generated );
+   return generated;
+}
+
+// insert() caches mesh under key, which must be new, with the lock held.
+// Older tilings are evicted until the cache fits, though the newest one is
+// always kept.
+void MeshCache::insert( const string&          key,
+                        shared_ptr<CachedMesh> mesh )
+{
+   entries.push_front( make_pair( key, mesh ));
+   index[key] = entries.begin();
+   used += mesh->size;
+
+   while( used > capacity && entries.size() > 1 )
+   {
+      used -= entries.back().second->size;
+      index.erase( entries.back().first );
+      entries.pop_back();
+   }
+}
+
+// =============================================================================
+// =============================================================================
+// createMeshFile() returns a memfd holding the binary layout of mesh, sealed
+// so that no client can change or resize what the others are reading.
+int createMeshFile( const Mesh& mesh )
+{
+   size_t size = binarySize( mesh );
+
+   int fd = memfd_create( "tiling", MFD_CLOEXEC | MFD_ALLOW_SEALING );
+   if( fd < 0 )
+   {
+      return -1;
+   }
+
+   void* data = MAP_FAILED;
+   if( ftruncate( fd, size ) == 0 )
+   {
+      data = mmap( NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+   }
+   if( data == MAP_FAILED )
+   {
+      close( fd );
+      return -1;
+   }
+
+   packBinary( mesh, (char*) data );
+
+   // F_SEAL_WRITE needs the writable mapping gone
+   munmap( data, size );
+
+   if( fcntl( fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL ) < 0 )
+   {
+      close( fd );
+      return -1;
+   }
+
+   return fd;
+}
+
+// =============================================================================
+// =============================================================================
+static Generated generate( const Request& request )
+{
+   Generated generated;
+   int       fd = -1;
+
+   try
+   {
+      Mesh mesh( request.channels );
+
+      if( !subdividePattern( request.pattern, request.rows, request.cols, request.levels, mesh ))
+      {
+         generated.error = "couldn't subdivide the tiling " + to_string( request.levels ) + " times";
+         return generated;
+      }
+
+      fd = createMeshFile( mesh );
+      if( fd < 0 )
+      {
+         generated.error = string( "couldn't create the mesh file: " ) + strerror( errno );
+         return generated;
+      }
+
+      generated.mesh = make_shared<CachedMesh>( fd, binarySize( mesh ));
+   }
+   catch( const bad_alloc& )
+   {
+      generated.error = "out of memory";
+   }
+   catch( const exception& e )
+   {
+      generated.error = string( "couldn't generate the tiling: " ) + e.what();
+   }
+
+   if( !generated.mesh && fd >= 0 )
+   {
+      close( fd );
+   }
+
+   return generated;
+}
+
+static shared_ptr<CachedMesh> lookup( const Request& request,
+                                      MeshCache&     cache,
+                                      string&        error )
+{
+   // a tiling that might not fit in the cache would only push out the
+   // others, and could make the server run out of memory
+   if( maxBinarySize( request.rows, request.cols, request.levels, request.channels ) > cache.capacity )
+   {
+      error = "tiling would not fit in the cache";
+      return shared_ptr<CachedMesh>();
+   }
+
+   try
+   {
+      Generated generated = cache.find( requestKey( request ), [&]( void ) { return generate( request ); } );
+
+      error = generated.error;
+      return generated.mesh;
+   }
+   catch( const exception& e )
+   {
+      error = e.what();
+      return shared_ptr<CachedMesh>();
+   }
+}
+
+void serveClient( int        client,
+                  MeshCache* cache )
+{
+   string pending, line;
+
+   while( receiveLine( client, pending, line ))
+   {
+      Request request;
+      string  error;
+      bool    sent;
+
+      if( !parseRequest( line, request, error ))
+      {
+         sent = sendLine( client, "error " + error );
+      }
+      else
+      {
+         shared_ptr<CachedMesh> mesh = lookup( request, *cache, error );
+
+         sent = mesh ? sendLine( client, "ok " + to_string( mesh->size ), mesh->fd )
+                     : sendLine( client, "error " + error );
+      }
+
+      if( !sent ) break;
+   }
+
+   close( client );
+}
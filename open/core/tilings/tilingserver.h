@@ -0,0 +1,64 @@
+////////////////////////////////////////////////////////////////////////////////
+// tilingserver.h
+//
+// DESCRIPTION: both ends of the protocol spoken by tilingserver (see
+//              tilingserver.cpp) over a Unix domain socket.  A request is one
+//              line of text holding the arguments of the tiling program
+//              without the output name,
+//
+//                 [--uvs] [--normals] [--classes] [--subdiv K] pattern rows cols
+//
+//              and the reply is one line, either "ok <bytes>" sent together
+//              with a file descriptor (SCM_RIGHTS) for a sealed memfd that
+//              holds the tiling in the binary layout of BinaryHeader (see
+//              tiling.h), or "error <message>".  A connection may carry any
+//              number of requests, answered in order.
+//
+// LICENSE:
+//    Released into the public domain.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TILINGSERVER_H
+#define TILINGSERVER_H
+
+#include <string>
+#include <stddef.h>
+
+// Request - a parsed request line
+struct Request
+{
+   std::string pattern;
+   int         rows;
+   int         cols;
+   int         channels;
+   int         levels;
+};
+
+bool parseRequest( const std::string& line, Request& request, std::string& error );
+
+// The request in a canonical form, so that equivalent lines compare equal.
+std::string requestKey( const Request& request );
+
+// sendLine() appends the newline; fd, if not -1, is passed along with it.
+bool sendLine( int socket, const std::string& line, int fd = -1 );
+
+// Longest line either end accepts; real requests are a few dozen bytes.
+const size_t MAX_LINE_LENGTH = 4096;
+
+// receiveLine() reads the next line without its newline, keeping whatever
+// arrived after it in pending.  If fd is given it receives the descriptor
+// that came with the line, or -1.  Returns false on error, at the end of the
+// stream, or once more than MAX_LINE_LENGTH bytes arrive without a newline.
+bool receiveLine( int socket, std::string& pending, std::string& line, int* fd = NULL );
+
+// connectServer() returns a connected socket, or -1 after printing an error.
+int connectServer( const char* socketName );
+
+// requestMesh() sends one request and waits for the reply.  On success it
+// returns the descriptor of the tiling and sets size to its length in bytes;
+// otherwise it returns -1 and sets error.
+int requestMesh( int server, std::string& pending, const std::string& line,
+                 size_t& size, std::string& error );
+
+#endif
@@ -0,0 +1,289 @@
+////////////////////////////////////////////////////////////////////////////////
+// tilingsocket.cpp
+//
+// DESCRIPTION: request parsing and socket I/O shared by tilingserver and its
+//              clients; see tilingserver.h for the protocol.
+//
+// LICENSE:
+//    Released into the public domain.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tiling.h"
+#include "tilingserver.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+using namespace std;
+
+static const char* patternNames[] =
+{
+   "square", "triangle", "hexagon",
+   "semi1", "semi2", "semi3", "semi4", "semi5", "semi6", "semi7", "semi8"
+};
+
+// =============================================================================
+// =============================================================================
+static bool readInt( istream& in, int& value )
+{
+   string word;
+   char*  end;
+
+   if( !( in >> word )) return false;
+
+   long n = strtol( word.c_str(), &end, 10 );
+   value = (int) n;
+   return *end == '\0' && n == value;
+}
+
+bool parseRequest( const string& line,
+                   Request&      request,
+                   string&       error )
+{
+   istringstream words( line );
+   string        word;
+
+   request.channels = 0;
+   request.levels   = 0;
+
+   while( words >> word && word.compare( 0, 2, "--" ) == 0 )
+   {
+      if(      word == "--uvs"     ) request.channels |= CHANNEL_UV;
+      else if( word == "--normals" ) request.channels |= CHANNEL_NORMAL;
+      else if( word == "--classes" ) request.channels |= CHANNEL_CLASS;
+      else if( word == "--subdiv"  )
+      {
+         if( !readInt( words, request.levels ) || request.levels < 0 || request.levels > 16 )
+         {
+            error = "--subdiv expects a number of levels from 0 to 16";
+            return false;
+         }
+      }
+      else
+      {
+         error = "unknown option " + word;
+         return false;
+      }
+   }
+
+   request.pattern = word;
+
+   bool known = false;
+   for( size_t p=0; p<sizeof(patternNames)/sizeof(patternNames[0]); p++ )
+   {
+      known = known || request.pattern == patternNames[p];
+   }
+   if( !known )
+   {
+      error = "unknown pattern '" + request.pattern + "'";
+      return false;
+   }
+
+   if( !readInt( words, request.rows ) || !readInt( words, request.cols ) ||
+       request.rows <= 0 || request.cols <= 0 )
+   {
+      error = "expected a positive number of rows and columns";
+      return false;
+   }
+   // each level of subdivision doubles the rows and columns, roughly
+   if( ( (long long) request.rows << request.levels ) >
+       MAX_TILING_SIZE / ( (long long) request.cols << request.levels ))
+   {
+      error = "tiling is too large";
+      return false;
+   }
+
+   if( words >> word )
+   {
+      error = "unexpected '" + word + "' after the size";
+      return false;
+   }
+
+   return true;
+}
+
+string requestKey( const Request& request )
+{
+   return request.pattern + " " + to_string( request.rows ) + " " + to_string( request.cols ) +
+          " " + to_string( request.channels ) + " " + to_string( request.levels );
+}
+
+// =============================================================================
+// =============================================================================
+bool sendLine( int           socket,
+               const string& line,
+               int           fd )
+{
+   string text = line + "\n";
+
+   struct iovec  data = { (void*) text.data(), text.size() };
+   struct msghdr message;
+   memset( &message, 0, sizeof(message) );
+   message.msg_iov    = &data;
+   message.msg_iovlen = 1;
+
+   // the descriptor travels with the first byte of the line
+   union
+   {
+      char           buffer[ CMSG_SPACE(sizeof(int)) ];
+      struct cmsghdr align;
+   } control;
+
+   if( fd >= 0 )
+   {
+      message.msg_control    = control.buffer;
+      message.msg_controllen = sizeof(control.buffer);
+
+      struct cmsghdr* header = CMSG_FIRSTHDR( &message );
+      header->cmsg_level = SOL_SOCKET;
+      header->cmsg_type  = SCM_RIGHTS;
+      header->cmsg_len   = CMSG_LEN( sizeof(int) );
+      memcpy( CMSG_DATA( header ), &fd, sizeof(int) );
+   }
+
+   while( data.iov_len > 0 )
+   {
+      ssize_t sent = sendmsg( socket, &message, MSG_NOSIGNAL );
+      if( sent < 0 && errno == EINTR ) continue;
+      if( sent < 0 ) return false;
+
+      data.iov_base = (char*) data.iov_base + sent;
+      data.iov_len -= sent;
+
+      message.msg_control    = NULL;
+      message.msg_controllen = 0;
+   }
+
+   return true;
+}
+
+bool receiveLine( int     socket,
+                  string& pending,
+                  string& line,
+                  int*    fd )
+{
+   if( fd ) *fd = -1;
+
+   size_t end;
+   while(( end = pending.find( '\n' )) == string::npos )
+   {
+      // a peer that never ends its line mustn't make us buffer without limit
+      if( pending.size() > MAX_LINE_LENGTH )
+      {
+         if( fd && *fd >= 0 )
+         {
+            close( *fd );
+            *fd = -1;
+         }
+         return false;
+      }
+
+      char buffer[4096];
+
+      struct iovec  data = { buffer, sizeof(buffer) };
+      struct msghdr message;
+      memset( &message, 0, sizeof(message) );
+      message.msg_iov    = &data;
+      message.msg_iovlen = 1;
+
+      union
+      {
+         char           buffer[ CMSG_SPACE(sizeof(int)) ];
+         struct cmsghdr align;
+      } control;
+
+      message.msg_control    = control.buffer;
+      message.msg_controllen = sizeof(control.buffer);
+
+      ssize_t received = recvmsg( socket, &message, MSG_CMSG_CLOEXEC );
+      if( received < 0 && errno == EINTR ) continue;
+      if( received <= 0 ) return false;
+
+      for( struct cmsghdr* header = CMSG_FIRSTHDR( &message ); header != NULL;
+           header = CMSG_NXTHDR( &message, header ))
+      {
+         if( header->cmsg_level == SOL_SOCKET && header->cmsg_type == SCM_RIGHTS )
+         {
+            int passed;
+            memcpy( &passed, CMSG_DATA( header ), sizeof(int) );
+
+            // only one descriptor is expected per line
+            if( fd && *fd < 0 ) *fd = passed;
+            else                close( passed );
+         }
+      }
+
+      pending.append( buffer, received );
+   }
+
+   line.assign( pending, 0, end );
+   pending.erase( 0, end+1 );
+
+   return true;
+}
+
+// =============================================================================
+// =============================================================================
+int connectServer( const char* socketName )
+{
+   struct sockaddr_un address;
+   memset( &address, 0, sizeof(address) );
+   address.sun_family = AF_UNIX;
+
+   if( strlen( socketName ) >= sizeof(address.sun_path) )
+   {
+      cerr << "Error: socket name " << socketName << " is too long." << endl;
+      return -1;
+   }
+   strcpy( address.sun_path, socketName );
+
+   int server = socket( AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0 );
+   if( server < 0 || connect( server, (struct sockaddr*) &address, sizeof(address) ) < 0 )
+   {
+      cerr << "Error: couldn't connect to " << socketName << ": " << strerror( errno ) << endl;
+      if( server >= 0 ) close( server );
+      return -1;
+   }
+
+   return server;
+}
+
+int requestMesh( int           server,
+                 string&       pending,
+                 const string& line,
+                 size_t&       size,
+                 string&       error )
+{
+   string reply;
+   int    fd;
+
+   if( !sendLine( server, line ) || !receiveLine( server, pending, reply, &fd ))
+   {
+      error = "lost the connection to the server";
+      return -1;
+   }
+
+   unsigned long long bytes;
+   char               extra;
+
+   if( reply.compare( 0, 3, "ok " ) == 0 &&
+       sscanf( reply.c_str() + 3, "%llu %c", &bytes, &extra ) == 1 && fd >= 0 )
+   {
+      size = (size_t) bytes;
+      return fd;
+   }
+
+   if( fd >= 0 ) close( fd );
+
+   error = reply.compare( 0, 6, "error " ) == 0 ? reply.substr( 6 ) : "unexpected reply '" + reply + "'";
+   return -1;
+}
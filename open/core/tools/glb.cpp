@@ -0,0 +1,533 @@
+////////////////////////////////////////////////////////////////////////////////
+// glb.cpp
+//
+// DESCRIPTION: mapping and parsing of binary glTF files; see glb.h.
+//
+// LICENSE:
+//    Released into the public domain.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "glb.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <limits.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using namespace std;
+
+// =============================================================================
+// =============================================================================
+bool MappedFile::open( const string& fileName )
+{
+   close();
+
+   int fd = ::open( fileName.c_str(), O_RDONLY );
+   if( fd < 0 )
+   {
+      cerr << "Error: couldn't open file " << fileName << " for input." << endl;
+      return false;
+   }
+
+   struct stat info;
+   fstat( fd, &info );
+   size_t length = info.st_size;
+
+   if( length > 0 )
+   {
+      void* map = mmap( NULL, length, PROT_READ, MAP_PRIVATE, fd, 0 );
+      if( map == MAP_FAILED )
+      {
+         cerr << "Error: couldn't map file " << fileName << endl;
+         ::close( fd );
+         return false;
+      }
+      data = (const unsigned char*) map;
+      size = length;
+   }
+   ::close( fd );
+
+   return true;
+}
+
+void MappedFile::close( void )
+{
+   if( data != NULL )
+   {
+      munmap( (void*) data, size );
+   }
+   data = NULL;
+   size = 0;
+}
+
+// =============================================================================
+// =============================================================================
+// Recursive descent over [p,end).  Nesting is limited so that a malicious
+// file can't exhaust the stack.
+static const int maxDepth = 256;
+
+static void skipSpace( const char*& p, const char* end )
+{
+   while( p < end && ( *p == ' ' || *p == '\t' || *p == '\n' || *p == '\r' )) p++;
+}
+
+static bool parseString( const char*& p, const char* end, string& out )
+{
+   if( p == end || *p != '"' ) return false;
+   p++;
+
+   out.clear();
+   while( p < end && *p != '"' )
+   {
+      if( *p != '\\' )
+      {
+         out += *p++;
+         continue;
+      }
+
+      if( ++p == end ) return false;
+
+      switch( *p++ )
+      {
+         case '"':  out += '"';  break;
+         case '\\': out += '\\'; break;
+         case '/':  out += '/';  break;
+         case 'b':  out += '\b'; break;
+         case 'f':  out += '\f'; break;
+         case 'n':  out += '\n'; break;
+         case 'r':  out += '\r'; break;
+         case 't':  out += '\t'; break;
+         case 'u':
+         {
+            // glTF names are the only strings that might use this, and they
+            // only need to survive a round trip through UTF-8
+            if( end-p < 4 ) return false;
+            unsigned c = strtoul( string( p, 4 ).c_str(), NULL, 16 );
+            p += 4;
+
+            if(      c < 0x80  ) { out += (char) c; }
+            else if( c < 0x800 ) { out += (char)( 0xc0 | c >> 6 );
+                                   out += (char)( 0x80 | ( c & 0x3f )); }
+            else                 { out += (char)( 0xe0 | c >> 12 );
+                                   out += (char)( 0x80 | ( c >> 6 & 0x3f ));
+                                   out += (char)( 0x80 | ( c & 0x3f )); }
+            break;
+         }
+         default: return false;
+      }
+   }
+
+   if( p == end ) return false;
+   p++;
+   return true;
+}
+
+static bool parseValue( const char*& p, const char* end, Json& value, int depth )
+{
+   skipSpace( p, end );
+   if( p == end || depth > maxDepth ) return false;
+
+   if( *p == '{' )
+   {
+      value.type = Json::OBJECT;
+      p++;
+      skipSpace( p, end );
+      if( p < end && *p == '}' ) { p++; return true; }
+
+      while( true )
+      {
+         value.object.push_back( make_pair( string(), Json() ));
+
+         skipSpace( p, end );
+         if( !parseString( p, end, value.object.back().first )) return false;
+         skipSpace( p, end );
+         if( p == end || *p++ != ':' ) return false;
+         if( !parseValue( p, end, value.object.back().second, depth+1 )) return false;
+         skipSpace( p, end );
+
+         if( p == end ) return false;
+         if( *p == '}' ) { p++; return true; }
+         if( *p++ != ',' ) return false;
+      }
+   }
+
+   if( *p == '[' )
+   {
+      value.type = Json::ARRAY;
+      p++;
+      skipSpace( p, end );
+      if( p < end && *p == ']' ) { p++; return true; }
+
+      while( true )
+      {
+         value.array.push_back( Json() );
+         if( !parseValue( p, end, value.array.back(), depth+1 )) return false;
+         skipSpace( p, end );
+
+         if( p == end ) return false;
+         if( *p == ']' ) { p++; return true; }
+         if( *p++ != ',' ) return false;
+      }
+   }
+
+   if( *p == '"' )
+   {
+      value.type = Json::STRING;
+      return parseString( p, end, value.text );
+   }
+
+   static const char* words[] = { "true", "false", "null" };
+   for( int w=0; w<3; w++ )
+   {
+      size_t n = strlen( words[w] );
+      if( (size_t)( end-p ) >= n && strncmp( p, words[w], n ) == 0 )
+      {
+         value.type   = w < 2 ? Json::BOOLEAN : Json::NUL;
+         value.number = w == 0 ? 1.0 : 0.0;
+         p += n;
+         return true;
+      }
+   }
+
+   // numbers: copy out the longest run that could belong to one, since the
+   // chunk is not null-terminated
+   const char* q = p;
+   while( q < end && ( strchr( "+-.eE", *q ) || ( *q >= '0' && *q <= '9' ))) q++;
+   if( q == p ) return false;
+
+   string digits( p, q );
+   char*  last;
+   value.type   = Json::NUMBER;
+   value.number = strtod( digits.c_str(), &last );
+   p = q;
+
+   return *last == '\0';
+}
+
+bool Json::parse( const char* begin,
+                  const char* end )
+{
+   *this = Json();
+
+   const char* p = begin;
+   if( !parseValue( p, end, *this, 0 ))
+   {
+      return false;
+   }
+
+   // the JSON chunk of a .glb is padded with spaces
+   skipSpace( p, end );
+   return p == end;
+}
+
+const Json& Json::operator[]( const char* key ) const
+{
+   static const Json null;
+
+   for( size_t i=0; i<object.size(); i++ )
+   {
+      if( object[i].first == key ) return object[i].second;
+   }
+   return null;
+}
+
+const Json& Json::operator[]( int i ) const
+{
+   static const Json null;
+
+   return type == ARRAY && i >= 0 && i < (int) array.size() ? array[i] : null;
+}
+
+int Json::asInt( int otherwise ) const
+{
+   // NaN is caught by the first comparison
+   if( type != NUMBER || number != floor( number ) ||
+       number < INT_MIN || number > INT_MAX )
+   {
+      return otherwise;
+   }
+   return (int) number;
+}
+
+bool Json::asSize( size_t& value,
+                   size_t  otherwise ) const
+{
+   if( type == NUL )
+   {
+      value = otherwise;
+      return true;
+   }
+
+   // doubles are exact up to 2^53, far beyond any real file
+   if( type != NUMBER || !( number >= 0.0 && number <= 9007199254740992.0 ) ||
+       number != floor( number ) || number > (double) SIZE_MAX )
+   {
+      return false;
+   }
+
+   value = (size_t) number;
+   return true;
+}
+
+// =============================================================================
+// =============================================================================
+static unsigned int readUint( const unsigned char* p )
+{
+   // .glb files are little endian
+   return p[0] | p[1] << 8 | p[2] << 16 | (unsigned int) p[3] << 24;
+}
+
+static int componentSize( int componentType )
+{
+   switch( componentType )
+   {
+      case GLB_BYTE:           case GLB_UNSIGNED_BYTE:  return 1;
+      case GLB_SHORT:          case GLB_UNSIGNED_SHORT: return 2;
+      case GLB_UNSIGNED_INT:   case GLB_FLOAT:          return 4;
+   }
+   return 0;
+}
+
+static int componentCount( const string& type )
+{
+   static const char* names[] = { "SCALAR", "VEC2", "VEC3", "VEC4", "MAT2", "MAT3", "MAT4" };
+   static const int   counts[] = { 1, 2, 3, 4, 4, 9, 16 };
+
+   for( int i=0; i<7; i++ )
+   {
+      if( type == names[i] ) return counts[i];
+   }
+   return 0;
+}
+
+bool GLB::open( const string& fileName )
+{
+   accessors.clear();
+   bin     = NULL;
+   binSize = 0;
+
+   if( !file.open( fileName ))
+   {
+      return false;
+   }
+
+   const unsigned char* data = file.data;
+   size_t               size = file.size;
+
+   // header, then a JSON chunk and optionally a BIN chunk -----------
+   if( size < 20 || readUint( data ) != 0x46546c67 || readUint( data+4 ) != 2 ||
+       readUint( data+8 ) > size )
+   {
+      cerr << "Error: " << fileName << " is not a glTF 2.0 binary file." << endl;
+      return false;
+   }
+   size = readUint( data+8 );
+
+   size_t jsonSize = readUint( data+12 );
+   if( readUint( data+16 ) != 0x4e4f534a || jsonSize > size-20 ||
+       !json.parse( (const char*) data+20, (const char*) data+20+jsonSize ))
+   {
+      cerr << "Error: " << fileName << " has no valid JSON chunk." << endl;
+      return false;
+   }
+
+   size_t next = 20 + ( jsonSize+3 ) / 4 * 4;
+   if( next+8 <= size && readUint( data+next+4 ) == 0x004e4942 )
+   {
+      binSize = readUint( data+next );
+      bin     = data + next + 8;
+
+      if( binSize > size-next-8 )
+      {
+         cerr << "Error: " << fileName << ": the binary chunk is truncated." << endl;
+         return false;
+      }
+   }
+
+   const Json& views = json["bufferViews"];
+   for( size_t v=0; v<views.size(); v++ )
+   {
+      size_t buffer, offset, length, stride;
+
+      if( !views[v]["buffer"].asSize( buffer, 1 ) || buffer != 0 ||
+          !json["buffers"][0]["uri"].isNull() ||
+          !views[v]["byteOffset"].asSize( offset, 0 ) ||
+          !views[v]["byteLength"].asSize( length, 0 ) ||
+          !views[v]["byteStride"].asSize( stride, 0 ) ||
+          offset > binSize || length > binSize-offset )
+      {
+         cerr << "Error: " << fileName << ": bufferView " << v
+              << " is not inside the binary chunk." << endl;
+         return false;
+      }
+   }
+
+   // accessors ------------------------------------------------------
+   const Json& list = json["accessors"];
+   accessors.resize( list.size() );
+
+   for( size_t a=0; a<list.size(); a++ )
+   {
+      const Json& accessor = list[a];
+      Accessor&   out      = accessors[a];
+      size_t      viewIndex, componentType, offset;
+
+      if( !accessor["bufferView"].asSize( viewIndex, views.size() ) ||
+          !accessor["componentType"].asSize( componentType, 0 ) ||
+          !accessor["count"].asSize( out.count, 0 ) ||
+          !accessor["byteOffset"].asSize( offset, 0 ) || componentType > INT_MAX )
+      {
+         cerr << "Error: " << fileName << ": accessor " << a << " is malformed." << endl;
+         return false;
+      }
+
+      // the bufferView's fields were checked above
+      const Json& view = views[ viewIndex < views.size() ? (int) viewIndex : -1 ];
+
+      out.componentType = (int) componentType;
+      out.components    = componentCount( accessor["type"].text );
+
+      int    bytes       = componentSize( out.componentType );
+      size_t elementSize = (size_t) bytes * out.components;
+      size_t viewStart = 0, viewLength = 0;
+
+      view["byteOffset"].asSize( viewStart, 0 );
+      view["byteLength"].asSize( viewLength, 0 );
+      view["byteStride"].asSize( out.stride, elementSize );
+      out.data = bin + viewStart + offset;
+
+      if( view.isNull() || !accessor["sparse"].isNull() || elementSize == 0 )
+      {
+         cerr << "Error: " << fileName << ": accessor " << a << " is not supported." << endl;
+         return false;
+      }
+
+      // the last element must end inside the view, and every component must
+      // be aligned so that views can be read in place
+      if( offset > viewLength ||
+          ( out.count > 0 && ( out.stride < elementSize ||
+                               elementSize > viewLength-offset ||
+                               ( out.count-1 ) > ( viewLength-offset-elementSize ) / out.stride )) ||
+          ( out.data - data ) % bytes != 0 || out.stride % bytes != 0 )
+      {
+         cerr << "Error: " << fileName << ": accessor " << a
+              << " does not fit its bufferView." << endl;
+         return false;
+      }
+   }
+
+   return true;
+}
+
+bool GLB::bufferView( int                   index,
+                      const unsigned char*& data,
+                      size_t&               size ) const
+{
+   // open() has checked every bufferView against the binary chunk
+   const Json& view   = json["bufferViews"][index];
+   size_t      offset = 0;
+
+   if( view.isNull() || !view["byteOffset"].asSize( offset, 0 ) || !view["byteLength"].asSize( size, 0 ))
+   {
+      return false;
+   }
+
+   data = bin + offset;
+   return true;
+}
+
+// =============================================================================
+// =============================================================================
+static void multiply( const double a[16],
+                      const double b[16],
+                      double       c[16] )
+{
+   double product[16];
+   for( int col=0; col<4; col++ )
+      for( int row=0; row<4; row++ )
+      {
+         product[col*4+row] = 0.0;
+         for( int k=0; k<4; k++ ) product[col*4+row] += a[k*4+row] * b[col*4+k];
+      }
+   memcpy( c, product, sizeof(product) );
+}
+
+// local transform of a node, from either "matrix" or translation, rotation
+// (a quaternion x y z w) and scale
+static void nodeMatrix( const Json& node,
+                        double      m[16] )
+{
+   if( node["matrix"].size() == 16 )
+   {
+      for( int i=0; i<16; i++ ) m[i] = node["matrix"][i].asDouble( 0.0 );
+      return;
+   }
+
+   const Json& t = node["translation"];
+   const Json& r = node["rotation"];
+   const Json& s = node["scale"];
+
+   double x = r[0].asDouble( 0.0 ), y = r[1].asDouble( 0.0 );
+   double z = r[2].asDouble( 0.0 ), w = r[3].asDouble( 1.0 );
+   double scale[3] = { s[0].asDouble( 1.0 ), s[1].asDouble( 1.0 ), s[2].asDouble( 1.0 ) };
+
+   double rotation[9] =
+   {
+      1 - 2*(y*y + z*z),     2*(x*y + z*w),     2*(x*z - y*w),
+          2*(x*y - z*w), 1 - 2*(x*x + z*z),     2*(y*z + x*w),
+          2*(x*z + y*w),     2*(y*z - x*w), 1 - 2*(x*x + y*y)
+   };
+
+   for( int col=0; col<3; col++ )
+   {
+      for( int row=0; row<3; row++ ) m[col*4+row] = rotation[col*3+row] * scale[col];
+      m[col*4+3] = 0.0;
+   }
+   m[12] = t[0].asDouble( 0.0 );
+   m[13] = t[1].asDouble( 0.0 );
+   m[14] = t[2].asDouble( 0.0 );
+   m[15] = 1.0;
+}
+
+void GLB::meshTransform( int    mesh,
+                         double matrix[16] ) const
+{
+   const Json& nodes = json["nodes"];
+
+   vector<int> parent( nodes.size(), -1 );
+   for( size_t n=0; n<nodes.size(); n++ )
+   {
+      const Json& children = nodes[n]["children"];
+      for( size_t c=0; c<children.size(); c++ )
+      {
+         int child = children[c].asInt();
+         if( child >= 0 && child < (int) nodes.size() ) parent[child] = (int) n;
+      }
+   }
+
+   for( int i=0; i<16; i++ ) matrix[i] = i % 5 == 0 ? 1.0 : 0.0;
+
+   int node = -1;
+   for( size_t n=0; n<nodes.size() && node < 0; n++ )
+   {
+      if( nodes[n]["mesh"].asInt() == mesh ) node = (int) n;
+   }
+
+   // the depth bound stops at cycles, which a valid file doesn't have
+   for( size_t depth=0; node >= 0 && depth<nodes.size(); depth++ )
+   {
+      double local[16];
+      nodeMatrix( nodes[node], local );
+      multiply( local, matrix, matrix );
+      node = parent[node];
+   }
+}
@@ -0,0 +1,166 @@
+////////////////////////////////////////////////////////////////////////////////
+// glb.h
+//
+// DESCRIPTION: read-only access to binary glTF (.glb) files without copying
+//              them.  The file is mapped into memory, its JSON chunk is
+//              parsed into a small document tree, and every accessor is
+//              exposed as a typed view straight into the mapped binary chunk:
+//
+//                 GLB glb;
+//                 glb.open( "blub/blub.glb" );
+//                 View<float>          position = glb.view<float>( 0 );
+//                 View<unsigned short> index    = glb.view<unsigned short>( 3 );
+//                 float y = position[17][1];
+//
+//              Only what meshes and their textures need is supported: a
+//              single binary chunk, bufferViews into it, and accessors that
+//              are not sparse.  Views give the stored values as they are,
+//              without applying "normalized".  Functions that fail print an
+//              error and return false, like the rest of the tools.
+//
+// LICENSE:
+//    Released into the public domain.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GLB_H
+#define GLB_H
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <stddef.h>
+
+// MappedFile - a whole file mapped read-only, unmapped on destruction.
+struct MappedFile
+{
+   MappedFile( void ) : data( NULL ), size( 0 ) {}
+   ~MappedFile( void ) { close(); }
+
+   bool open( const std::string& fileName );
+   void close( void );
+
+   const unsigned char* data;
+   size_t               size;
+
+private:
+   MappedFile( const MappedFile& );
+   MappedFile& operator=( const MappedFile& );
+};
+
+// Json - a parsed JSON value.  Looking up a missing member or element gives a
+// null value rather than failing, so lookups can be chained.  asInt() and
+// asSize() only accept whole numbers in range; asSize() gives otherwise for a
+// missing value and returns false for anything else that isn't a size, such as
+// -1, 0.5 or 1e300, so that malformed files can be rejected.
+struct Json
+{
+   enum Type { NUL, BOOLEAN, NUMBER, STRING, ARRAY, OBJECT };
+
+   Json( void ) : type( NUL ), number( 0.0 ) {}
+
+   bool parse( const char* begin, const char* end );
+
+   const Json& operator[]( const char* key ) const;
+   const Json& operator[]( int i ) const;
+
+   size_t size( void ) const { return type == ARRAY ? array.size() : object.size(); }
+   bool   isNull( void ) const { return type == NUL; }
+   int    asInt( int otherwise = -1 ) const;
+   bool   asSize( size_t& value, size_t otherwise ) const;
+   double asDouble( double otherwise ) const { return type == NUMBER ? number : otherwise; }
+
+   Type                                      type;
+   double                                    number;   // also 0 or 1 for BOOLEAN
+   std::string                               text;
+   std::vector<Json>                         array;
+   std::vector< std::pair<std::string,Json> > object;
+};
+
+// glTF componentType values
+enum
+{
+   GLB_BYTE           = 5120,
+   GLB_UNSIGNED_BYTE  = 5121,
+   GLB_SHORT          = 5122,
+   GLB_UNSIGNED_SHORT = 5123,
+   GLB_UNSIGNED_INT   = 5125,
+   GLB_FLOAT          = 5126
+};
+
+// Accessor - where the elements of a glTF accessor live in the mapped file.
+// Element i starts at data + i*stride and holds components values.
+struct Accessor
+{
+   const unsigned char* data;
+   size_t               count;
+   size_t               stride;
+   int                  componentType;
+   int                  components;
+};
+
+// View - typed, bounds-unchecked access to an accessor.  view[i] points at
+// the components of element i.
+template <class T>
+struct View
+{
+   View( void ) : data( NULL ), count( 0 ), stride( 0 ), components( 0 ) {}
+
+   const T* operator[]( size_t i ) const { return (const T*)( data + i*stride ); }
+
+   const unsigned char* data;
+   size_t               count;
+   size_t               stride;
+   int                  components;
+};
+
+// plain char is unsigned on some platforms, so bytes are signed char (int8_t)
+template <class T> struct ComponentType;
+template <> struct ComponentType<signed char>    { enum { value = GLB_BYTE           }; };
+template <> struct ComponentType<unsigned char>  { enum { value = GLB_UNSIGNED_BYTE  }; };
+template <> struct ComponentType<short>          { enum { value = GLB_SHORT          }; };
+template <> struct ComponentType<unsigned short> { enum { value = GLB_UNSIGNED_SHORT }; };
+template <> struct ComponentType<unsigned int>   { enum { value = GLB_UNSIGNED_INT   }; };
+template <> struct ComponentType<float>          { enum { value = GLB_FLOAT          }; };
+
+// GLB - a mapped .glb file.  accessors[] is filled and checked against the
+// size of the binary chunk by open(), so views never reach outside the file.
+struct GLB
+{
+   GLB( void ) : bin( NULL ), binSize( 0 ) {}
+
+   bool open( const std::string& fileName );
+
+   // view() returns an empty view if the accessor doesn't exist or doesn't
+   // hold values of type T.
+   template <class T>
+   View<T> view( int accessor ) const
+   {
+      View<T> v;
+      if( accessor >= 0 && accessor < (int) accessors.size() &&
+          accessors[accessor].componentType == ComponentType<T>::value )
+      {
+         v.data       = accessors[accessor].data;
+         v.count      = accessors[accessor].count;
+         v.stride     = accessors[accessor].stride;
+         v.components = accessors[accessor].components;
+      }
+      return v;
+   }
+
+   // bytes of a bufferView, e.g. an embedded image
+   bool bufferView( int index, const unsigned char*& data, size_t& size ) const;
+
+   // the transform from the coordinates of a mesh to the scene, as a
+   // column-major 4x4 matrix: the product of the transforms of the first node
+   // using the mesh and of all its ancestors
+   void meshTransform( int mesh, double matrix[16] ) const;
+
+   MappedFile            file;
+   Json                  json;
+   const unsigned char*  bin;
+   size_t                binSize;
+   std::vector<Accessor> accessors;
+};
+
+#endif
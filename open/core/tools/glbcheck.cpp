@@ -0,0 +1,651 @@
+////////////////////////////////////////////////////////////////////////////////
+// glbcheck.cpp
+//
+// DESCRIPTION: checks that a binary glTF asset and the OBJ+MTL version of it,
+//              such as blub/blub.glb and blub/blub.obj, describe the same
+//              textured mesh, and caches the decoded diffuse texture so that
+//              later loads can map it (see texture.h).  The first primitive of
+//              the first mesh in the GLB is compared with the OBJ triangle by
+//              triangle, in order, as exporters write them:
+//
+//                 triangles - the same number of triangles
+//                 positions - POSITION, moved into the scene by the node
+//                             transforms, matches the OBJ "v" of each corner
+//                 uvs       - TEXCOORD_0 with v flipped (glTF puts the origin
+//                             at the top left) matches the OBJ "vt"
+//                 normals   - NORMAL is unit length, and matches the OBJ
+//                             "vn" if there is one
+//                 texture   - the base color image embedded in the GLB
+//                             decodes to the same pixels as the map_Kd
+//                             texture of the MTL file
+//
+//              Prints one line per check and exits with status 1 if any
+//              fails.  The texture cache is then written and checked by
+//              mapping it back.
+//
+//              With -bench, loading the asset is timed both ways: cold is
+//              what a test does without this tool, parsing the OBJ and MTL
+//              and decoding the PNG; warm maps the GLB and the texture cache
+//              and builds the accessor views, which takes the same time
+//              whatever the size of the asset.  Warm is also timed reading
+//              one byte of every page, as using the data would.
+// USAGE:
+//    glbcheck [options] asset.glb asset.obj
+//
+//              options - any of
+//
+//                 -cache file - where to write the decoded texture (default:
+//                               the map_Kd file with its extension replaced
+//                               by ".rgba")
+//
+//                 -bench n - time n cold and n warm loads and print the
+//                            median and fastest of each
+//
+//                 -drop - before each timed load, ask the kernel to drop the
+//                         files from the page cache, so that cold and warm
+//                         also start from disk
+//
+// BUILD:
+//    g++ -std=c++17 -O2 -o glbcheck glbcheck.cpp glb.cpp texture.cpp -lz
+//
+// LICENSE:
+//    Released into the public domain.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "glb.h"
+#include "texture.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace std;
+
+// TexturedMesh - an OBJ file as triangles.  Each corner of triangle t is
+// corner[9*t + 3*k + {0,1,2}], the zero-based position, uv and normal
+// indices of corner k, with -1 for a missing uv or normal.
+struct TexturedMesh
+{
+   vector<float> position;
+   vector<float> uv;
+   vector<float> normal;
+   vector<int>   corner;
+   string        library;   // MTL file and its map_Kd texture, relative to
+   string        diffuse;   // the working directory
+};
+
+// Primitive - the views of a GLB mesh primitive that the checks need
+struct Primitive
+{
+   View<float> position;
+   View<float> normal;
+   View<float> uv;
+   Accessor    indices;
+   int         image;
+   double      transform[16];
+};
+
+void printHelp( void );
+
+bool loadOBJ( const string& fileName, TexturedMesh& mesh );
+bool loadMTL( const string& fileName, const string& material, string& diffuse );
+bool findPrimitive( const GLB& glb, Primitive& primitive );
+bool check( const GLB& glb, const Primitive& primitive, const TexturedMesh& mesh );
+void benchmark( const string& glbName, const string& objName, const string& cacheName,
+                const TexturedMesh& mesh, int runs, bool drop );
+
+// =============================================================================
+// =============================================================================
+int main( int argc, char **argv )
+{
+   string cacheName;
+   int    runs = 0;
+   bool   drop = false;
+   int    arg  = 1;
+
+   while( arg < argc && argv[arg][0] == '-' )
+   {
+      string option = argv[arg];
+
+      if( option == "-help" )
+      {
+         printHelp();
+         exit( 1 );
+      }
+      else if( option == "-cache" && arg+1 < argc )
+      {
+         cacheName = argv[arg+1];
+         arg += 2;
+      }
+      else if( option == "-bench" && arg+1 < argc )
+      {
+         runs = atoi( argv[arg+1] );
+         arg += 2;
+      }
+      else if( option == "-drop" )
+      {
+         drop = true;
+         arg++;
+      }
+      else
+      {
+         cerr << "Error: unknown or incomplete option " << option << endl;
+         exit( 1 );
+      }
+   }
+
+   if( argc-arg != 2 )
+   {
+      cerr << "usage: " << argv[0] << " [options] asset.glb asset.obj" << endl;
+      cerr << "       (type -help for more options)" << endl;
+      exit( 1 );
+   }
+
+   string glbName = argv[arg];
+   string objName = argv[arg+1];
+
+   GLB          glb;
+   Primitive    primitive;
+   TexturedMesh mesh;
+
+   if( !glb.open( glbName ) || !findPrimitive( glb, primitive ) || !loadOBJ( objName, mesh ))
+   {
+      exit( 1 );
+   }
+
+   if( mesh.diffuse.empty() )
+   {
+      cerr << "Error: " << objName << " has no material with a map_Kd texture." << endl;
+      exit( 1 );
+   }
+
+   if( cacheName.empty() )
+   {
+      size_t dot   = mesh.diffuse.find_last_of( '.' );
+      size_t slash = mesh.diffuse.find_last_of( '/' );
+      cacheName = mesh.diffuse.substr( 0, dot != string::npos && ( slash == string::npos || dot > slash ) ? dot : string::npos ) + ".rgba";
+   }
+
+   if( !check( glb, primitive, mesh ))
+   {
+      exit( 1 );
+   }
+
+   // cache the texture and make sure it maps back to the same pixels -----
+   Image         image;
+   MappedTexture texture;
+
+   if( !loadPNG( mesh.diffuse, image ) ||
+       !writeTextureCache( cacheName, mesh.diffuse, image ))
+   {
+      exit( 1 );
+   }
+
+   if( !mapTexture( cacheName, mesh.diffuse, texture ) ||
+       texture.width != image.width || texture.height != image.height ||
+       memcmp( texture.pixels, image.pixels.data(), image.pixels.size() ) != 0 )
+   {
+      cerr << "Error: " << cacheName << " doesn't map back to the decoded texture." << endl;
+      exit( 1 );
+   }
+
+   cout << "cache: wrote " << cacheName << " (" << texture.width << " x " << texture.height << ")" << endl;
+
+   if( runs > 0 )
+   {
+      benchmark( glbName, objName, cacheName, mesh, runs, drop );
+   }
+
+   return 0;
+}
+
+// =============================================================================
+// =============================================================================
+void printHelp( void )
+{
+   cerr << " glbcheck                                                                       " << endl;
+   cerr << "                                                                                " << endl;
+   cerr << " DESCRIPTION: checks that a binary glTF asset and its OBJ+MTL version have the  " << endl;
+   cerr << "              same triangles, positions, uvs, normals and diffuse texture,      " << endl;
+   cerr << "              then caches the decoded texture in a raw file that loads by       " << endl;
+   cerr << "              mapping it.  Optionally times loading the asset from OBJ, MTL     " << endl;
+   cerr << "              and PNG (cold) against mapping the GLB and the cache (warm).      " << endl;
+   cerr << " USAGE:                                                                         " << endl;
+   cerr << "    glbcheck [options] asset.glb asset.obj                                      " << endl;
+   cerr << "                                                                                " << endl;
+   cerr << "              options - any of                                                  " << endl;
+   cerr << "                                                                                " << endl;
+   cerr << "                 -cache file - where to write the decoded texture (default:     " << endl;
+   cerr << "                               the map_Kd file with the extension \".rgba\")      " << endl;
+   cerr << "                                                                                " << endl;
+   cerr << "                 -bench n - time n cold and n warm loads                        " << endl;
+   cerr << "                                                                                " << endl;
+   cerr << "                 -drop - drop the files from the page cache before each load    " << endl;
+   cerr << endl;
+}
+
+// =============================================================================
+// =============================================================================
+// directory part of a path, with its trailing slash, or "" for none
+static string directoryOf( const string& fileName )
+{
+   size_t slash = fileName.find_last_of( '/' );
+   return slash == string::npos ? string() : fileName.substr( 0, slash+1 );
+}
+
+// zero-based index of an OBJ reference, which may be relative; -1 if absent
+static int objIndex( const string& text, size_t count )
+{
+   if( text.empty() ) return -1;
+
+   int i = atoi( text.c_str() );
+   return i < 0 ? (int) count + i : i - 1;
+}
+
+bool loadOBJ( const string& fileName,
+              TexturedMesh& mesh )
+{
+   ifstream in( fileName.c_str() );
+   if( !in.is_open())
+   {
+      cerr << "Error: couldn't open file " << fileName << " for input." << endl;
+      return false;
+   }
+
+   string line, token, material;
+   int    lineNumber = 0;
+
+   while( getline( in, line ))
+   {
+      lineNumber++;
+
+      istringstream words( line );
+      if( !( words >> token )) continue;
+
+      if( token == "v" || token == "vn" )
+      {
+         float p[3] = { 0.0f, 0.0f, 0.0f };
+         words >> p[0] >> p[1] >> p[2];
+         vector<float>& out = token == "v" ? mesh.position : mesh.normal;
+         out.insert( out.end(), p, p+3 );
+      }
+      else if( token == "vt" )
+      {
+         float t[2] = { 0.0f, 0.0f };
+         words >> t[0] >> t[1];
+         mesh.uv.insert( mesh.uv.end(), t, t+2 );
+      }
+      else if( token == "f" )
+      {
+         // "v", "v/t", "v//n" or "v/t/n" per corner; polygons become fans
+         vector<int> face;
+         size_t      counts[3] = { mesh.position.size()/3, mesh.uv.size()/2, mesh.normal.size()/3 };
+
+         while( words >> token )
+         {
+            string part[3];
+            size_t a = token.find( '/' );
+            size_t b = a == string::npos ? string::npos : token.find( '/', a+1 );
+
+            part[0] = token.substr( 0, a );
+            if( a != string::npos ) part[1] = token.substr( a+1, b == string::npos ? string::npos : b-a-1 );
+            if( b != string::npos ) part[2] = token.substr( b+1 );
+
+            for( int k=0; k<3; k++ )
+            {
+               int i = objIndex( part[k], counts[k] );
+               if(( k == 0 && i < 0 ) || i >= (int) counts[k] || ( i < 0 && !part[k].empty() ))
+               {
+                  cerr << "Error: " << fileName << ":" << lineNumber
+                       << ": index " << token << " out of range." << endl;
+                  return false;
+               }
+               face.push_back( i );
+            }
+         }
+
+         int n = (int) face.size() / 3;
+         for( int k=1; k+1<n; k++ )
+         {
+            mesh.corner.insert( mesh.corner.end(), &face[0],     &face[3]       );
+            mesh.corner.insert( mesh.corner.end(), &face[3*k],   &face[3*k+3]   );
+            mesh.corner.insert( mesh.corner.end(), &face[3*k+3], &face[3*k+6]   );
+         }
+      }
+      else if( token == "mtllib" && mesh.library.empty() && words >> token )
+      {
+         mesh.library = directoryOf( fileName ) + token;
+      }
+      else if( token == "usemtl" && material.empty() )
+      {
+         words >> material;
+      }
+   }
+
+   return mesh.library.empty() || loadMTL( mesh.library, material, mesh.diffuse );
+}
+
+// loadMTL() finds the map_Kd texture of the named material, or of the first
+// material that has one if name is empty.
+bool loadMTL( const string& fileName,
+              const string& name,
+              string&       diffuse )
+{
+   ifstream in( fileName.c_str() );
+   if( !in.is_open())
+   {
+      cerr << "Error: couldn't open file " << fileName << " for input." << endl;
+      return false;
+   }
+
+   string line, token, current;
+
+   while( getline( in, line ))
+   {
+      istringstream words( line );
+      if( !( words >> token )) continue;
+
+      if( token == "newmtl" )
+      {
+         words >> current;
+      }
+      else if( token == "map_Kd" && ( name.empty() || name == current ))
+      {
+         // the file name comes last, after any options
+         string word;
+         while( words >> word ) token = word;
+
+         diffuse = directoryOf( fileName ) + token;
+         return true;
+      }
+   }
+
+   return true;
+}
+
+// =============================================================================
+// =============================================================================
+bool findPrimitive( const GLB& glb,
+                    Primitive& primitive )
+{
+   const Json& first      = glb.json["meshes"][0]["primitives"][0];
+   const Json& attributes = first["attributes"];
+
+   primitive.position = glb.view<float>( attributes["POSITION"].asInt() );
+   primitive.normal   = glb.view<float>( attributes["NORMAL"].asInt() );
+   primitive.uv       = glb.view<float>( attributes["TEXCOORD_0"].asInt() );
+
+   int indices = first["indices"].asInt();
+   int mode    = first["mode"].asInt( 4 );
+
+   if( primitive.position.count == 0 || primitive.position.components != 3 ||
+       indices < 0 || indices >= (int) glb.accessors.size() || mode != 4 )
+   {
+      cerr << "Error: the first mesh primitive is not a set of indexed triangles"
+           << " with float positions." << endl;
+      return false;
+   }
+   primitive.indices = glb.accessors[indices];
+
+   int texture     = glb.json["materials"][ first["material"].asInt() ]
+                             ["pbrMetallicRoughness"]["baseColorTexture"]["index"].asInt();
+   primitive.image = glb.json["textures"][texture]["source"].asInt();
+
+   glb.meshTransform( 0, primitive.transform );
+
+   return true;
+}
+
+static unsigned int readIndex( const Accessor& indices,
+                               size_t          i )
+{
+   const unsigned char* p = indices.data + i*indices.stride;
+
+   switch( indices.componentType )
+   {
+      case GLB_UNSIGNED_BYTE:  return *p;
+      case GLB_UNSIGNED_SHORT: return *(const unsigned short*) p;
+      case GLB_UNSIGNED_INT:   return *(const unsigned int*) p;
+   }
+   return ~0u;
+}
+
+static void report( const char* name, bool ok, const string& detail )
+{
+   cout << name << ": " << ( ok ? "ok" : "FAILED" ) << " (" << detail << ")" << endl;
+}
+
+bool check( const GLB&          glb,
+            const Primitive&    primitive,
+            const TexturedMesh& mesh )
+{
+   const double tolerance = 1e-5;
+   const double* m = primitive.transform;
+
+   size_t nTriangles = mesh.corner.size() / 9;
+   size_t nCorners   = 3 * nTriangles;
+   bool   ok         = true;
+
+   // triangles ----------------------------------------------------------
+   bool sameCount = primitive.indices.count == nCorners;
+   report( "triangles", sameCount, to_string( primitive.indices.count/3 ) + " in the GLB, " +
+                                   to_string( nTriangles ) + " in the OBJ" );
+   if( !sameCount )
+   {
+      return false;
+   }
+
+   // positions, uvs and normals, corner by corner ----------------------
+   long badPosition = -1, badUV = -1, badNormal = -1, badLength = -1;
+   bool checkUVs     = primitive.uv.count > 0;
+   bool checkNormals = primitive.normal.count > 0;
+
+   // normals move by the inverse transpose; the upper 3x3 of a rotation and
+   // scale is enough here, and its cofactor matrix is that up to scale
+   double n[9] =
+   {
+      m[5]*m[10] - m[6]*m[9],  m[6]*m[8] - m[4]*m[10], m[4]*m[9] - m[5]*m[8],
+      m[2]*m[9]  - m[1]*m[10], m[0]*m[10] - m[2]*m[8], m[1]*m[8] - m[0]*m[9],
+      m[1]*m[6]  - m[2]*m[5],  m[2]*m[4] - m[0]*m[6],  m[0]*m[5] - m[1]*m[4]
+   };
+
+   for( size_t c=0; c<nCorners; c++ )
+   {
+      unsigned int v  = readIndex( primitive.indices, c );
+      const int*   in = &mesh.corner[3*c];
+
+      if( v >= primitive.position.count )
+      {
+         cerr << "Error: GLB index " << v << " of corner " << c << " out of range." << endl;
+         return false;
+      }
+
+      const float* p = primitive.position[v];
+      for( int k=0; k<3 && badPosition < 0; k++ )
+      {
+         double world = m[k]*p[0] + m[4+k]*p[1] + m[8+k]*p[2] + m[12+k];
+         if( fabs( world - mesh.position[3*in[0]+k] ) > tolerance ) badPosition = c;
+      }
+
+      if( checkUVs && badUV < 0 &&
+          ( v >= primitive.uv.count || in[1] < 0 ||
+            fabs( primitive.uv[v][0]        - mesh.uv[2*in[1]+0] ) > tolerance ||
+            fabs( 1.0 - primitive.uv[v][1]  - mesh.uv[2*in[1]+1] ) > tolerance ))
+      {
+         badUV = c;
+      }
+
+      if( checkNormals && v < primitive.normal.count )
+      {
+         const float* q = primitive.normal[v];
+         double length = sqrt( q[0]*q[0] + q[1]*q[1] + q[2]*q[2] );
+         if( badLength < 0 && fabs( length - 1.0 ) > 1e-3 ) badLength = c;
+
+         if( in[2] >= 0 && badNormal < 0 )
+         {
+            double world[3], worldLength = 0.0, objLength = 0.0, dot = 0.0;
+            for( int k=0; k<3; k++ )
+            {
+               world[k]     = n[k]*q[0] + n[3+k]*q[1] + n[6+k]*q[2];
+               worldLength += world[k]*world[k];
+               objLength   += mesh.normal[3*in[2]+k] * mesh.normal[3*in[2]+k];
+               dot         += world[k] * mesh.normal[3*in[2]+k];
+            }
+            if( dot < ( 1.0 - 1e-4 ) * sqrt( worldLength * objLength )) badNormal = c;
+         }
+      }
+      else if( checkNormals )
+      {
+         badLength = badLength < 0 ? c : badLength;
+      }
+   }
+
+   auto detail = [&]( long bad, const string& what )
+   {
+      return bad < 0 ? to_string( nCorners ) + " corners " + what
+                     : "first mismatch at triangle " + to_string( bad/3 + 1 ) +
+                       " corner " + to_string( bad%3 + 1 );
+   };
+
+   report( "positions", badPosition < 0, detail( badPosition, "match" ));
+   ok = ok && badPosition < 0;
+
+   if( checkUVs )
+   {
+      report( "uvs", badUV < 0, detail( badUV, "match" ));
+      ok = ok && badUV < 0;
+   }
+
+   if( checkNormals )
+   {
+      bool objNormals = !mesh.normal.empty();
+      long bad        = badLength >= 0 ? badLength : badNormal;
+      report( "normals", bad < 0, detail( bad, objNormals ? "match" : "are unit length, the OBJ has none" ));
+      ok = ok && bad < 0;
+   }
+
+   // texture ------------------------------------------------------------
+   const unsigned char* png;
+   size_t               pngSize;
+   Image                embedded, diffuse;
+
+   int view = glb.json["images"][primitive.image]["bufferView"].asInt();
+   if( !glb.bufferView( view, png, pngSize ))
+   {
+      report( "texture", false, "the GLB has no embedded base color image" );
+      return false;
+   }
+
+   if( !decodePNG( png, pngSize, "the GLB base color image", embedded ) ||
+       !loadPNG( mesh.diffuse, diffuse ))
+   {
+      return false;
+   }
+
+   bool sameTexture = embedded.width == diffuse.width && embedded.height == diffuse.height &&
+                      embedded.pixels == diffuse.pixels;
+   report( "texture", sameTexture, to_string( embedded.width ) + " x " + to_string( embedded.height ) +
+                                   " in the GLB, " + to_string( diffuse.width ) + " x " +
+                                   to_string( diffuse.height ) + " in " + mesh.diffuse );
+
+   return ok && sameTexture;
+}
+
+// =============================================================================
+// =============================================================================
+static void dropFromPageCache( const string& fileName )
+{
+   int fd = open( fileName.c_str(), O_RDONLY );
+   if( fd >= 0 )
+   {
+      posix_fadvise( fd, 0, 0, POSIX_FADV_DONTNEED );
+      close( fd );
+   }
+}
+
+// one byte of every page, so that each one is actually read
+static unsigned int touch( const unsigned char* data,
+                           size_t               size )
+{
+   unsigned int sum = 0;
+   for( size_t i=0; i<size; i+=4096 ) sum += data[i];
+   return sum;
+}
+
+void benchmark( const string&       glbName,
+                const string&       objName,
+                const string&       cacheName,
+                const TexturedMesh& mesh,
+                int                 runs,
+                bool                drop )
+{
+   typedef chrono::steady_clock Clock;
+
+   const char*    names[] = { "cold (OBJ + MTL + PNG)", "warm (mapped GLB + cache)", "warm, every page read" };
+   vector<double> times[3];
+   unsigned int   sum = 0;
+
+   for( int r=0; r<runs; r++ )
+   {
+      for( int mode=0; mode<3; mode++ )
+      {
+         if( drop )
+         {
+            const string files[] = { glbName, objName, mesh.library, mesh.diffuse, cacheName };
+            for( const string& f : files ) if( !f.empty() ) dropFromPageCache( f );
+         }
+
+         Clock::time_point start = Clock::now();
+
+         if( mode == 0 )
+         {
+            TexturedMesh cold;
+            Image        image;
+            if( !loadOBJ( objName, cold ) || !loadPNG( cold.diffuse, image )) exit( 1 );
+            sum += image.pixels[0];
+         }
+         else
+         {
+            GLB           glb;
+            Primitive     primitive;
+            MappedTexture texture;
+
+            if( !glb.open( glbName ) || !findPrimitive( glb, primitive ) ||
+                !mapTexture( cacheName, mesh.diffuse, texture ))
+            {
+               cerr << "Error: couldn't map the asset." << endl;
+               exit( 1 );
+            }
+
+            if( mode == 2 )
+            {
+               sum += touch( glb.file.data, glb.file.size ) +
+                      touch( texture.file.data, texture.file.size );
+            }
+         }
+
+         times[mode].push_back( chrono::duration<double>( Clock::now() - start ).count() );
+      }
+   }
+
+   for( int mode=0; mode<3; mode++ )
+   {
+      sort( times[mode].begin(), times[mode].end() );
+      printf( "%-26s median %9.3f ms  fastest %9.3f ms\n", names[mode],
+              1e3 * times[mode][ times[mode].size()/2 ], 1e3 * times[mode][0] );
+   }
+
+   // keeps the reads above from being optimized away
+   if( sum == 1 ) cout << endl;
+}
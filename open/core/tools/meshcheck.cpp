@@ -0,0 +1,653 @@
+////////////////////////////////////////////////////////////////////////////////
+// meshcheck.cpp
+//
+// DESCRIPTION: validates the connectivity of Wavefront OBJ meshes, such as the
+//              corpus files in this directory or the output of tiling.cpp,
+//              and prints a JSON report.  The checks are
+//
+//                 out_of_range_indices     - faces referring to a vertex that
+//                                            does not exist (including 0 and
+//                                            relative indices that reach
+//                                            past the first vertex)
+//                 degenerate_faces         - faces with fewer than three
+//                                            corners or a repeated vertex
+//                 non_manifold_edges       - edges shared by more than two
+//                                            faces
+//                 inconsistent_orientation - edges shared by two faces that
+//                                            traverse it in the same direction
+//                 unreferenced_vertices    - vertices used by no face
+//
+//              Each check reports a count and the first few locations.  All
+//              locations are 1-based, i.e. they match the numbering used in
+//              the OBJ file itself ("faces" count only "f" lines).
+//
+//              Everything runs in linear time on all available cores: the
+//              file is mapped and parsed in parallel chunks, and edges are
+//              matched by bucketing half-edges on their smaller endpoint
+//              (a counting sort) and sorting each tiny bucket, rather than by
+//              inserting them into a map.
+// USAGE:
+//    meshcheck [-j threads] [-max N] file.obj [file.obj ...]
+//
+//              -j threads - number of worker threads (default: all cores)
+//
+//              -max N - number of locations listed per check (default 10)
+//
+// BUILD:
+//    g++ -O2 -pthread -o meshcheck meshcheck.cpp
+//
+// LICENSE:
+//    Released into the public domain.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using namespace std;
+
+// Mesh - face connectivity of an OBJ file.  Vertex indices are zero-based and
+// already resolved; anything that did not name an existing vertex is stored
+// as -1.  Face i uses faceIndex[ faceStart[i] ] through
+// faceIndex[ faceStart[i+1]-1 ].
+struct Mesh
+{
+   int64_t         nVertices;
+   vector<int64_t> faceStart;
+   vector<int32_t> faceIndex;
+};
+
+// Check - the result of one check: how many problems, and where the first
+// few of them are.  Edge locations use two entries per edge.
+struct Check
+{
+   Check( void ) : count( 0 ) {}
+
+   int64_t         count;
+   vector<int64_t> where;
+};
+
+struct Report
+{
+   int64_t nEdges;
+   int64_t nBoundaryEdges;
+
+   Check outOfRange;
+   Check degenerate;
+   Check nonManifold;
+   Check orientation;
+   Check unreferenced;
+};
+
+void printHelp( void );
+
+bool loadOBJ( const char* fileName, Mesh& mesh, int nThreads );
+void checkMesh( const Mesh& mesh, Report& report, int nThreads, int maxLocations );
+void printReport( const char* fileName, const Mesh& mesh, const Report& report,
+                  double seconds );
+
+template <class Job>
+void parallelFor( int nThreads, int64_t n, Job job );
+
+// =============================================================================
+// =============================================================================
+int main( int argc, char **argv )
+{
+   int nThreads     = max( 1, (int) thread::hardware_concurrency() );
+   int maxLocations = 10;
+   int arg = 1;
+
+   while( arg < argc && argv[arg][0] == '-' )
+   {
+      string option = argv[arg];
+
+      if( option == "-help" )
+      {
+         printHelp();
+         exit( 1 );
+      }
+
+      if( arg+1 >= argc || ( option != "-j" && option != "-max" ))
+      {
+         cerr << "Error: unknown or incomplete option " << option << endl;
+         exit( 1 );
+      }
+
+      if( option == "-j"   ) nThreads     = max( 1, atoi( argv[arg+1] ));
+      if( option == "-max" ) maxLocations = max( 0, atoi( argv[arg+1] ));
+
+      arg += 2;
+   }
+
+   if( arg >= argc )
+   {
+      cerr << "usage: " << argv[0] << " [-j threads] [-max N] file.obj [file.obj ...]" << endl;
+      cerr << "       (type -help for more options)" << endl;
+      exit( 1 );
+   }
+
+   int  status = 0;
+   bool first  = true;
+
+   cout << "[";
+   for( ; arg < argc; arg++ )
+   {
+      chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+      Mesh mesh;
+      if( !loadOBJ( argv[arg], mesh, nThreads ))
+      {
+         status = 1;
+         continue;
+      }
+
+      Report report;
+      checkMesh( mesh, report, nThreads, maxLocations );
+
+      double seconds = chrono::duration<double>( chrono::steady_clock::now() - start ).count();
+      cout << ( first ? "\n" : ",\n" );
+      printReport( argv[arg], mesh, report, seconds );
+      first = false;
+   }
+   cout << "\n]" << endl;
+
+   return status;
+}
+
+// =============================================================================
+// =============================================================================
+void printHelp( void )
+{
+   cerr << " meshcheck                                                                      " << endl;
+   cerr << "                                                                                " << endl;
+   cerr << " DESCRIPTION: validates the connectivity of Wavefront OBJ meshes and prints a   " << endl;
+   cerr << "              JSON report with one entry per file.  Checks for out-of-range     " << endl;
+   cerr << "              indices, degenerate faces, non-manifold edges, inconsistently     " << endl;
+   cerr << "              oriented edges and unreferenced vertices.  Locations are 1-based. " << endl;
+   cerr << " USAGE:                                                                         " << endl;
+   cerr << "    meshcheck [-j threads] [-max N] file.obj [file.obj ...]                     " << endl;
+   cerr << "                                                                                " << endl;
+   cerr << "              -j threads - number of worker threads (default: all cores)        " << endl;
+   cerr << "                                                                                " << endl;
+   cerr << "              -max N - number of locations listed per check (default 10)        " << endl;
+   cerr << endl;
+}
+
+// =============================================================================
+// =============================================================================
+// parallelFor() splits [0,n) into one contiguous block per thread and calls
+// job( thread, begin, end ) for each; blocks are in thread order.
+template <class Job>
+void parallelFor( int     nThreads,
+                  int64_t n,
+                  Job     job )
+{
+   vector<thread> pool;
+
+   for( int t=1; t<nThreads; t++ )
+   {
+      pool.push_back( thread( job, t, n*t/nThreads, n*(t+1)/nThreads ));
+   }
+   job( 0, (int64_t) 0, n/nThreads );
+   for( size_t t=0; t<pool.size(); t++ )
+   {
+      pool[t].join();
+   }
+}
+
+// =============================================================================
+// =============================================================================
+// Chunk - what one thread found in its share of the file.  Negative (relative)
+// indices can only be resolved once the number of vertices in the preceding
+// chunks is known, so they are stored relative to the start of the chunk and
+// their positions remembered in "relative".
+struct Chunk
+{
+   int64_t         nVertices;
+   vector<int64_t> faceSize;
+   vector<int64_t> faceIndex;
+   vector<int64_t> relative;
+};
+
+static const char* parseChunk( const char* p,
+                               const char* end,
+                               Chunk&      chunk )
+{
+   chunk.nVertices = 0;
+
+   while( p < end )
+   {
+      // skip leading blanks
+      while( p < end && ( *p == ' ' || *p == '\t' )) p++;
+
+      if( end-p >= 2 && p[0] == 'v' && ( p[1] == ' ' || p[1] == '\t' ))
+      {
+         chunk.nVertices++;
+      }
+      else if( end-p >= 2 && p[0] == 'f' && ( p[1] == ' ' || p[1] == '\t' ))
+      {
+         int64_t n = 0;
+         p++;
+
+         while( p < end && *p != '\n' )
+         {
+            while( p < end && ( *p == ' ' || *p == '\t' || *p == '\r' )) p++;
+            if( p == end || *p == '\n' || *p == '#' ) break;
+
+            // read the vertex part of a "v", "v/t", "v//n" or "v/t/n" corner
+            bool    negative = false;
+            int64_t value    = 0;
+            bool    digits   = false;
+
+            if( *p == '-' ) { negative = true; p++; }
+            while( p < end && *p >= '0' && *p <= '9' )
+            {
+               if( value < INT64_MAX/10 ) value = 10*value + (*p - '0');
+               digits = true;
+               p++;
+            }
+            while( p < end && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n' ) p++;
+
+            if( !digits || value == 0 )
+            {
+               chunk.faceIndex.push_back( -1 );
+            }
+            else if( negative )
+            {
+               chunk.relative.push_back( (int64_t) chunk.faceIndex.size() );
+               chunk.faceIndex.push_back( chunk.nVertices - value );
+            }
+            else
+            {
+               chunk.faceIndex.push_back( value - 1 );
+            }
+            n++;
+         }
+
+         chunk.faceSize.push_back( n );
+      }
+
+      // move on to the next line
+      while( p < end && *p != '\n' ) p++;
+      if( p < end ) p++;
+   }
+
+   return p;
+}
+
+// =============================================================================
+// =============================================================================
+bool loadOBJ( const char* fileName,
+              Mesh&       mesh,
+              int         nThreads )
+{
+   int fd = open( fileName, O_RDONLY );
+   if( fd < 0 )
+   {
+      cerr << "Error: couldn't open file " << fileName << " for input." << endl;
+      return false;
+   }
+
+   struct stat info;
+   fstat( fd, &info );
+   size_t size = info.st_size;
+
+   const char* data = NULL;
+   if( size > 0 )
+   {
+      void* map = mmap( NULL, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+      if( map == MAP_FAILED )
+      {
+         cerr << "Error: couldn't map file " << fileName << endl;
+         close( fd );
+         return false;
+      }
+      madvise( map, size, MADV_SEQUENTIAL );
+      data = (const char*) map;
+   }
+   close( fd );
+
+   // small files are not worth splitting
+   if( size < ((size_t) 1 << 20) )
+   {
+      nThreads = 1;
+   }
+
+   // cut the file into one chunk per thread, at line boundaries
+   vector<const char*> cut( nThreads+1 );
+   cut[0]        = data;
+   cut[nThreads] = data + size;
+
+   for( int t=1; t<nThreads; t++ )
+   {
+      const char* p = max( cut[t-1], data + size*t/nThreads );
+      while( p > cut[t-1] && p < data+size && p[-1] != '\n' ) p++;
+      cut[t] = p;
+   }
+
+   vector<Chunk> chunk( nThreads );
+
+   parallelFor( nThreads, nThreads, [&]( int t, int64_t, int64_t )
+   {
+      parseChunk( cut[t], cut[t+1], chunk[t] );
+   });
+
+   if( size > 0 )
+   {
+      munmap( (void*) data, size );
+   }
+
+   // stitch the chunks together
+   vector<int64_t> vertexBase( nThreads+1, 0 );
+   vector<int64_t> faceBase  ( nThreads+1, 0 );
+   vector<int64_t> indexBase ( nThreads+1, 0 );
+
+   for( int t=0; t<nThreads; t++ )
+   {
+      vertexBase[t+1] = vertexBase[t] + chunk[t].nVertices;
+        faceBase[t+1] =   faceBase[t] + (int64_t) chunk[t].faceSize.size();
+       indexBase[t+1] =  indexBase[t] + (int64_t) chunk[t].faceIndex.size();
+   }
+
+   mesh.nVertices = vertexBase[nThreads];
+   mesh.faceStart.resize( faceBase[nThreads]+1 );
+   mesh.faceIndex.resize( indexBase[nThreads] );
+
+   if( mesh.nVertices > INT32_MAX || faceBase[nThreads] >= INT32_MAX )
+   {
+      cerr << "Error: " << fileName << " is too large to check." << endl;
+      return false;
+   }
+
+   parallelFor( nThreads, nThreads, [&]( int t, int64_t, int64_t )
+   {
+      Chunk& c = chunk[t];
+
+      for( size_t k=0; k<c.relative.size(); k++ )
+      {
+         c.faceIndex[ c.relative[k] ] += vertexBase[t];
+      }
+
+      int64_t start = indexBase[t];
+      for( size_t i=0; i<c.faceSize.size(); i++ )
+      {
+         mesh.faceStart[ faceBase[t]+i ] = start;
+         start += c.faceSize[i];
+      }
+
+      for( size_t k=0; k<c.faceIndex.size(); k++ )
+      {
+         int64_t v = c.faceIndex[k];
+         mesh.faceIndex[ indexBase[t]+k ] = ( v >= 0 && v < mesh.nVertices ) ? (int32_t) v : -1;
+      }
+
+      vector<int64_t>().swap( c.faceIndex );
+   });
+
+   mesh.faceStart.back() = indexBase[nThreads];
+
+   return true;
+}
+
+// =============================================================================
+// =============================================================================
+// Keep a thread's first few locations; merged in thread order afterwards so
+// the report is the same whatever the number of threads.
+static void note( Check&  check,
+                  int     maxLocations,
+                  int64_t a,
+                  int64_t b = -1 )
+{
+   check.count++;
+   if( check.where.size() < (size_t) (b < 0 ? maxLocations : 2*maxLocations) )
+   {
+      check.where.push_back( a );
+      if( b >= 0 ) check.where.push_back( b );
+   }
+}
+
+static void merge( Check&             total,
+                   const Check&       part,
+                   size_t             maxEntries )
+{
+   total.count += part.count;
+   for( size_t k=0; k<part.where.size() && total.where.size() < maxEntries; k++ )
+   {
+      total.where.push_back( part.where[k] );
+   }
+}
+
+// =============================================================================
+// =============================================================================
+void checkMesh( const Mesh& mesh,
+                Report&     report,
+                int         nThreads,
+                int         maxLocations )
+{
+   int64_t nVertices = mesh.nVertices;
+   int64_t nFaces    = (int64_t) mesh.faceStart.size() - 1;
+
+   if( nFaces < 4096 && nVertices < 4096 )
+   {
+      nThreads = 1;
+   }
+
+   // the low bit of a half-edge record says which way its face runs along it
+   const uint32_t forward = 1;
+
+   // per-face checks, and count half-edges by their smaller endpoint --
+   vector< atomic<uint32_t> > bucketSize( nVertices+1 );
+   vector< atomic<uint8_t>  > referenced( nVertices );
+   vector<char>               usable( nFaces );
+   vector<Check>              outOfRange( nThreads ), degenerate( nThreads );
+
+   for( int64_t v=0; v<=nVertices; v++ ) bucketSize[v].store( 0, memory_order_relaxed );
+   for( int64_t v=0; v< nVertices; v++ ) referenced[v].store( 0, memory_order_relaxed );
+
+   parallelFor( nThreads, nFaces, [&]( int t, int64_t begin, int64_t end )
+   {
+      vector<int32_t> corners;
+
+      for( int64_t i=begin; i<end; i++ )
+      {
+         const int32_t* f = &mesh.faceIndex[ mesh.faceStart[i] ];
+         int64_t        n = mesh.faceStart[i+1] - mesh.faceStart[i];
+
+         bool valid = true;
+         for( int64_t j=0; j<n; j++ )
+         {
+            if( f[j] < 0 ) valid = false;
+            else referenced[ f[j] ].store( 1, memory_order_relaxed );
+         }
+
+         if( !valid )
+         {
+            note( outOfRange[t], maxLocations, i+1 );
+            usable[i] = 0;
+            continue;
+         }
+
+         corners.assign( f, f+n );
+         sort( corners.begin(), corners.end() );
+         if( n < 3 || adjacent_find( corners.begin(), corners.end() ) != corners.end() )
+         {
+            note( degenerate[t], maxLocations, i+1 );
+         }
+
+         usable[i] = 1;
+         for( int64_t j=0; j<n; j++ )
+         {
+            int32_t a = f[j], b = f[(j+1)%n];
+            if( a != b )
+            {
+               bucketSize[ min( a, b ) ].fetch_add( 1, memory_order_relaxed );
+            }
+         }
+      }
+   });
+
+   // scatter half-edges into their buckets ----------------------------
+   vector<int64_t> bucketStart( nVertices+1 );
+   int64_t nHalfEdges = 0;
+
+   for( int64_t v=0; v<nVertices; v++ )
+   {
+      bucketStart[v] = nHalfEdges;
+      nHalfEdges += bucketSize[v].load( memory_order_relaxed );
+      bucketSize[v].store( 0, memory_order_relaxed );
+   }
+   bucketStart[nVertices] = nHalfEdges;
+
+   // a record is the larger endpoint plus the face number and direction
+   vector<uint32_t> other( nHalfEdges );
+   vector<uint32_t> face ( nHalfEdges );
+
+   parallelFor( nThreads, nFaces, [&]( int, int64_t begin, int64_t end )
+   {
+      for( int64_t i=begin; i<end; i++ )
+      {
+         if( !usable[i] ) continue;
+
+         const int32_t* f = &mesh.faceIndex[ mesh.faceStart[i] ];
+         int64_t        n = mesh.faceStart[i+1] - mesh.faceStart[i];
+
+         for( int64_t j=0; j<n; j++ )
+         {
+            int32_t a = f[j], b = f[(j+1)%n];
+            if( a == b ) continue;
+
+            int32_t lo = min( a, b );
+            int64_t k  = bucketStart[lo] + bucketSize[lo].fetch_add( 1, memory_order_relaxed );
+
+            other[k] = (uint32_t) max( a, b );
+            face [k] = ((uint32_t) i << 1) | ( a < b ? forward : 0 );
+         }
+      }
+   });
+
+   // sort each bucket and look at runs of equal edges -----------------
+   vector<Check>   nonManifold( nThreads ), orientation( nThreads ), unreferenced( nThreads );
+   vector<int64_t> nEdges( nThreads, 0 ), nBoundary( nThreads, 0 );
+
+   parallelFor( nThreads, nVertices, [&]( int t, int64_t begin, int64_t end )
+   {
+      vector< pair<uint32_t,uint32_t> > bucket;
+
+      for( int64_t v=begin; v<end; v++ )
+      {
+         if( !referenced[v].load( memory_order_relaxed ))
+         {
+            note( unreferenced[t], maxLocations, v+1 );
+         }
+
+         bucket.clear();
+         for( int64_t k=bucketStart[v]; k<bucketStart[v+1]; k++ )
+         {
+            bucket.push_back( make_pair( other[k], face[k] ));
+         }
+         sort( bucket.begin(), bucket.end() );
+
+         for( size_t k=0; k<bucket.size(); )
+         {
+            size_t run = k+1;
+            while( run < bucket.size() && bucket[run].first == bucket[k].first ) run++;
+
+            nEdges[t]++;
+            if( run-k == 1 )
+            {
+               nBoundary[t]++;
+            }
+            else if( run-k > 2 )
+            {
+               note( nonManifold[t], maxLocations, v+1, (int64_t) bucket[k].first+1 );
+            }
+            else if(( bucket[k].second & forward ) == ( bucket[k+1].second & forward ))
+            {
+               note( orientation[t], maxLocations, v+1, (int64_t) bucket[k].first+1 );
+            }
+
+            k = run;
+         }
+      }
+   });
+
+   // gather the per-thread results ------------------------------------
+   report.nEdges         = 0;
+   report.nBoundaryEdges = 0;
+
+   for( int t=0; t<nThreads; t++ )
+   {
+      report.nEdges         += nEdges[t];
+      report.nBoundaryEdges += nBoundary[t];
+
+      merge( report.outOfRange,   outOfRange[t],     maxLocations );
+      merge( report.degenerate,   degenerate[t],     maxLocations );
+      merge( report.nonManifold,  nonManifold[t],  2*maxLocations );
+      merge( report.orientation,  orientation[t],  2*maxLocations );
+      merge( report.unreferenced, unreferenced[t],   maxLocations );
+   }
+}
+
+// =============================================================================
+// =============================================================================
+static void printCheck( const char*  name,
+                        const char*  what,
+                        const Check& check,
+                        bool         edges,
+                        bool         last )
+{
+   cout << "      \"" << name << "\": { \"count\": " << check.count
+        << ", \"" << what << "\": [";
+
+   for( size_t k=0; k<check.where.size(); k += edges ? 2 : 1 )
+   {
+      cout << ( k > 0 ? ", " : "" );
+      if( edges ) cout << "[" << check.where[k] << ", " << check.where[k+1] << "]";
+      else        cout << check.where[k];
+   }
+
+   cout << "] }" << ( last ? "" : "," ) << "\n";
+}
+
+void printReport( const char*   fileName,
+                  const Mesh&   mesh,
+                  const Report& report,
+                  double        seconds )
+{
+   // escape the file name for JSON
+   string name;
+   for( const char* c=fileName; *c; c++ )
+   {
+      if( *c == '"' || *c == '\\' ) name += '\\';
+      name += *c;
+   }
+
+   cout << "  {\n";
+   cout << "    \"file\": \"" << name << "\",\n";
+   cout << "    \"vertices\": " << mesh.nVertices << ",\n";
+   cout << "    \"faces\": " << mesh.faceStart.size()-1 << ",\n";
+   cout << "    \"edges\": " << report.nEdges << ",\n";
+   cout << "    \"boundary_edges\": " << report.nBoundaryEdges << ",\n";
+   cout << "    \"checks\": {\n";
+   printCheck( "out_of_range_indices",     "faces",    report.outOfRange,   false, false );
+   printCheck( "degenerate_faces",         "faces",    report.degenerate,   false, false );
+   printCheck( "non_manifold_edges",       "edges",    report.nonManifold,  true,  false );
+   printCheck( "inconsistent_orientation", "edges",    report.orientation,  true,  false );
+   printCheck( "unreferenced_vertices",    "vertices", report.unreferenced, false, true  );
+   cout << "    },\n";
+   cout << "    \"seconds\": " << seconds << "\n";
+   cout << "  }";
+}
@@ -0,0 +1,415 @@
+////////////////////////////////////////////////////////////////////////////////
+// objfixtures.cpp
+//
+// DESCRIPTION: turns the small meshes of the corpus into a C++ header of
+//              constexpr arrays, so that tests which only need something like
+//              simple/octahedron.obj or poly/L-plane.obj can use it without
+//              locating and parsing a file at run time.  Small tilings from
+//              tiling.h are embedded the same way.
+//
+//              Every OBJ file under the corpus directory whose size is at
+//              most the threshold is included under its path relative to
+//              that directory, e.g. "simple/quad_meshes/cube.obj".  Each of
+//              the tiling patterns is included as "tilings/<pattern>_RxC".
+//              Only positions and faces are kept; texture coordinates,
+//              normals, groups and materials are dropped.  The generated
+//              header is self-contained and needs C++11.
+// USAGE:
+//    objfixtures [-max bytes] [-size rows cols] corpus out.h
+//
+//              -max bytes - largest OBJ file to embed (default 16384)
+//
+//              -size rows cols - size of the embedded tilings (default 16 16,
+//                                0 0 leaves them out)
+//
+//              corpus - directory to search for OBJ files
+//
+//              out.h - header to write
+//
+// BUILD:
+//    g++ -std=c++17 -O2 -o objfixtures objfixtures.cpp ../tilings/patterns.cpp
+//
+// LICENSE:
+//    Released into the public domain.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "../tilings/tiling.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <set>
+#include <filesystem>
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace std;
+
+namespace fs = std::filesystem;
+
+void printHelp( void );
+
+bool loadOBJ( const string& fileName, Mesh& mesh );
+string uniqueIdentifier( const string& name, set<string>& used );
+void writeFixture( ostream& out, const string& name, const string& id, const Mesh& mesh );
+void writeTable( ostream& out, const vector<string>& names, const vector<string>& ids );
+
+static const char* patternNames[] =
+{
+   "square", "triangle", "hexagon",
+   "semi1", "semi2", "semi3", "semi4", "semi5", "semi6", "semi7", "semi8"
+};
+
+// =============================================================================
+// =============================================================================
+int main( int argc, char **argv )
+{
+   uintmax_t maxBytes = 16384;
+   int       rows     = 16;
+   int       cols     = 16;
+   int       arg      = 1;
+
+   while( arg < argc && argv[arg][0] == '-' )
+   {
+      string option = argv[arg];
+
+      if( option == "-help" )
+      {
+         printHelp();
+         exit( 1 );
+      }
+      else if( option == "-max" && arg+1 < argc )
+      {
+         maxBytes = strtoull( argv[arg+1], NULL, 10 );
+         arg += 2;
+      }
+      else if( option == "-size" && arg+2 < argc )
+      {
+         rows = atoi( argv[arg+1] );
+         cols = atoi( argv[arg+2] );
+         arg += 3;
+      }
+      else
+      {
+         cerr << "Error: unknown or incomplete option " << option << endl;
+         exit( 1 );
+      }
+   }
+
+   if( argc-arg != 2 )
+   {
+      cerr << "usage: " << argv[0] << " [-max bytes] [-size rows cols] corpus out.h" << endl;
+      cerr << "       (type -help for more options)" << endl;
+      exit( 1 );
+   }
+
+   fs::path corpus = argv[arg];
+
+   // collect the small OBJ files, in a stable order
+   vector<fs::path> files;
+   error_code       error;
+
+   for( fs::recursive_directory_iterator i( corpus, error ), end; !error && i != end; i.increment( error ))
+   {
+      if( i->is_regular_file() &&
+          i->path().extension() == ".obj" &&
+          i->file_size() <= maxBytes )
+      {
+         files.push_back( i->path() );
+      }
+   }
+   if( error )
+   {
+      cerr << "Error: couldn't search " << corpus << ": " << error.message() << endl;
+      exit( 1 );
+   }
+   sort( files.begin(), files.end() );
+
+   ofstream out( argv[arg+1] );
+   if( !out.is_open())
+   {
+      cerr << "Error: couldn't open file " << argv[arg+1] << " for output." << endl;
+      exit( 1 );
+   }
+
+   out << "////////////////////////////////////////////////////////////////////////////////\n"
+       << "// " << fs::path( argv[arg+1] ).filename().string() << " - generated by objfixtures; do not edit.\n"
+       << "//\n"
+       << "// The corpus meshes of at most " << maxBytes << " bytes";
+   if( rows > 0 && cols > 0 )
+   {
+      out << " and every tiling pattern at\n"
+          << "// " << rows << " x " << cols;
+   }
+   out << ", as constexpr arrays.  Look a mesh up by its path\n"
+       << "// relative to the corpus root, or by \"tilings/<pattern>_<rows>x<cols>\":\n"
+       << "//\n"
+       << "//    constexpr const fixtures::Fixture* octahedron =\n"
+       << "//       fixtures::find( \"simple/octahedron.obj\" );\n"
+       << "//\n"
+       << "// Vertices are x y z triples.  Face i uses the zero-based vertex indices\n"
+       << "// faceIndex[ faceStart[i] ] through faceIndex[ faceStart[i+1]-1 ].\n"
+       << "////////////////////////////////////////////////////////////////////////////////\n"
+       << "\n"
+       << "#ifndef FIXTURES_H\n"
+       << "#define FIXTURES_H\n"
+       << "\n"
+       << "namespace fixtures\n"
+       << "{\n"
+       << "\n"
+       << "struct Fixture\n"
+       << "{\n"
+       << "   const char*  name;\n"
+       << "   int          nVertices;\n"
+       << "   int          nFaces;\n"
+       << "   const float* vertex;\n"
+       << "   const int*   faceStart;\n"
+       << "   const int*   faceIndex;\n"
+       << "};\n"
+       << "\n"
+       << "namespace data\n"
+       << "{\n";
+
+   vector<string> names, ids;
+   set<string>    used;
+
+   for( size_t i=0; i<files.size(); i++ )
+   {
+      Mesh mesh;
+      if( !loadOBJ( files[i].string(), mesh ))
+      {
+         exit( 1 );
+      }
+
+      names.push_back( files[i].lexically_relative( corpus ).generic_string() );
+      ids.push_back( uniqueIdentifier( names.back(), used ));
+      writeFixture( out, names.back(), ids.back(), mesh );
+   }
+
+   if( rows > 0 && cols > 0 )
+   {
+      for( size_t p=0; p<sizeof(patternNames)/sizeof(patternNames[0]); p++ )
+      {
+         Mesh mesh;
+         generatePattern( patternNames[p], rows, cols, mesh );
+
+         names.push_back( string("tilings/") + patternNames[p] + "_" +
+                          to_string(rows) + "x" + to_string(cols) );
+         ids.push_back( uniqueIdentifier( names.back(), used ));
+         writeFixture( out, names.back(), ids.back(), mesh );
+      }
+   }
+
+   out << "}\n\n";
+   writeTable( out, names, ids );
+   out << "\n}\n\n#endif\n";
+
+   if( !out.good() )
+   {
+      cerr << "Error: failed while writing " << argv[arg+1] << endl;
+      exit( 1 );
+   }
+
+   return 0;
+}
+
+// =============================================================================
+// =============================================================================
+void printHelp( void )
+{
+   cerr << " objfixtures                                                                    " << endl;
+   cerr << "                                                                                " << endl;
+   cerr << " DESCRIPTION: writes a C++ header embedding every OBJ file under the corpus     " << endl;
+   cerr << "              directory up to a size threshold, plus each tiling pattern at a   " << endl;
+   cerr << "              small size, as constexpr vertex and face arrays with a lookup     " << endl;
+   cerr << "              table.  Only positions and faces are kept.                        " << endl;
+   cerr << " USAGE:                                                                         " << endl;
+   cerr << "    objfixtures [-max bytes] [-size rows cols] corpus out.h                     " << endl;
+   cerr << "                                                                                " << endl;
+   cerr << "              -max bytes - largest OBJ file to embed (default 16384)            " << endl;
+   cerr << "                                                                                " << endl;
+   cerr << "              -size rows cols - size of the embedded tilings (default 16 16,    " << endl;
+   cerr << "                                0 0 leaves them out)                            " << endl;
+   cerr << endl;
+}
+
+// =============================================================================
+// =============================================================================
+bool loadOBJ( const string& fileName,
+              Mesh&         mesh )
+{
+   ifstream in( fileName.c_str() );
+   if( !in.is_open())
+   {
+      cerr << "Error: couldn't open file " << fileName << " for input." << endl;
+      return false;
+   }
+
+   string line, token;
+   int    lineNumber = 0;
+
+   while( getline( in, line ))
+   {
+      lineNumber++;
+
+      istringstream words( line );
+      if( !( words >> token )) continue;
+
+      if( token == "v" )
+      {
+         float p[3] = { 0.0f, 0.0f, 0.0f };
+         words >> p[0] >> p[1] >> p[2];
+         mesh.vertex.insert( mesh.vertex.end(), p, p+3 );
+      }
+      else if( token == "f" )
+      {
+         int nVertices = (int) mesh.vertex.size() / 3;
+
+         while( words >> token )
+         {
+            // only the position index of "v/t/n" matters here
+            int v = atoi( token.c_str() );
+            v = v < 0 ? nVertices + v : v - 1;
+
+            if( v < 0 || v >= nVertices )
+            {
+               cerr << "Error: " << fileName << ":" << lineNumber
+                    << ": vertex index " << token << " out of range." << endl;
+               return false;
+            }
+
+            mesh.faceIndex.push_back( v );
+         }
+
+         mesh.faceStart.push_back( (int) mesh.faceIndex.size() );
+      }
+   }
+
+   return true;
+}
+
+// =============================================================================
+// =============================================================================
+// C++ identifier for the arrays of a fixture, e.g. "simple/cube.obj" becomes
+// "m_simple_cube_obj".
+static string identifier( const string& name )
+{
+   string id = "m_";
+   for( size_t i=0; i<name.size(); i++ )
+   {
+      id += isalnum( (unsigned char) name[i] ) ? name[i] : '_';
+   }
+   return id;
+}
+
+// Different names can map to the same identifier, e.g. "a-b.obj" and
+// "a_b.obj"; later ones get a numeric suffix so that the arrays don't clash.
+string uniqueIdentifier( const string& name,
+                         set<string>&  used )
+{
+   string id = identifier( name );
+
+   for( int n=2; used.count( id ); n++ )
+   {
+      id = identifier( name ) + "_" + to_string( n );
+   }
+
+   used.insert( id );
+   return id;
+}
+
+// float literal that reads back as exactly the same float
+static string literal( float value )
+{
+   char text[32];
+   snprintf( text, sizeof(text), "%.9g", value );
+
+   string s = text;
+   if( s.find_first_of( ".en" ) == string::npos )
+   {
+      s += ".0";
+   }
+   return s + "f";
+}
+
+template <class T>
+static void writeArray( ostream&         out,
+                        const char*      type,
+                        const string&    name,
+                        const vector<T>& values,
+                        int              perLine )
+{
+   out << "   constexpr " << type << " " << name << "[] =\n   {";
+
+   for( size_t i=0; i<values.size(); i++ )
+   {
+      out << ( i % perLine == 0 ? "\n      " : " " );
+      out << values[i] << ( i+1 < values.size() ? "," : "" );
+   }
+
+   // zero-length arrays are not allowed
+   if( values.empty() )
+   {
+      out << "\n      0";
+   }
+
+   out << "\n   };\n";
+}
+
+void writeFixture( ostream&      out,
+                   const string& name,
+                   const string& id,
+                   const Mesh&   mesh )
+{
+   vector<string> vertex( mesh.vertex.size() );
+   for( size_t i=0; i<vertex.size(); i++ )
+   {
+      vertex[i] = literal( mesh.vertex[i] );
+   }
+
+   out << "\n   // " << name << "\n";
+   writeArray( out, "float", id + "_vertex",    vertex,         6 );
+   writeArray( out, "int",   id + "_faceStart", mesh.faceStart, 12 );
+   writeArray( out, "int",   id + "_faceIndex", mesh.faceIndex, 12 );
+}
+
+// =============================================================================
+// =============================================================================
+void writeTable( ostream&              out,
+                 const vector<string>& names,
+                 const vector<string>& ids )
+{
+   out << "constexpr Fixture all[] =\n{\n";
+
+   for( size_t i=0; i<names.size(); i++ )
+   {
+      string id = "data::" + ids[i];
+
+      out << "   { \"" << names[i] << "\",\n"
+          << "     sizeof(" << id << "_vertex)/sizeof(float)/3,\n"
+          << "     sizeof(" << id << "_faceStart)/sizeof(int)-1,\n"
+          << "     " << id << "_vertex, " << id << "_faceStart, " << id << "_faceIndex }"
+          << ( i+1 < names.size() ? "," : "" ) << "\n";
+   }
+
+   out << "};\n"
+       << "\n"
+       << "constexpr int count = sizeof(all)/sizeof(all[0]);\n"
+       << "\n"
+       << "constexpr bool sameName( const char* a, const char* b )\n"
+       << "{\n"
+       << "   return *a == *b && ( *a == '\\0' || sameName( a+1, b+1 ));\n"
+       << "}\n"
+       << "\n"
+       << "// the fixture with the given name, or nullptr if there is none\n"
+       << "constexpr const Fixture* find( const char* name, int i = 0 )\n"
+       << "{\n"
+       << "   return i == count                    ? nullptr :\n"
+       << "          sameName( all[i].name, name ) ? &all[i]  :\n"
+       << "                                          find( name, i+1 );\n"
+       << "}\n";
+}
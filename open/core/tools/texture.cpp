@@ -0,0 +1,301 @@
+////////////////////////////////////////////////////////////////////////////////
+// texture.cpp
+//
+// DESCRIPTION: PNG decoding and the raw texture cache; see texture.h.  The
+//              compressed stream is inflated with zlib, everything else is
+//              done here.
+//
+// LICENSE:
+//    Released into the public domain.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "texture.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <zlib.h>
+
+using namespace std;
+
+// =============================================================================
+// =============================================================================
+static unsigned int readBigEndian( const unsigned char* p )
+{
+   return (unsigned int) p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+}
+
+static int paeth( int a, int b, int c )
+{
+   int p  = a + b - c;
+   int pa = abs( p - a ), pb = abs( p - b ), pc = abs( p - c );
+   return pa <= pb && pa <= pc ? a : pb <= pc ? b : c;
+}
+
+bool decodePNG( const unsigned char* data,
+                size_t               size,
+                const string&        name,
+                Image&               image )
+{
+   static const unsigned char signature[8] = { 137, 'P', 'N', 'G', '\r', '\n', 26, '\n' };
+
+   if( size < 8 || memcmp( data, signature, 8 ) != 0 )
+   {
+      cerr << "Error: " << name << " is not a PNG image." << endl;
+      return false;
+   }
+
+   // gather the header and the compressed stream -----------------------
+   unsigned int  width = 0, height = 0;
+   int           bitDepth = 0, colorType = -1, interlace = 0;
+   vector<Bytef> compressed;
+
+   for( size_t p=8; p+12 <= size; )
+   {
+      size_t      length = readBigEndian( data+p );
+      const char* type   = (const char*)( data+p+4 );
+      const unsigned char* chunk = data+p+8;
+
+      if( length > size-p-12 )
+      {
+         cerr << "Error: " << name << " is truncated." << endl;
+         return false;
+      }
+
+      if( strncmp( type, "IHDR", 4 ) == 0 && length >= 13 )
+      {
+         width     = readBigEndian( chunk );
+         height    = readBigEndian( chunk+4 );
+         bitDepth  = chunk[8];
+         colorType = chunk[9];
+         interlace = chunk[12];
+      }
+      else if( strncmp( type, "IDAT", 4 ) == 0 )
+      {
+         compressed.insert( compressed.end(), chunk, chunk+length );
+      }
+      else if( strncmp( type, "IEND", 4 ) == 0 )
+      {
+         break;
+      }
+
+      p += length + 12;
+   }
+
+   int channels = colorType == 0 ? 1 : colorType == 2 ? 3 : colorType == 4 ? 2 : colorType == 6 ? 4 : 0;
+
+   if( bitDepth != 8 || channels == 0 || interlace != 0 )
+   {
+      cerr << "Error: " << name << ": only non-interlaced 8-bit grey and RGB(A) PNGs are supported." << endl;
+      return false;
+   }
+   if( width == 0 || height == 0 || (unsigned long long) width * height > ( 1u << 28 ))
+   {
+      cerr << "Error: " << name << ": invalid size " << width << " x " << height << endl;
+      return false;
+   }
+
+   // inflate; every row is preceded by its filter type ----------------
+   size_t rowBytes = (size_t) width * channels;
+   uLongf inflated = ( rowBytes + 1 ) * height;
+   vector<unsigned char> raw( inflated );
+
+   if( uncompress( raw.data(), &inflated, compressed.data(), compressed.size() ) != Z_OK ||
+       inflated != raw.size() )
+   {
+      cerr << "Error: " << name << ": corrupt image data." << endl;
+      return false;
+   }
+
+   // undo the filters in place, then expand to RGBA -------------------
+   image.width  = width;
+   image.height = height;
+   image.pixels.resize( (size_t) width * height * 4 );
+
+   for( size_t y=0; y<height; y++ )
+   {
+      unsigned char*       row   = &raw[ y*(rowBytes+1) + 1 ];
+      const unsigned char* above = y > 0 ? row - (rowBytes+1) : NULL;
+      int                  filter = row[-1];
+
+      for( size_t x=0; x<rowBytes; x++ )
+      {
+         int a = x >= (size_t) channels ? row[x-channels] : 0;
+         int b = above ? above[x] : 0;
+         int c = above && x >= (size_t) channels ? above[x-channels] : 0;
+
+         switch( filter )
+         {
+            case 0:                                  break;
+            case 1: row[x] += a;                     break;
+            case 2: row[x] += b;                     break;
+            case 3: row[x] += ( a + b ) / 2;         break;
+            case 4: row[x] += paeth( a, b, c );      break;
+            default:
+               cerr << "Error: " << name << ": unknown filter type " << filter << endl;
+               return false;
+         }
+      }
+
+      unsigned char* out = &image.pixels[ y*width*4 ];
+      for( size_t x=0; x<width; x++, out+=4 )
+      {
+         const unsigned char* in = row + x*channels;
+
+         out[0] = in[0];
+         out[1] = channels >= 3 ? in[1] : in[0];
+         out[2] = channels >= 3 ? in[2] : in[0];
+         out[3] = channels == 4 ? in[3] : channels == 2 ? in[1] : 255;
+      }
+   }
+
+   return true;
+}
+
+bool loadPNG( const string& fileName,
+              Image&        image )
+{
+   MappedFile file;
+   return file.open( fileName ) && decodePNG( file.data, file.size, fileName, image );
+}
+
+// =============================================================================
+// =============================================================================
+static bool sourceStamp( const string&       sourceName,
+                         unsigned long long& size,
+                         long long&          time )
+{
+   struct stat info;
+   if( stat( sourceName.c_str(), &info ) != 0 )
+   {
+      return false;
+   }
+
+   size = info.st_size;
+   time = info.st_mtim.tv_sec * 1000000000LL + info.st_mtim.tv_nsec;
+   return true;
+}
+
+static bool writeAll( int fd, const void* data, size_t size )
+{
+   const char* p = (const char*) data;
+
+   while( size > 0 )
+   {
+      ssize_t written = write( fd, p, size );
+      if( written < 0 && errno == EINTR )
+      {
+         continue;
+      }
+      if( written <= 0 )
+      {
+         return false;
+      }
+      p    += written;
+      size -= written;
+   }
+
+   return true;
+}
+
+bool writeTextureCache( const string& cacheName,
+                        const string& sourceName,
+                        const Image&  image )
+{
+   TextureHeader header;
+   memset( &header, 0, sizeof(header) );
+
+   header.magic    = TEXTURE_MAGIC;
+   header.version  = TEXTURE_VERSION;
+   header.width    = image.width;
+   header.height   = image.height;
+   header.channels = 4;
+
+   if( !sourceStamp( sourceName, header.sourceSize, header.sourceTime ))
+   {
+      cerr << "Error: couldn't stat " << sourceName << endl;
+      return false;
+   }
+
+   // a uniquely named file next to the cache, so that concurrent writers
+   // never share it and the rename stays on one file system
+   string tempName = cacheName + ".XXXXXX";
+   int    fd       = mkstemp( &tempName[0] );
+   if( fd < 0 )
+   {
+      cerr << "Error: couldn't open file " << tempName << " for output." << endl;
+      return false;
+   }
+
+   // mkstemp() creates the file readable by its owner only
+   bool ok = fchmod( fd, 0644 ) == 0 &&
+             writeAll( fd, &header, sizeof(header) ) &&
+             writeAll( fd, image.pixels.data(), image.pixels.size() );
+
+   if( close( fd ) != 0 || !ok || rename( tempName.c_str(), cacheName.c_str() ) != 0 )
+   {
+      cerr << "Error: failed while writing " << cacheName << endl;
+      unlink( tempName.c_str() );
+      return false;
+   }
+
+   return true;
+}
+
+bool mapTexture( const string&  cacheName,
+                 const string&  sourceName,
+                 MappedTexture& texture )
+{
+   unsigned long long size;
+   long long          time;
+   struct stat        info;
+
+   // check for the file first, since MappedFile complains if it's missing
+   if( stat( cacheName.c_str(), &info ) != 0 ||
+       !sourceStamp( sourceName, size, time ) ||
+       !texture.file.open( cacheName ) || texture.file.size < sizeof(TextureHeader) )
+   {
+      return false;
+   }
+
+   const TextureHeader* header = (const TextureHeader*) texture.file.data;
+
+   if( header->magic != TEXTURE_MAGIC || header->version != TEXTURE_VERSION ||
+       header->channels != 4 || header->sourceSize != size || header->sourceTime != time ||
+       texture.file.size != sizeof(TextureHeader) + 4ull * header->width * header->height )
+   {
+      texture.file.close();
+      return false;
+   }
+
+   texture.width  = header->width;
+   texture.height = header->height;
+   texture.pixels = texture.file.data + sizeof(TextureHeader);
+
+   return true;
+}
+
+bool loadTexture( const string&  sourceName,
+                  const string&  cacheName,
+                  MappedTexture& texture )
+{
+   if( mapTexture( cacheName, sourceName, texture ))
+   {
+      return true;
+   }
+
+   Image image;
+   if( !loadPNG( sourceName, image ) || !writeTextureCache( cacheName, sourceName, image ))
+   {
+      return false;
+   }
+
+   return mapTexture( cacheName, sourceName, texture );
+}
@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////////////////////////
+// texture.h
+//
+// DESCRIPTION: PNG textures decoded once into a raw cache file that later
+//              runs map instead of decoding again.  A cache file is a
+//              TextureHeader followed directly by the pixels: 8-bit RGBA,
+//              rows from top to bottom, with no padding.  It records the size
+//              and modification time of the PNG it came from, so a stale
+//              cache is noticed without reading the PNG:
+//
+//                 MappedTexture diffuse;
+//                 loadTexture( "blub/blub_diffuse.png", "blub/blub_diffuse.rgba", diffuse );
+//                 const unsigned char* texel = diffuse.pixels + 4*( y*diffuse.width + x );
+//
+//              Only non-interlaced 8-bit grey, grey+alpha, RGB and RGBA PNGs
+//              are supported, which covers the textures in this repository.
+//
+// LICENSE:
+//    Released into the public domain.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TEXTURE_H
+#define TEXTURE_H
+
+#include "glb.h"
+
+#include <string>
+#include <vector>
+#include <stddef.h>
+
+// Image - decoded pixels, 8-bit RGBA, rows from top to bottom
+struct Image
+{
+   Image( void ) : width( 0 ), height( 0 ) {}
+
+   int                        width;
+   int                        height;
+   std::vector<unsigned char> pixels;
+};
+
+bool decodePNG( const unsigned char* data, size_t size, const std::string& name, Image& image );
+bool   loadPNG( const std::string& fileName, Image& image );
+
+struct TextureHeader
+{
+   unsigned int       magic;        // TEXTURE_MAGIC
+   unsigned int       version;      // TEXTURE_VERSION
+   unsigned int       width;
+   unsigned int       height;
+   unsigned int       channels;     // always 4
+   unsigned int       reserved0;
+   unsigned long long sourceSize;   // of the PNG, in bytes
+   long long          sourceTime;   // of the PNG, in nanoseconds since the epoch
+   unsigned long long reserved[3];  // keeps the pixels 64-byte aligned
+};
+
+const unsigned int TEXTURE_MAGIC   = 0x52584554;   // "TEXR"
+const unsigned int TEXTURE_VERSION = 1;
+
+// MappedTexture - a cache file mapped read-only; pixels point into it.
+struct MappedTexture
+{
+   MappedTexture( void ) : width( 0 ), height( 0 ), pixels( NULL ) {}
+
+   MappedFile           file;
+   int                  width;
+   int                  height;
+   const unsigned char* pixels;
+};
+
+// writeTextureCache() replaces the cache atomically, so that other processes
+// mapping it at the same time see either the old file or the new one.
+bool writeTextureCache( const std::string& cacheName, const std::string& sourceName,
+                        const Image& image );
+
+// mapTexture() quietly returns false if the cache is missing, malformed or
+// older than its source.
+bool mapTexture( const std::string& cacheName, const std::string& sourceName,
+                 MappedTexture& texture );
+
+// loadTexture() maps the cache, first rebuilding it from the PNG if needed.
+bool loadTexture( const std::string& sourceName, const std::string& cacheName,
+                  MappedTexture& texture );
+
+#endif